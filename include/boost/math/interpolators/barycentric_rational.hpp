@@ -46,6 +46,24 @@ public:
 
     Real prime(Real x) const;
 
+    // The value and derivative at x, for little more than the cost of the value:
+    std::pair<Real, Real> eval_with_prime(Real x) const;
+
+    // y[j] = r(x[j]) for every j.  The queries are evaluated in blocks which share each pass over the data,
+    // and with threads > 1 the blocks are divided between that many threads.
+    template<class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& x, OutputContainer& y, unsigned threads = 1) const
+    {
+        m_imp->evaluate(x, y, static_cast<OutputContainer*>(nullptr), threads);
+    }
+
+    // y[j] = r(x[j]) and dydx[j] = r'(x[j]) for every j, in the same pass:
+    template<class InputContainer, class OutputContainer>
+    void evaluate_with_prime(const InputContainer& x, OutputContainer& y, OutputContainer& dydx, unsigned threads = 1) const
+    {
+        m_imp->evaluate(x, y, &dydx, threads);
+    }
+
     std::vector<Real>&& return_x()
     {
         return m_imp->return_x();
@@ -94,6 +112,12 @@ Real barycentric_rational<Real>::prime(Real x) const
     return m_imp->prime(x);
 }
 
+template<class Real>
+std::pair<Real, Real> barycentric_rational<Real>::eval_with_prime(Real x) const
+{
+    return m_imp->eval_with_prime(x);
+}
+
 
 }}
 #endif
@@ -41,12 +41,47 @@ public:
        Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN());
 
     cardinal_cubic_b_spline() = default;
+
+    // Recomputes the spline for new samples, as many as it was constructed with, reusing its storage.
+    // All copies of the spline see the update, and it must not run concurrently with evaluation.
+    // For long signals, threads > 1 shares the solve of the linear system between that many threads;
+    // only the serial solve is free of allocation, as the threads are started afresh by each call.
+    template <class BidiIterator>
+    void update(BidiIterator f, BidiIterator end_p,
+                Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                unsigned threads = 1);
+    void update(const Real* const f, size_t length,
+                Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                unsigned threads = 1);
+
     Real operator()(Real x) const;
 
     Real prime(Real x) const;
 
     Real double_prime(Real x) const;
 
+    // y[j] = s(x[j]) for every j, for any containers with size() and operator[].
+    // Faster than calling the scalar routines in a loop, but may differ from them in the last bit:
+    template<class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& x, OutputContainer& y) const
+    {
+        m_imp->template evaluate<0>(x, y);
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_prime(const InputContainer& x, OutputContainer& dydx) const
+    {
+        m_imp->template evaluate<1>(x, dydx);
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_double_prime(const InputContainer& x, OutputContainer& d2ydx2) const
+    {
+        m_imp->template evaluate<2>(x, d2ydx2);
+    }
+
 private:
     std::shared_ptr<detail::cardinal_cubic_b_spline_imp<Real>> m_imp;
 };
@@ -64,6 +99,29 @@ cardinal_cubic_b_spline<Real>::cardinal_cubic_b_spline(BidiIterator f, BidiItera
 {
 }
 
+template <class Real>
+template <class BidiIterator>
+void cardinal_cubic_b_spline<Real>::update(BidiIterator f, BidiIterator end_p,
+   Real left_endpoint_derivative, Real right_endpoint_derivative, unsigned threads)
+{
+    if (!m_imp)
+    {
+        throw std::logic_error("A default constructed spline has no samples to update.\n");
+    }
+    m_imp->update(f, end_p, left_endpoint_derivative, right_endpoint_derivative, threads);
+}
+
+template<class Real>
+void cardinal_cubic_b_spline<Real>::update(const Real* const f, size_t length,
+   Real left_endpoint_derivative, Real right_endpoint_derivative, unsigned threads)
+{
+    if (!m_imp)
+    {
+        throw std::logic_error("A default constructed spline has no samples to update.\n");
+    }
+    m_imp->update(f, f + length, left_endpoint_derivative, right_endpoint_derivative, threads);
+}
+
 template<class Real>
 Real cardinal_cubic_b_spline<Real>::operator()(Real x) const
 {
@@ -37,6 +37,25 @@ public:
     {}
 
 
+    // Recomputes the interpolator for n new samples, as many as it was constructed with, reusing its storage.
+    // All copies of the interpolator see the update, and it must not run concurrently with evaluation.
+    // For long signals, threads > 1 shares the solve of the linear system between that many threads;
+    // only the serial solve is free of allocation, as the threads are started afresh by each call.
+    void update(const Real* const y,
+                size_t n,
+                Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                unsigned threads = 1) {
+        impl_->update(y, n, left_endpoint_derivative, right_endpoint_derivative, threads);
+    }
+
+    void update(std::vector<Real> const & y,
+                Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                unsigned threads = 1) {
+        impl_->update(y.data(), y.size(), left_endpoint_derivative, right_endpoint_derivative, threads);
+    }
+
     Real operator()(Real t) const {
         return impl_->operator()(t);
     }
@@ -45,6 +64,18 @@ public:
        return impl_->prime(t);
     }
 
+    // y[j] = s(t[j]) for every j, for any containers with size() and operator[].
+    // Faster than calling the scalar routines in a loop, but may differ from them in the last bits:
+    template<class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& t, OutputContainer& y) const {
+        impl_->template evaluate<0>(t, y);
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_prime(const InputContainer& t, OutputContainer& dydt) const {
+        impl_->template evaluate<1>(t, dydt);
+    }
+
     Real t_max() const {
         return impl_->t_max();
     }
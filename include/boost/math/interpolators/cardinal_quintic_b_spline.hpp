@@ -38,6 +38,21 @@ public:
     {}
 
 
+    // Recomputes the interpolator for n new samples, as many as it was constructed with, reusing its storage.
+    // All copies of the interpolator see the update, and it must not run concurrently with evaluation.
+    void update(const Real* const y,
+                size_t n,
+                std::pair<Real, Real> left_endpoint_derivatives = {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()},
+                std::pair<Real, Real> right_endpoint_derivatives = {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()}) {
+        impl_->update(y, n, left_endpoint_derivatives, right_endpoint_derivatives);
+    }
+
+    void update(std::vector<Real> const & y,
+                std::pair<Real, Real> left_endpoint_derivatives = {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()},
+                std::pair<Real, Real> right_endpoint_derivatives = {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()}) {
+        impl_->update(y.data(), y.size(), left_endpoint_derivatives, right_endpoint_derivatives);
+    }
+
     Real operator()(Real t) const {
         return impl_->operator()(t);
     }
@@ -50,6 +65,23 @@ public:
         return impl_->double_prime(t);
     }
 
+    // y[j] = s(t[j]) for every j, for any containers with size() and operator[].
+    // Faster than calling the scalar routines in a loop, but may differ from them in the last bits:
+    template<class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& t, OutputContainer& y) const {
+        impl_->template evaluate<0>(t, y);
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_prime(const InputContainer& t, OutputContainer& dydt) const {
+        impl_->template evaluate<1>(t, dydt);
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_double_prime(const InputContainer& t, OutputContainer& d2ydt2) const {
+        impl_->template evaluate<2>(t, d2ydt2);
+    }
+
     Real t_max() const {
         return impl_->t_max();
     }
@@ -0,0 +1,89 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See: Unser, Splines: A perfect fit for signal and image processing, IEEE Signal Processing Magazine 16(6), 1999.
+
+#ifndef BOOST_MATH_INTERPOLATORS_CARDINAL_TENSOR_B_SPLINE_HPP
+#define BOOST_MATH_INTERPOLATORS_CARDINAL_TENSOR_B_SPLINE_HPP
+#include <memory>
+#include <boost/math/interpolators/detail/cardinal_tensor_b_spline_detail.hpp>
+
+namespace boost::math::interpolators {
+
+//
+// Interpolates samples on a uniform grid in two or three dimensions by the tensor product of cubic or quintic B-splines.
+// The samples are in row major order: the last index varies fastest.
+//
+template<class Real, size_t dimension, unsigned degree = 3>
+class cardinal_tensor_b_spline
+{
+public:
+    using point_type = std::array<Real, dimension>;
+
+    cardinal_tensor_b_spline(const std::vector<Real>& samples, std::array<size_t, dimension> extents,
+                             point_type origin, point_type spacing)
+        : m_imp(std::make_shared<detail::cardinal_tensor_b_spline_detail<Real, dimension, degree>>(samples, extents, origin, spacing))
+    {
+    }
+
+    Real operator()(const point_type& x) const
+    {
+        return m_imp->operator()(x);
+    }
+
+    template<class... Args>
+    Real operator()(Real x0, Args... xs) const
+    {
+        static_assert(sizeof...(Args) + 1 == dimension, "The number of coordinates must equal the dimension.");
+        return m_imp->operator()(point_type{x0, static_cast<Real>(xs)...});
+    }
+
+    point_type gradient(const point_type& x) const
+    {
+        return m_imp->gradient(x);
+    }
+
+    std::array<point_type, dimension> hessian(const point_type& x) const
+    {
+        return m_imp->hessian(x);
+    }
+
+    // y[i] = s(x[i]), where x is a container of point_type:
+    template<class PointContainer, class OutputContainer>
+    void evaluate(const PointContainer& x, OutputContainer& y) const
+    {
+        m_imp->evaluate(x, y);
+    }
+
+    // The corners of the grid:
+    std::pair<point_type, point_type> domain() const
+    {
+        return m_imp->domain();
+    }
+
+    int64_t bytes() const
+    {
+        return m_imp->bytes() + sizeof(m_imp);
+    }
+
+private:
+    std::shared_ptr<detail::cardinal_tensor_b_spline_detail<Real, dimension, degree>> m_imp;
+};
+
+template<class Real>
+using bicubic_b_spline = cardinal_tensor_b_spline<Real, 2, 3>;
+
+template<class Real>
+using tricubic_b_spline = cardinal_tensor_b_spline<Real, 3, 3>;
+
+template<class Real>
+using biquintic_b_spline = cardinal_tensor_b_spline<Real, 2, 5>;
+
+template<class Real>
+using triquintic_b_spline = cardinal_tensor_b_spline<Real, 3, 5>;
+
+}
+#endif
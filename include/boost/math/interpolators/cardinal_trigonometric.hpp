@@ -6,6 +6,7 @@
 #ifndef BOOST_MATH_INTERPOLATORS_CARDINAL_TRIGONOMETRIC_HPP
 #define BOOST_MATH_INTERPOLATORS_CARDINAL_TRIGONOMETRIC_HPP
 #include <memory>
+#include <vector>
 #include <boost/math/interpolators/detail/cardinal_trigonometric_detail.hpp>
 
 namespace boost { namespace math { namespace interpolators {
@@ -50,6 +51,22 @@ public:
         return m_impl->squared_l2();
     }
 
+    // The interpolant at t0 + j*h/factor for j = 0, 1, ..., factor*v.size() - 1, computed by a single inverse FFT:
+    std::vector<Real> upsample(size_t factor) const
+    {
+        return m_impl->upsample(factor, 0);
+    }
+
+    std::vector<Real> upsample_prime(size_t factor) const
+    {
+        return m_impl->upsample(factor, 1);
+    }
+
+    std::vector<Real> upsample_double_prime(size_t factor) const
+    {
+        return m_impl->upsample(factor, 2);
+    }
+
 private:
     std::shared_ptr<interpolators::detail::cardinal_trigonometric_detail<Real>> m_impl;
 };
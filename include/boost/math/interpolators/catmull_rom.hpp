@@ -15,6 +15,8 @@
 #include <iterator>
 #include <stdexcept>
 #include <boost/config.hpp>
+#include <boost/math/interpolators/detail/interval_search.hpp>
+#include <boost/math/interpolators/detail/batch_evaluation.hpp>
 
 namespace std_workaround {
 
@@ -73,9 +75,50 @@ public:
         return m_s[i+1];
     }
 
-    Point operator()(const value_type s) const;
+    Point operator()(const value_type s) const
+    {
+        check_parameter(s);
+        auto it = std::upper_bound(m_s.begin(), m_s.end(), s);
+        //Now *it >= s. We want the index such that m_s[i] <= s < m_s[i+1]:
+        return unchecked_evaluation(s, std::distance(m_s.begin(), it - 1));
+    }
+
+    Point prime(const value_type s) const
+    {
+        check_parameter(s);
+        auto it = std::upper_bound(m_s.begin(), m_s.end(), s);
+        return unchecked_prime(s, std::distance(m_s.begin(), it - 1));
+    }
+
+    // As above, but the search for the segment containing s starts from the one found by the last call with this cursor,
+    // which makes evaluation along the curve in order O(1) per point:
+    Point operator()(const value_type s, interpolators::interval_cursor& cursor) const
+    {
+        check_parameter(s);
+        return unchecked_evaluation(s, interpolators::detail::hinted_interval_search(m_s, s, cursor.index));
+    }
+
+    Point prime(const value_type s, interpolators::interval_cursor& cursor) const
+    {
+        check_parameter(s);
+        return unchecked_prime(s, interpolators::detail::hinted_interval_search(m_s, s, cursor.index));
+    }
 
-    Point prime(const value_type s) const;
+    // p[j] = c(s[j]) for every j, for any containers with size() and operator[].  The segments for a block of
+    // parameters are found first, walking from one to the next as a cursor does, so increasing s are cheapest:
+    template<class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& s, OutputContainer& p) const
+    {
+        check_batch(s, p);
+        interpolators::detail::batch_evaluate_on_intervals(m_s, s, p, [this](value_type t, size_t i) { return unchecked_evaluation(t, i); });
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_prime(const InputContainer& s, OutputContainer& dpds) const
+    {
+        check_batch(s, dpds);
+        interpolators::detail::batch_evaluate_on_intervals(m_s, s, dpds, [this](value_type t, size_t i) { return unchecked_prime(t, i); });
+    }
 
     RandomAccessContainer&& get_points()
     {
@@ -83,6 +126,32 @@ public:
     }
 
 private:
+    void check_parameter(const value_type s) const
+    {
+        if (s < 0 || s > m_max_s)
+        {
+            throw std::domain_error("Parameter outside bounds.");
+        }
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void check_batch(const InputContainer& s, const OutputContainer& p) const
+    {
+        if (s.size() != p.size())
+        {
+            throw std::domain_error("There must be as many outputs as parameters.");
+        }
+        for (size_t j = 0; j < s.size(); ++j)
+        {
+            check_parameter(s[j]);
+        }
+    }
+
+    // Both require m_s[i] <= s < m_s[i+1]:
+    Point unchecked_evaluation(const value_type s, size_t i) const;
+
+    Point unchecked_prime(const value_type s, size_t i) const;
+
     RandomAccessContainer m_pnts;
     std::vector<value_type> m_s;
     value_type m_max_s;
@@ -144,17 +213,9 @@ catmull_rom<Point, RandomAccessContainer>::catmull_rom(RandomAccessContainer&& p
 
 
 template<class Point, class RandomAccessContainer >
-Point catmull_rom<Point, RandomAccessContainer>::operator()(const typename Point::value_type s) const
+Point catmull_rom<Point, RandomAccessContainer>::unchecked_evaluation(const typename Point::value_type s, size_t i) const
 {
     using std_workaround::size;
-    if (s < 0 || s > m_max_s)
-    {
-        throw std::domain_error("Parameter outside bounds.");
-    }
-    auto it = std::upper_bound(m_s.begin(), m_s.end(), s);
-    //Now *it >= s. We want the index such that m_s[i] <= s < m_s[i+1]:
-    size_t i = std::distance(m_s.begin(), it - 1);
-
     // Only denom21 is used twice:
     typename Point::value_type denom21 = 1/(m_s[i+1] - m_s[i]);
     typename Point::value_type s0s = m_s[i-1] - s;
@@ -204,18 +265,11 @@ Point catmull_rom<Point, RandomAccessContainer>::operator()(const typename Point
 }
 
 template<class Point, class RandomAccessContainer >
-Point catmull_rom<Point, RandomAccessContainer>::prime(const typename Point::value_type s) const
+Point catmull_rom<Point, RandomAccessContainer>::unchecked_prime(const typename Point::value_type s, size_t i) const
 {
     using std_workaround::size;
     // https://math.stackexchange.com/questions/843595/how-can-i-calculate-the-derivative-of-a-catmull-rom-spline-with-nonuniform-param
     // http://denkovacs.com/2016/02/catmull-rom-spline-derivatives/
-    if (s < 0 || s > m_max_s)
-    {
-        throw std::domain_error("Parameter outside bounds.\n");
-    }
-    auto it = std::upper_bound(m_s.begin(), m_s.end(), s);
-    //Now *it >= s. We want the index such that m_s[i] <= s < m_s[i+1]:
-    size_t i = std::distance(m_s.begin(), it - 1);
     Point A1;
     typename Point::value_type denom = 1/(m_s[i] - m_s[i-1]);
     typename Point::value_type k1 = (m_s[i]-s)*denom;
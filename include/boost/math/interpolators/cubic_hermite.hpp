@@ -28,6 +28,32 @@ public:
         return impl_->prime(x);
     }
 
+    // As above, but the search for the interval containing x starts from the one found by the last call with this cursor:
+    inline Real operator()(Real x, interval_cursor& cursor) const {
+        return impl_->operator()(x, cursor);
+    }
+
+    inline Real prime(Real x, interval_cursor& cursor) const {
+        return impl_->prime(x, cursor);
+    }
+
+    // y[j] = s(x[j]) for every j, for any containers with size() and operator[]:
+    template<class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& x, OutputContainer& y) const {
+        impl_->evaluate(x, y);
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_prime(const InputContainer& x, OutputContainer& dydx) const {
+        impl_->evaluate_prime(x, dydx);
+    }
+
+    // Speeds up the search for the interval containing x in calls without a cursor; push_back discards it:
+    void build_search_index()
+    {
+        impl_->build_search_index();
+    }
+
     friend std::ostream& operator<<(std::ostream & os, const cubic_hermite & m)
     {
         os << *m.impl_;
@@ -72,6 +98,19 @@ public:
         return impl_->prime(x);
     }
 
+    // y[j] = s(x[j]) for every j:
+    template<class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& x, OutputContainer& y) const
+    {
+        impl_->evaluate(x, y);
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_prime(const InputContainer& x, OutputContainer& dydx) const
+    {
+        impl_->evaluate_prime(x, dydx);
+    }
+
     friend std::ostream& operator<<(std::ostream & os, const cardinal_cubic_hermite & m)
     {
         os << *m.impl_;
@@ -113,6 +152,19 @@ public:
         return impl_->prime(x);
     }
 
+    // y[j] = s(x[j]) for every j:
+    template<class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& x, OutputContainer& y) const
+    {
+        impl_->evaluate(x, y);
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_prime(const InputContainer& x, OutputContainer& dydx) const
+    {
+        impl_->evaluate_prime(x, dydx);
+    }
+
     friend std::ostream& operator<<(std::ostream & os, const cardinal_cubic_hermite_aos & m)
     {
         os << *m.impl_;
@@ -9,12 +9,15 @@
 #define BOOST_MATH_INTERPOLATORS_BARYCENTRIC_RATIONAL_DETAIL_HPP
 
 #include <vector>
+#include <future>
+#include <stdexcept>
 #include <utility> // for std::move
 #include <algorithm> // for std::is_sorted
 #include <boost/lexical_cast.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>
 #include <boost/core/demangle.hpp>
 #include <boost/assert.hpp>
+#include <boost/math/interpolators/detail/interval_search.hpp>
 
 namespace boost{ namespace math{ namespace detail{
 
@@ -31,6 +34,13 @@ public:
 
     Real prime(Real x) const;
 
+    // The value and derivative in a single pass over the data:
+    std::pair<Real, Real> eval_with_prime(Real x) const;
+
+    // y[j] = r(x[j]) for every j, and dydx[j] = r'(x[j]) too if dydx is not null:
+    template<class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& x, OutputContainer& y, OutputContainer* dydx, unsigned threads) const;
+
     // The barycentric weights are not really that interesting; except to the unit tests!
     Real weight(size_t i) const { return m_w[i]; }
 
@@ -48,6 +58,13 @@ private:
 
     void calculate_weights(size_t approximation_order);
 
+    // Queries are evaluated in blocks this wide.  Each node is then loaded once per block rather than once per query,
+    // and the sums for the queries of a block are independent of each other, so the compiler can vectorize across them.
+    static const size_t block_width = 16;
+
+    template<size_t width, bool with_prime>
+    void evaluate_block(const Real* x, Real* y, Real* dydx) const;
+
     std::vector<Real> m_x;
     std::vector<Real> m_y;
     std::vector<Real> m_w;
@@ -211,5 +228,162 @@ Real barycentric_rational_imp<Real>::prime(Real x) const
 
     return numerator/denominator;
 }
+
+template<class Real>
+std::pair<Real, Real> barycentric_rational_imp<Real>::eval_with_prime(Real x) const
+{
+    Real y;
+    Real dydx;
+    evaluate_block<1, true>(&x, &y, &dydx);
+    return std::make_pair(y, dydx);
+}
+
+/*
+ * With t_i = w_i/(x - x_i), the derivative of r = sum t_i y_i / sum t_i is
+ *
+ *   r' = sum t_i (r - y_i)/(x - x_i) / sum t_i
+ *      = [sum t_i (y_k - y_i)/(x - x_i) + (r - y_k) sum t_i/(x - x_i)] / sum t_i
+ *
+ * for any k.  The first form, used by prime(), needs r before the sum can start.  The second does not, and taking x_k
+ * to be the node nearest x removes the dominant term of the first sum, so that it is as accurate as the first form.
+ */
+template<class Real>
+template<size_t width, bool with_prime>
+void barycentric_rational_imp<Real>::evaluate_block(const Real* x, Real* y, Real* dydx) const
+{
+    Real numerator[width];
+    Real denominator[width];
+    Real numerator_prime[width];
+    Real denominator_prime[width];
+    Real y_nearest[width];
+    size_t n = m_x.size();
+    size_t hint = 0;
+    for (size_t q = 0; q < width; ++q)
+    {
+        numerator[q] = 0;
+        denominator[q] = 0;
+        numerator_prime[q] = 0;
+        denominator_prime[q] = 0;
+        y_nearest[q] = 0;
+        if (with_prime)
+        {
+            size_t k = 0;
+            if (x[q] > m_x[0])
+            {
+                k = boost::math::interpolators::detail::hinted_interval_search(m_x, x[q], hint);
+                if ((k + 1 < n) && (m_x[k + 1] - x[q] < x[q] - m_x[k]))
+                {
+                    ++k;
+                }
+            }
+            y_nearest[q] = m_y[k];
+        }
+    }
+    const Real* xs = m_x.data();
+    const Real* ys = m_y.data();
+    const Real* ws = m_w.data();
+    for (size_t i = 0; i < n; ++i)
+    {
+        Real xi = xs[i];
+        Real yi = ys[i];
+        Real wi = ws[i];
+        for (size_t q = 0; q < width; ++q)
+        {
+            Real d = x[q] - xi;
+            Real t = wi/d;
+            numerator[q] += t*yi;
+            denominator[q] += t;
+            if (with_prime)
+            {
+                Real s = t/d;
+                numerator_prime[q] += s*(y_nearest[q] - yi);
+                denominator_prime[q] += s;
+            }
+        }
+    }
+    for (size_t q = 0; q < width; ++q)
+    {
+        Real r = numerator[q]/denominator[q];
+        // A query which coincides with a node gives infinite terms; the scalar routines handle that case:
+        if (!(boost::math::isfinite)(r))
+        {
+            r = this->operator()(x[q]);
+        }
+        y[q] = r;
+        if (with_prime)
+        {
+            Real dr = (numerator_prime[q] + (r - y_nearest[q])*denominator_prime[q])/denominator[q];
+            if (!(boost::math::isfinite)(dr))
+            {
+                dr = this->prime(x[q]);
+            }
+            dydx[q] = dr;
+        }
+    }
+}
+
+template<class Real>
+template<class InputContainer, class OutputContainer>
+void barycentric_rational_imp<Real>::evaluate(const InputContainer& x, OutputContainer& y, OutputContainer* dydx, unsigned threads) const
+{
+    size_t m = x.size();
+    if (y.size() != m || (dydx && dydx->size() != m))
+    {
+        throw std::domain_error("There must be as many outputs as inputs.");
+    }
+    auto run = [&](size_t first, size_t last)
+    {
+        Real xb[block_width];
+        Real yb[block_width];
+        Real db[block_width];
+        for (size_t j = first; j < last; j += block_width)
+        {
+            size_t w = (std::min)(block_width, last - j);
+            for (size_t q = 0; q < block_width; ++q)
+            {
+                // Pad a short block with copies of its first query:
+                xb[q] = x[j + (q < w ? q : 0)];
+            }
+            if (dydx)
+            {
+                evaluate_block<block_width, true>(xb, yb, db);
+            }
+            else
+            {
+                evaluate_block<block_width, false>(xb, yb, db);
+            }
+            for (size_t q = 0; q < w; ++q)
+            {
+                y[j + q] = yb[q];
+                if (dydx)
+                {
+                    (*dydx)[j + q] = db[q];
+                }
+            }
+        }
+    };
+
+    size_t blocks = (m + block_width - 1)/block_width;
+    size_t chunks = (std::min)(static_cast<size_t>(threads), blocks);
+    if (chunks < 2)
+    {
+        run(0, m);
+        return;
+    }
+    // Each thread takes a contiguous run of whole blocks:
+    std::vector<std::future<void>> futures;
+    for (size_t c = 1; c < chunks; ++c)
+    {
+        size_t first = (c*blocks/chunks)*block_width;
+        size_t last = (std::min)(((c + 1)*blocks/chunks)*block_width, m);
+        futures.push_back(std::async(std::launch::async, run, first, last));
+    }
+    run(0, (std::min)((blocks/chunks)*block_width, m));
+    for (auto& f : futures)
+    {
+        f.get();
+    }
+}
+
 }}}
 #endif
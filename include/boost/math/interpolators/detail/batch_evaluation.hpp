@@ -0,0 +1,98 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_INTERPOLATORS_DETAIL_BATCH_EVALUATION_HPP
+#define BOOST_MATH_INTERPOLATORS_DETAIL_BATCH_EVALUATION_HPP
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <boost/math/interpolators/detail/interval_search.hpp>
+
+//
+// The loops behind the evaluate(x, y) members of the piecewise polynomial interpolators, which set y[j] to the value
+// of the interpolant (or of one of its derivatives) at x[j] for every j.  x and y may be any containers with size()
+// and operator[].  Every abscissa is checked against the domain before anything is evaluated, so that the evaluation
+// loops have no exits.
+//
+namespace boost { namespace math { namespace interpolators { namespace detail {
+
+template<class InputContainer, class OutputContainer, class Real>
+void check_batch_domain(const InputContainer& x, const OutputContainer& y, const Real& a, const Real& b)
+{
+    if (x.size() != y.size())
+    {
+        throw std::domain_error("There must be as many outputs as abscissas.");
+    }
+    for (std::size_t j = 0; j < x.size(); ++j)
+    {
+        if (x[j] < a || x[j] > b)
+        {
+            std::ostringstream oss;
+            oss.precision(std::numeric_limits<Real>::digits10+3);
+            oss << "Requested abscissa x = " << x[j] << ", which is outside of allowed range ["
+                << a << ", " << b << "]";
+            throw std::domain_error(oss.str());
+        }
+    }
+}
+
+//
+// Sets y[j] = f(x[j], i), where i is the largest index with abscissas[i] <= x[j], which must exist.  The intervals for a
+// block of points are found first, walking from one to the next as a cursor does, so sorted x are cheapest; f is then
+// called in a separate loop free of searches.
+//
+template<class RandomAccessContainer, class InputContainer, class OutputContainer, class F>
+void batch_evaluate_on_intervals(const RandomAccessContainer& abscissas, const InputContainer& x, OutputContainer& y, F f)
+{
+    constexpr std::size_t block = 64;
+    std::array<std::size_t, block> idx;
+    std::size_t hint = 0;
+    for (std::size_t j0 = 0; j0 < x.size(); j0 += block)
+    {
+        std::size_t m = (std::min)(block, x.size() - j0);
+        for (std::size_t j = 0; j < m; ++j)
+        {
+            idx[j] = hinted_interval_search(abscissas, x[j0 + j], hint);
+        }
+        for (std::size_t j = 0; j < m; ++j)
+        {
+            y[j0 + j] = f(x[j0 + j], idx[j]);
+        }
+    }
+}
+
+//
+// For interpolants on the sorted abscissas: f(t, i) evaluates the polynomial on [abscissas[i], abscissas[i+1]) at t,
+// and right_value is the value at the last abscissa.
+//
+template<class RandomAccessContainer, class InputContainer, class OutputContainer, class Real, class F>
+void batch_evaluate(const RandomAccessContainer& abscissas, const InputContainer& x, OutputContainer& y, const Real& right_value, F f)
+{
+    const Real b = abscissas[abscissas.size() - 1];
+    check_batch_domain(x, y, Real(abscissas[0]), b);
+    batch_evaluate_on_intervals(abscissas, x, y, [&](const Real& t, std::size_t i) { return (t == b) ? right_value : f(t, i); });
+}
+
+//
+// For interpolants on the equispaced grid x0, x0 + h, ..., xf: f(t) evaluates the interpolant at t < xf,
+// and right_value is its value at xf.
+//
+template<class InputContainer, class OutputContainer, class Real, class F>
+void cardinal_batch_evaluate(const InputContainer& x, OutputContainer& y, const Real& x0, const Real& xf, const Real& right_value, F f)
+{
+    check_batch_domain(x, y, x0, xf);
+    for (std::size_t j = 0; j < x.size(); ++j)
+    {
+        Real t = x[j];
+        y[j] = (t == xf) ? right_value : f(t);
+    }
+}
+
+}}}} // namespaces
+#endif
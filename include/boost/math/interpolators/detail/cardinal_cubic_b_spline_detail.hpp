@@ -11,9 +11,11 @@
 #include <cmath>
 #include <vector>
 #include <memory>
+#include <stdexcept>
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>
 #include <boost/math/special_functions/trunc.hpp>
+#include <boost/math/interpolators/detail/linear_recurrence.hpp>
 
 namespace boost{ namespace math{ namespace interpolators{ namespace detail{
 
@@ -35,8 +37,33 @@ public:
 
     Real double_prime(Real x) const;
 
+    // Recomputes the coefficients for new samples f, as many as before.  Long signals are solved on the
+    // given number of threads, which allocates their bookkeeping; with one thread nothing is allocated.
+    template <class BidiIterator>
+    void update(BidiIterator f, BidiIterator end_p,
+                Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                unsigned threads = 1);
+
+    // s(x) = average() + sum_k coefficients()[k] B3((x - a)/h + 1 - k):
+    const std::vector<Real>& coefficients() const { return m_beta; }
+
+    Real average() const { return m_avg; }
+
+    // y[j] = s^{(order)}(x[j]) for every j:
+    template<unsigned order, class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& x, OutputContainer& y) const;
+
 private:
+    void factor(std::size_t length);
+
+    template <class BidiIterator>
+    void solve(BidiIterator f, std::size_t length, Real left_endpoint_derivative, Real right_endpoint_derivative, unsigned threads);
+
     std::vector<Real> m_beta;
+    // The super diagonal of the row reduced system:
+    std::vector<Real> m_super_diagonal;
+    Real m_h;
     Real m_h_inv;
     Real m_a;
     Real m_avg;
@@ -107,8 +134,6 @@ template <class BidiIterator>
 cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, BidiIterator end_p, Real left_endpoint, Real step_size,
                                              Real left_endpoint_derivative, Real right_endpoint_derivative) : m_a(left_endpoint), m_avg(0)
 {
-    using boost::math::constants::third;
-
     std::size_t length = end_p - f;
 
     if (length < 5)
@@ -138,6 +163,76 @@ cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, B
     // Storing the inverse of the stepsize does provide a measurable speedup.
     // It's not huge, but nonetheless worthwhile.
     m_h_inv = 1/step_size;
+    m_h = step_size;
+
+    factor(length);
+    solve(f, length, left_endpoint_derivative, right_endpoint_derivative, 1);
+}
+
+template <class Real>
+template <class BidiIterator>
+void cardinal_cubic_b_spline_imp<Real>::update(BidiIterator f, BidiIterator end_p, Real left_endpoint_derivative, Real right_endpoint_derivative, unsigned threads)
+{
+    std::size_t length = end_p - f;
+    if (length + 2 != m_beta.size())
+    {
+        throw std::logic_error("The updated samples must be as many as those the spline was constructed with.\n");
+    }
+    if (length < 5 && (boost::math::isnan(left_endpoint_derivative) || boost::math::isnan(right_endpoint_derivative)))
+    {
+        throw std::logic_error("Interpolation using a cubic b spline with derivatives estimated at the endpoints requires at least 5 points.\n");
+    }
+    solve(f, length, left_endpoint_derivative, right_endpoint_derivative, threads);
+}
+
+// Now we must solve an almost-tridiagonal system, which requires O(N) operations.
+// There are, in fact 5 diagonals, but they only differ from zero on the first and last row,
+// so we can patch up the tridiagonal row reduction algorithm to deal with two special rows.
+// See Kress, equations 8.41
+// The the "tridiagonal" matrix is:
+// 1  0 -1
+// 1  4  1
+//    1  4  1
+//       1  4  1
+//          ....
+//          1  4  1
+//          1  0 -1
+// Numerical estimate indicate that as N->Infinity, cond(A) -> 6.9, so this matrix is good.
+// The matrix depends only on the number of samples, so its row reduction is done once, here,
+// and only the right hand side is reduced each time the spline is given new samples.
+template <class Real>
+void cardinal_cubic_b_spline_imp<Real>::factor(std::size_t length)
+{
+    // s(x) = \sum \alpha_i B_{3}( (x- x_i - a)/h )
+    // Of course we must reindex from Kress's notation, since he uses negative indices which make C++ unhappy.
+    m_beta.resize(length + 2, std::numeric_limits<Real>::quiet_NaN());
+    m_super_diagonal.resize(length + 2, std::numeric_limits<Real>::quiet_NaN());
+
+    m_super_diagonal[0] = 0;
+    // One step of row reduction on the first row to patch up the 5-diagonal problem:
+    // 1 0 -1 | r0
+    // 1 4 1  | r1
+    // mapsto:
+    // 1 0 -1 | r0
+    // 0 4 2  | r1 - r0
+    // mapsto
+    // 1 0 -1 | r0
+    // 0 1 1/2| (r1 - r0)/4
+    m_super_diagonal[1] = 0.5;
+
+    // Now do a tridiagonal row reduction the standard way, until just before the last row:
+    for (size_t i = 2; i < m_super_diagonal.size() - 1; ++i)
+    {
+        Real diagonal = 4 - m_super_diagonal[i - 1];
+        m_super_diagonal[i] = 1/diagonal;
+    }
+}
+
+template <class Real>
+template <class BidiIterator>
+void cardinal_cubic_b_spline_imp<Real>::solve(BidiIterator f, std::size_t length, Real left_endpoint_derivative, Real right_endpoint_derivative, unsigned threads)
+{
+    using boost::math::constants::third;
 
     // Following Kress's notation, s'(a) = a1, s'(b) = b1
     Real a1 = left_endpoint_derivative;
@@ -165,16 +260,13 @@ cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, B
         b1 = m_h_inv*(t0 + t1);
     }
 
-    // s(x) = \sum \alpha_i B_{3}( (x- x_i - a)/h )
-    // Of course we must reindex from Kress's notation, since he uses negative indices which make C++ unhappy.
-    m_beta.resize(length + 2, std::numeric_limits<Real>::quiet_NaN());
-
     // Since the splines have compact support, they decay to zero very fast outside the endpoints.
     // This is often very annoying; we'd like to evaluate the interpolant a little bit outside the
     // boundary [a,b] without massive error.
     // A simple way to deal with this is just to subtract the DC component off the signal, so we need the average.
     // This algorithm for computing the average is recommended in
     // http://www.heikohoffmann.de/htmlthesis/node134.html
+    Real avg = 0;
     Real t = 1;
     for (size_t i = 0; i < length; ++i)
     {
@@ -183,82 +275,46 @@ cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, B
             std::string err = "This function you are trying to interpolate is a nan at index " + std::to_string(i) + "\n";
             throw std::logic_error(err);
         }
-        m_avg += (f[i] - m_avg) / t;
+        avg += (f[i] - avg) / t;
         t += 1;
     }
+    m_avg = avg;
 
+    // The right hand side is reduced in place in m_beta, and then overwritten by the back substitution:
+    Real* rhs = m_beta.data();
+    const std::ptrdiff_t n = static_cast<std::ptrdiff_t>(m_beta.size());
+    const Real* super_diagonal = m_super_diagonal.data();
 
-    // Now we must solve an almost-tridiagonal system, which requires O(N) operations.
-    // There are, in fact 5 diagonals, but they only differ from zero on the first and last row,
-    // so we can patch up the tridiagonal row reduction algorithm to deal with two special rows.
-    // See Kress, equations 8.41
-    // The the "tridiagonal" matrix is:
-    // 1  0 -1
-    // 1  4  1
-    //    1  4  1
-    //       1  4  1
-    //          ....
-    //          1  4  1
-    //          1  0 -1
-    // Numerical estimate indicate that as N->Infinity, cond(A) -> 6.9, so this matrix is good.
-    std::vector<Real> rhs(length + 2, std::numeric_limits<Real>::quiet_NaN());
-    std::vector<Real> super_diagonal(length + 2, std::numeric_limits<Real>::quiet_NaN());
-
-    rhs[0] = -2*step_size*a1;
-    rhs[rhs.size() - 1] = -2*step_size*b1;
-
-    super_diagonal[0] = 0;
-
-    for(size_t i = 1; i < rhs.size() - 1; ++i)
+    rhs[0] = -2*m_h*a1;
+    rhs[n - 1] = -2*m_h*b1;
+    for(std::ptrdiff_t i = 1; i < n - 1; ++i)
     {
         rhs[i] = 6*(f[i - 1] - m_avg);
-        super_diagonal[i] = 1;
     }
-
-
-    // One step of row reduction on the first row to patch up the 5-diagonal problem:
-    // 1 0 -1 | r0
-    // 1 4 1  | r1
-    // mapsto:
-    // 1 0 -1 | r0
-    // 0 4 2  | r1 - r0
-    // mapsto
-    // 1 0 -1 | r0
-    // 0 1 1/2| (r1 - r0)/4
-    super_diagonal[1] = 0.5;
     rhs[1] = (rhs[1] - rhs[0])/4;
 
-    // Now do a tridiagonal row reduction the standard way, until just before the last row:
-    for (size_t i = 2; i < rhs.size() - 1; ++i)
-    {
-        Real diagonal = 4 - super_diagonal[i - 1];
-        rhs[i] = (rhs[i] - rhs[i - 1])/diagonal;
-        super_diagonal[i] /= diagonal;
-    }
+    linear_recurrence(rhs, 2, n - 1, [super_diagonal](std::ptrdiff_t i, Real r, Real prev) { return (r - prev)/(4 - super_diagonal[i - 1]); }, threads);
 
     // Now the last row, which is in the form
     // 1 sd[n-3] 0      | rhs[n-3]
     // 0  1     sd[n-2] | rhs[n-2]
     // 1  0     -1      | rhs[n-1]
-    Real final_subdiag = -super_diagonal[rhs.size() - 3];
-    rhs[rhs.size() - 1] = (rhs[rhs.size() - 1] - rhs[rhs.size() - 3])/final_subdiag;
+    Real final_subdiag = -super_diagonal[n - 3];
+    rhs[n - 1] = (rhs[n - 1] - rhs[n - 3])/final_subdiag;
     Real final_diag = -1/final_subdiag;
     // Now we're here:
     // 1 sd[n-3] 0         | rhs[n-3]
     // 0  1     sd[n-2]    | rhs[n-2]
     // 0  1     final_diag | (rhs[n-1] - rhs[n-3])/diag
 
-    final_diag = final_diag - super_diagonal[rhs.size() - 2];
-    rhs[rhs.size() - 1] = rhs[rhs.size() - 1] - rhs[rhs.size() - 2];
-
+    final_diag = final_diag - super_diagonal[n - 2];
+    rhs[n - 1] = rhs[n - 1] - rhs[n - 2];
 
     // Back substitutions:
-    m_beta[rhs.size() - 1] = rhs[rhs.size() - 1]/final_diag;
-    for(size_t i = rhs.size() - 2; i > 0; --i)
-    {
-        m_beta[i] = rhs[i] - super_diagonal[i]*m_beta[i + 1];
-    }
-    m_beta[0] = m_beta[2] + rhs[0];
+    Real r0 = rhs[0];
+    rhs[n - 1] = rhs[n - 1]/final_diag;
+    linear_recurrence(rhs, n - 2, 0, [super_diagonal](std::ptrdiff_t i, Real r, Real next) { return r - super_diagonal[i]*next; }, threads);
+    rhs[0] = rhs[2] + r0;
 }
 
 template<class Real>
@@ -327,5 +383,73 @@ Real cardinal_cubic_b_spline_imp<Real>::double_prime(Real x) const
     return z*m_h_inv*m_h_inv;
 }
 
+//
+// At a point t = j + u, 0 <= u < 1, of the scaled grid only the four B-splines centred at j-1, ..., j+2 are nonzero,
+// and their values are cubics in u.  Evaluating those directly, rather than testing the support of each of the five
+// candidates as the scalar routines do, leaves a short straight-line loop body which the compiler can unroll and
+// vectorize.  The few points near the ends, or outside the grid, go through the scalar routines.
+//
+template<class Real>
+template<unsigned order, class InputContainer, class OutputContainer>
+void cardinal_cubic_b_spline_imp<Real>::evaluate(const InputContainer& x, OutputContainer& y) const
+{
+    using std::floor;
+    using boost::math::constants::half;
+    using boost::math::constants::sixth;
+    if (x.size() != y.size())
+    {
+        throw std::domain_error("There must be as many outputs as abscissas.");
+    }
+    const Real t_max = static_cast<Real>(m_beta.size() - 2);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        Real t = m_h_inv*(x[i] - m_a) + 1;
+        if (!(t >= 1 && t < t_max))
+        {
+            y[i] = (order == 0) ? this->operator()(x[i]) : (order == 1) ? this->prime(x[i]) : this->double_prime(x[i]);
+            continue;
+        }
+        Real jj = floor(t);
+        size_t j = static_cast<size_t>(jj);
+        Real u = t - jj;
+        Real r = 1 - u;
+        Real w0, w1, w2, w3;
+        if (order == 0)
+        {
+            w0 = sixth<Real>()*r*r*r;
+            w1 = sixth<Real>()*((3*u - 6)*u*u + 4);
+            w2 = sixth<Real>()*(((-3*u + 3)*u + 3)*u + 1);
+            w3 = sixth<Real>()*u*u*u;
+        }
+        else if (order == 1)
+        {
+            w0 = -half<Real>()*r*r;
+            w1 = u*(3*half<Real>()*u - 2);
+            w2 = half<Real>() + u*(1 - 3*half<Real>()*u);
+            w3 = half<Real>()*u*u;
+        }
+        else
+        {
+            w0 = r;
+            w1 = 3*u - 2;
+            w2 = 1 - 3*u;
+            w3 = u;
+        }
+        Real z = m_beta[j - 1]*w0 + m_beta[j]*w1 + m_beta[j + 1]*w2 + m_beta[j + 2]*w3;
+        if (order == 0)
+        {
+            y[i] = z + m_avg;
+        }
+        else if (order == 1)
+        {
+            y[i] = z*m_h_inv;
+        }
+        else
+        {
+            y[i] = z*m_h_inv*m_h_inv;
+        }
+    }
+}
+
 }}}}
 #endif
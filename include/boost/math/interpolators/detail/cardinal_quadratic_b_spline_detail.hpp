@@ -9,6 +9,8 @@
 #include <vector>
 #include <cmath>
 #include <stdexcept>
+#include <limits>
+#include <boost/math/interpolators/detail/linear_recurrence.hpp>
 
 namespace boost{ namespace math{ namespace interpolators{ namespace detail{
 
@@ -72,74 +74,23 @@ public:
             throw std::logic_error("The interpolator requires at least 3 points.");
         }
 
-        using std::isnan;
-        Real a;
-        if (isnan(left_endpoint_derivative)) {
-            // http://web.media.mit.edu/~crtaylor/calculator.html
-            a = -3*y[0] + 4*y[1] - y[2];
-        }
-        else {
-            a = 2*h*left_endpoint_derivative;
-        }
-
-        Real b;
-        if (isnan(right_endpoint_derivative)) {
-            b = 3*y[n-1] - 4*y[n-2] + y[n-3];
-        }
-        else {
-            b = 2*h*right_endpoint_derivative;
-        }
-
-        m_alpha.resize(n + 2);
-
-        // Begin row reduction:
-        std::vector<Real> rhs(n + 2, std::numeric_limits<Real>::quiet_NaN());
-        std::vector<Real> super_diagonal(n + 2, std::numeric_limits<Real>::quiet_NaN());
-
-        rhs[0] = -a;
-        rhs[rhs.size() - 1] = b;
-
-        super_diagonal[0] = 0;
-
-        for(size_t i = 1; i < rhs.size() - 1; ++i) {
-            rhs[i] = 8*y[i - 1];
-            super_diagonal[i] = 1;
-        }
-
-        // Patch up 5-diagonal problem:
-        rhs[1] = (rhs[1] - rhs[0])/6;
-        super_diagonal[1] = Real(1)/Real(3);
-        // First two rows are now:
-        // 1 0 -1 | -2hy0'
-        // 0 1 1/3| (8y0+2hy0')/6
-
-
-        // Start traditional tridiagonal row reduction:
-        for (size_t i = 2; i < rhs.size() - 1; ++i) {
-            Real diagonal = 6 - super_diagonal[i - 1];
-            rhs[i] = (rhs[i] - rhs[i - 1])/diagonal;
-            super_diagonal[i] /= diagonal;
-        }
-
-        //  1 sd[n-1] 0     | rhs[n-1]
-        //  0 1       sd[n] | rhs[n]
-        // -1 0       1     | rhs[n+1]
-
-        rhs[n+1] = rhs[n+1] + rhs[n-1];
-        Real bottom_subdiagonal = super_diagonal[n-1];
-
-        // We're here:
-        //  1 sd[n-1] 0     | rhs[n-1]
-        //  0 1       sd[n] | rhs[n]
-        //  0 bs      1     | rhs[n+1]
-
-        rhs[n+1] = (rhs[n+1]-bottom_subdiagonal*rhs[n])/(1-bottom_subdiagonal*super_diagonal[n]);
+        m_h = h;
+        factor(n);
+        solve(y, n, left_endpoint_derivative, right_endpoint_derivative, 1);
+    }
 
-        m_alpha[n+1] = rhs[n+1];
-        for (size_t i = n; i > 0; --i) {
-            m_alpha[i] = rhs[i] - m_alpha[i+1]*super_diagonal[i];
+    // Recomputes the coefficients for n new samples, as many as before.  Long signals are solved on the
+    // given number of threads, which allocates their bookkeeping; with one thread nothing is allocated.
+    void update(const Real* const y,
+                size_t n,
+                Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                unsigned threads = 1)
+    {
+        if (n + 2 != m_alpha.size()) {
+            throw std::logic_error("The updated samples must be as many as those the interpolator was constructed with.");
         }
-        m_alpha[0] = m_alpha[2] + rhs[0];
+        solve(y, n, left_endpoint_derivative, right_endpoint_derivative, threads);
     }
 
     Real operator()(Real t) const {
@@ -194,12 +145,114 @@ public:
         return y*m_inv_h;
     }
 
+    // y[j] = s^{(order)}(x[j]) for every j.  At a point x + 1 = k + u - 1/2, 0 <= u < 1, of the scaled grid only the
+    // three B-splines centred at k-1, k and k+1 are nonzero, and their values are quadratics in u.  Evaluating those
+    // directly, rather than testing the support of each candidate as the scalar routines do, leaves a short straight
+    // line loop body.  The few points near the right end, or outside the grid, go through the scalar routines.
+    template<unsigned order, class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& x, OutputContainer& y) const {
+        static_assert(order <= 1, "The quadratic B-spline only has a first derivative.");
+        using std::floor;
+        if (x.size() != y.size()) {
+            throw std::domain_error("There must be as many outputs as abscissas.");
+        }
+        const Real k_max = static_cast<Real>(m_alpha.size() - 1);
+        for (size_t i = 0; i < x.size(); ++i) {
+            Real z = (x[i] - m_t0)*m_inv_h;
+            Real kk = floor(z + Real(3)/Real(2));
+            if (!(z >= 0 && kk < k_max)) {
+                y[i] = (order == 0) ? this->operator()(x[i]) : this->prime(x[i]);
+                continue;
+            }
+            size_t k = static_cast<size_t>(kk);
+            Real u = z + Real(3)/Real(2) - kk;
+            Real r = 1 - u;
+            if (order == 0) {
+                y[i] = m_alpha[k - 1]*(r*r/2) + m_alpha[k]*(Real(3)/Real(4) - (u - Real(1)/Real(2))*(u - Real(1)/Real(2))) + m_alpha[k + 1]*(u*u/2);
+            }
+            else {
+                y[i] = (m_alpha[k]*(1 - 2*u) + m_alpha[k + 1]*u - m_alpha[k - 1]*r)*m_inv_h;
+            }
+        }
+    }
+
     Real t_max() const {
         return m_t0 + (m_alpha.size()-3)/m_inv_h;
     }
 
 private:
+    // The matrix depends only on n, so it is row reduced once, and only the right hand side is reduced for each set of samples.
+    void factor(size_t n) {
+        m_alpha.resize(n + 2);
+        m_super_diagonal.resize(n + 2, std::numeric_limits<Real>::quiet_NaN());
+        m_super_diagonal[0] = 0;
+        // Patch up 5-diagonal problem:
+        m_super_diagonal[1] = Real(1)/Real(3);
+        // First two rows are now:
+        // 1 0 -1 | -2hy0'
+        // 0 1 1/3| (8y0+2hy0')/6
+
+        // Start traditional tridiagonal row reduction:
+        for (size_t i = 2; i < n + 1; ++i) {
+            Real diagonal = 6 - m_super_diagonal[i - 1];
+            m_super_diagonal[i] = 1/diagonal;
+        }
+    }
+
+    void solve(const Real* const y, size_t n, Real left_endpoint_derivative, Real right_endpoint_derivative, unsigned threads) {
+        using std::isnan;
+        Real a;
+        if (isnan(left_endpoint_derivative)) {
+            // http://web.media.mit.edu/~crtaylor/calculator.html
+            a = -3*y[0] + 4*y[1] - y[2];
+        }
+        else {
+            a = 2*m_h*left_endpoint_derivative;
+        }
+
+        Real b;
+        if (isnan(right_endpoint_derivative)) {
+            b = 3*y[n-1] - 4*y[n-2] + y[n-3];
+        }
+        else {
+            b = 2*m_h*right_endpoint_derivative;
+        }
+
+        // The right hand side is reduced in place in m_alpha, and then overwritten by the back substitution:
+        Real* rhs = m_alpha.data();
+        const Real* super_diagonal = m_super_diagonal.data();
+        const std::ptrdiff_t m = static_cast<std::ptrdiff_t>(n);
+        rhs[0] = -a;
+        rhs[n + 1] = b;
+        for(size_t i = 1; i < n + 1; ++i) {
+            rhs[i] = 8*y[i - 1];
+        }
+        rhs[1] = (rhs[1] - rhs[0])/6;
+        linear_recurrence(rhs, 2, m + 1, [super_diagonal](std::ptrdiff_t i, Real r, Real prev) { return (r - prev)/(6 - super_diagonal[i - 1]); }, threads);
+
+        //  1 sd[n-1] 0     | rhs[n-1]
+        //  0 1       sd[n] | rhs[n]
+        // -1 0       1     | rhs[n+1]
+
+        rhs[n+1] = rhs[n+1] + rhs[n-1];
+        Real bottom_subdiagonal = super_diagonal[n-1];
+
+        // We're here:
+        //  1 sd[n-1] 0     | rhs[n-1]
+        //  0 1       sd[n] | rhs[n]
+        //  0 bs      1     | rhs[n+1]
+
+        rhs[n+1] = (rhs[n+1]-bottom_subdiagonal*rhs[n])/(1-bottom_subdiagonal*super_diagonal[n]);
+
+        Real r0 = rhs[0];
+        linear_recurrence(rhs, m, 0, [super_diagonal](std::ptrdiff_t i, Real r, Real next) { return r - next*super_diagonal[i]; }, threads);
+        rhs[0] = rhs[2] + r0;
+    }
+
     std::vector<Real> m_alpha;
+    // The super diagonal of the row reduced system:
+    std::vector<Real> m_super_diagonal;
+    Real m_h;
     Real m_inv_h;
     Real m_t0;
 };
@@ -9,6 +9,8 @@
 #include <cmath>
 #include <vector>
 #include <utility>
+#include <limits>
+#include <stdexcept>
 #include <boost/math/special_functions/cardinal_b_spline.hpp>
 
 namespace boost{ namespace math{ namespace interpolators{ namespace detail{
@@ -39,38 +41,166 @@ public:
             throw std::logic_error("The quintic B-spline interpolator requires at least 8 points.");
         }
 
-        using std::isnan;
-        // This interpolator has error of order h^6, so the derivatives should be estimated with the same error.
-        // See: https://en.wikipedia.org/wiki/Finite_difference_coefficient
-        if (isnan(left_endpoint_derivatives.first)) {
-            Real tmp = -49*y[0]/20 + 6*y[1] - 15*y[2]/2 + 20*y[3]/3 - 15*y[4]/4 + 6*y[5]/5 - y[6]/6;
-            left_endpoint_derivatives.first = tmp/h;
+        m_h = h;
+        factor(n);
+        solve(y, n, left_endpoint_derivatives, right_endpoint_derivatives);
+    }
+
+    // Recomputes the coefficients for n new samples, as many as before, without allocating:
+    void update(const Real* const y,
+                size_t n,
+                std::pair<Real, Real> left_endpoint_derivatives,
+                std::pair<Real, Real> right_endpoint_derivatives)
+    {
+        if (n + 4 != m_alpha.size()) {
+            throw std::logic_error("The updated samples must be as many as those the interpolator was constructed with.");
         }
-        if (isnan(right_endpoint_derivatives.first)) {
-            Real tmp = 49*y[n-1]/20 - 6*y[n-2] + 15*y[n-3]/2 - 20*y[n-4]/3 + 15*y[n-5]/4 - 6*y[n-6]/5 + y[n-7]/6;
-            right_endpoint_derivatives.first = tmp/h;
+        solve(y, n, left_endpoint_derivatives, right_endpoint_derivatives);
+    }
+
+    Real operator()(Real t) const {
+        using std::ceil;
+        using std::floor;
+        using boost::math::cardinal_b_spline;
+        // tf = t0 + (n-1)*h
+        // alpha.size() = n+4
+        if (t < m_t0 || t > m_t0 + (m_alpha.size()-5)/m_inv_h) {
+            const char* err_msg = "Tried to evaluate the cardinal quintic b-spline outside the domain of of interpolation; extrapolation does not work.";
+            throw std::domain_error(err_msg);
         }
-        if(isnan(left_endpoint_derivatives.second)) {
-            Real tmp = 469*y[0]/90 - 223*y[1]/10 + 879*y[2]/20 - 949*y[3]/18 + 41*y[4] - 201*y[5]/10 + 1019*y[6]/180 - 7*y[7]/10;
-            left_endpoint_derivatives.second = tmp/(h*h);
+        Real x = (t-m_t0)*m_inv_h;
+        // Support of B_5 is [-3, 3]. So -3 < x - j + 2 < 3, so x-1 < j < x+5.
+        // TODO: Zero pad m_alpha so that only the domain check is necessary.
+        int64_t j_min = std::max(int64_t(0), int64_t(ceil(x-1)));
+        int64_t j_max = std::min(int64_t(m_alpha.size() - 1), int64_t(floor(x+5)) );
+        Real s = 0;
+        for (int64_t j = j_min; j <= j_max; ++j) {
+            // TODO: Use Cox 1972 to generate all integer translates of B5 simultaneously.
+            s += m_alpha[j]*cardinal_b_spline<5, Real>(x - j + 2);
         }
-        if (isnan(right_endpoint_derivatives.second)) {
-            Real tmp = 469*y[n-1]/90 - 223*y[n-2]/10 + 879*y[n-3]/20 - 949*y[n-4]/18 + 41*y[n-5] - 201*y[n-6]/10 + 1019*y[n-7]/180 - 7*y[n-8]/10;
-            right_endpoint_derivatives.second = tmp/(h*h);
+        return s;
+    }
+
+    Real prime(Real t) const {
+        using std::ceil;
+        using std::floor;
+        using boost::math::cardinal_b_spline_prime;
+        if (t < m_t0 || t > m_t0 + (m_alpha.size()-5)/m_inv_h) {
+            const char* err_msg = "Tried to evaluate the cardinal quintic b-spline outside the domain of of interpolation; extrapolation does not work.";
+            throw std::domain_error(err_msg);
+        }
+        Real x = (t-m_t0)*m_inv_h;
+        // Support of B_5 is [-3, 3]. So -3 < x - j + 2 < 3, so x-1 < j < x+5
+        int64_t j_min = std::max(int64_t(0), int64_t(ceil(x-1)));
+        int64_t j_max = std::min(int64_t(m_alpha.size() - 1), int64_t(floor(x+5)) );
+        Real s = 0;
+        for (int64_t j = j_min; j <= j_max; ++j) {
+            s += m_alpha[j]*cardinal_b_spline_prime<5, Real>(x - j + 2);
         }
+        return s*m_inv_h;
 
-        // This is really challenging my mental limits on by-hand row reduction.
-        // I debated bringing in a dependency on a sparse linear solver, but given that that would cause much agony for users I decided against it.
+    }
 
-        std::vector<Real> rhs(n+4);
-        rhs[0] = 20*y[0] - 12*h*left_endpoint_derivatives.first +  2*h*h*left_endpoint_derivatives.second;
-        rhs[1] = 60*y[0] - 12*h*left_endpoint_derivatives.first;
-        for (size_t i = 2; i < n + 2; ++i) {
-            rhs[i] = 120*y[i-2];
+    Real double_prime(Real t) const {
+        using std::ceil;
+        using std::floor;
+        using boost::math::cardinal_b_spline_double_prime;
+        if (t < m_t0 || t > m_t0 + (m_alpha.size()-5)/m_inv_h) {
+            const char* err_msg = "Tried to evaluate the cardinal quintic b-spline outside the domain of of interpolation; extrapolation does not work.";
+            throw std::domain_error(err_msg);
         }
-        rhs[n+2] = 60*y[n-1] + 12*h*right_endpoint_derivatives.first;
-        rhs[n+3] = 20*y[n-1] + 12*h*right_endpoint_derivatives.first +  2*h*h*right_endpoint_derivatives.second;
+        Real x = (t-m_t0)*m_inv_h;
+        // Support of B_5 is [-3, 3]. So -3 < x - j + 2 < 3, so x-1 < j < x+5
+        int64_t j_min = std::max(int64_t(0), int64_t(ceil(x-1)));
+        int64_t j_max = std::min(int64_t(m_alpha.size() - 1), int64_t(floor(x+5)) );
+        Real s = 0;
+        for (int64_t j = j_min; j <= j_max; ++j) {
+            s += m_alpha[j]*cardinal_b_spline_double_prime<5, Real>(x - j + 2);
+        }
+        return s*m_inv_h*m_inv_h;
+    }
+
+
+    // y[j] = s^{(order)}(x[j]) for every j.  At a point x + 2 = k + u, 0 <= u < 1, of the scaled grid only the six
+    // B-splines centred at k-2, ..., k+3 are nonzero, and their values are quintics in u.  Evaluating those directly,
+    // rather than evaluating B5 for each candidate as the scalar routines do, leaves a short straight line loop body.
+    // The few points near the right end, or outside the grid, go through the scalar routines.
+    template<unsigned order, class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& x, OutputContainer& y) const {
+        static_assert(order <= 2, "Only the first and second derivatives of the quintic B-spline are available.");
+        using std::floor;
+        if (x.size() != y.size()) {
+            throw std::domain_error("There must be as many outputs as abscissas.");
+        }
+        const Real k_max = static_cast<Real>(m_alpha.size() - 3);
+        for (size_t i = 0; i < x.size(); ++i) {
+            Real z = (x[i] - m_t0)*m_inv_h;
+            Real kk = floor(z + 2);
+            if (!(z >= 0 && kk < k_max)) {
+                y[i] = (order == 0) ? this->operator()(x[i]) : (order == 1) ? this->prime(x[i]) : this->double_prime(x[i]);
+                continue;
+            }
+            size_t k = static_cast<size_t>(kk);
+            Real u = z + 2 - kk;
+            Real r = 1 - u;
+            Real w0, w1, w2, w3, w4, w5;
+            if (order == 0) {
+                Real r2 = r*r;
+                Real u2 = u*u;
+                w0 = r2*r2*r;
+                w1 = 26 + u*(-50 + u*(20 + u*(20 + u*(-20 + 5*u))));
+                w2 = 66 + u2*(-60 + u2*(30 - 10*u));
+                w3 = 26 + u*(50 + u*(20 + u*(-20 + u*(-20 + 10*u))));
+                w4 = 1 + u*(5 + u*(10 + u*(10 + u*(5 - 5*u))));
+                w5 = u2*u2*u;
+            }
+            else if (order == 1) {
+                Real r2 = r*r;
+                Real u2 = u*u;
+                w0 = -5*r2*r2;
+                w1 = -50 + u*(40 + u*(60 + u*(-80 + 25*u)));
+                w2 = u*(-120 + u2*(120 - 50*u));
+                w3 = 50 + u*(40 + u*(-60 + u*(-80 + 50*u)));
+                w4 = 5 + u*(20 + u*(30 + u*(20 - 25*u)));
+                w5 = 5*u2*u2;
+            }
+            else {
+                w0 = 20*r*r*r;
+                w1 = 40 + u*(120 + u*(-240 + 100*u));
+                w2 = -120 + u*u*(360 - 200*u);
+                w3 = 40 + u*(-120 + u*(-240 + 200*u));
+                w4 = 20 + u*(60 + u*(60 - 100*u));
+                w5 = 20*u*u*u;
+            }
+            Real z5 = m_alpha[k - 2]*w0 + m_alpha[k - 1]*w1 + m_alpha[k]*w2 + m_alpha[k + 1]*w3 + m_alpha[k + 2]*w4 + m_alpha[k + 3]*w5;
+            z5 /= 120;
+            if (order == 0) {
+                y[i] = z5;
+            }
+            else if (order == 1) {
+                y[i] = z5*m_inv_h;
+            }
+            else {
+                y[i] = z5*m_inv_h*m_inv_h;
+            }
+        }
+    }
+
+    // s(t) = sum_j coefficients()[j] B5((t - t0)/h + 2 - j):
+    const std::vector<Real>& coefficients() const {
+        return m_alpha;
+    }
+
+    Real t_max() const {
+        return m_t0 + (m_alpha.size()-5)/m_inv_h;
+    }
 
+private:
+    // The matrix depends only on n, so it is row reduced once, here.  The multipliers of each step are recorded, so
+    // that solve can apply exactly the same operations to the right hand side of each new set of samples.
+    void factor(size_t n) {
+        // This is really challenging my mental limits on by-hand row reduction.
+        // I debated bringing in a dependency on a sparse linear solver, but given that that would cause much agony for users I decided against it.
         std::vector<Real> diagonal(n+4, 66);
         diagonal[0] = 1;
         diagonal[1] = 18;
@@ -102,136 +232,122 @@ public:
         second_subdiagonal[n+2] = 8;
         second_subdiagonal[n+3] = 9;
 
-
+        m_pivot.resize(n+2);
+        m_first_multiplier.resize(n+2);
+        m_second_multiplier.resize(n+2);
         for (size_t i = 0; i < n+2; ++i) {
             Real di = diagonal[i];
+            m_pivot[i] = di;
             diagonal[i] = 1;
             first_superdiagonal[i] /= di;
             second_superdiagonal[i] /= di;
-            rhs[i] /= di;
 
             // Eliminate first subdiagonal:
             Real nfsub = -first_subdiagonal[i+1];
+            m_first_multiplier[i] = nfsub;
             // Superfluous:
             first_subdiagonal[i+1] /= nfsub;
             // Not superfluous:
             diagonal[i+1] /= nfsub;
             first_superdiagonal[i+1] /= nfsub;
             second_superdiagonal[i+1] /= nfsub;
-            rhs[i+1] /= nfsub;
 
             diagonal[i+1] += first_superdiagonal[i];
             first_superdiagonal[i+1] += second_superdiagonal[i];
-            rhs[i+1] += rhs[i];
             // Superfluous, but clarifying:
             first_subdiagonal[i+1] = 0;
 
             // Eliminate second subdiagonal:
             Real nssub = -second_subdiagonal[i+2];
+            m_second_multiplier[i] = nssub;
             first_subdiagonal[i+2] /= nssub;
             diagonal[i+2] /= nssub;
             first_superdiagonal[i+2] /= nssub;
             second_superdiagonal[i+2] /= nssub;
-            rhs[i+2] /= nssub;
 
             first_subdiagonal[i+2] += first_superdiagonal[i];
             diagonal[i+2] += second_superdiagonal[i];
-            rhs[i+2] += rhs[i];
             // Superfluous, but clarifying:
             second_subdiagonal[i+2] = 0;
         }
 
         // Eliminate last subdiagonal:
-        Real dnp2 = diagonal[n+2];
+        m_last_pivots[0] = diagonal[n+2];
         diagonal[n+2] = 1;
-        first_superdiagonal[n+2] /= dnp2;
-        rhs[n+2] /= dnp2;
-        Real nfsubnp3 = -first_subdiagonal[n+3];
-        diagonal[n+3] /= nfsubnp3;
-        rhs[n+3] /= nfsubnp3;
+        first_superdiagonal[n+2] /= m_last_pivots[0];
+        m_last_pivots[1] = -first_subdiagonal[n+3];
+        diagonal[n+3] /= m_last_pivots[1];
 
         diagonal[n+3] += first_superdiagonal[n+2];
-        rhs[n+3] += rhs[n+2];
+        m_last_pivots[2] = diagonal[n+3];
 
         m_alpha.resize(n + 4, std::numeric_limits<Real>::quiet_NaN());
-
-        m_alpha[n+3] = rhs[n+3]/diagonal[n+3];
-        m_alpha[n+2] = rhs[n+2] - first_superdiagonal[n+2]*m_alpha[n+3];
-        for (int64_t i = int64_t(n+1); i >= 0; --i) {
-            m_alpha[i] = rhs[i] - first_superdiagonal[i]*m_alpha[i+1] - second_superdiagonal[i]*m_alpha[i+2];
-        }
-
+        m_first_superdiagonal = std::move(first_superdiagonal);
+        m_second_superdiagonal = std::move(second_superdiagonal);
     }
 
-    Real operator()(Real t) const {
-        using std::ceil;
-        using std::floor;
-        using boost::math::cardinal_b_spline;
-        // tf = t0 + (n-1)*h
-        // alpha.size() = n+4
-        if (t < m_t0 || t > m_t0 + (m_alpha.size()-5)/m_inv_h) {
-            const char* err_msg = "Tried to evaluate the cardinal quintic b-spline outside the domain of of interpolation; extrapolation does not work.";
-            throw std::domain_error(err_msg);
+    void solve(const Real* const y, size_t n, std::pair<Real, Real> left_endpoint_derivatives, std::pair<Real, Real> right_endpoint_derivatives) {
+        using std::isnan;
+        const Real h = m_h;
+        // This interpolator has error of order h^6, so the derivatives should be estimated with the same error.
+        // See: https://en.wikipedia.org/wiki/Finite_difference_coefficient
+        if (isnan(left_endpoint_derivatives.first)) {
+            Real tmp = -49*y[0]/20 + 6*y[1] - 15*y[2]/2 + 20*y[3]/3 - 15*y[4]/4 + 6*y[5]/5 - y[6]/6;
+            left_endpoint_derivatives.first = tmp/h;
         }
-        Real x = (t-m_t0)*m_inv_h;
-        // Support of B_5 is [-3, 3]. So -3 < x - j + 2 < 3, so x-1 < j < x+5.
-        // TODO: Zero pad m_alpha so that only the domain check is necessary.
-        int64_t j_min = std::max(int64_t(0), int64_t(ceil(x-1)));
-        int64_t j_max = std::min(int64_t(m_alpha.size() - 1), int64_t(floor(x+5)) );
-        Real s = 0;
-        for (int64_t j = j_min; j <= j_max; ++j) {
-            // TODO: Use Cox 1972 to generate all integer translates of B5 simultaneously.
-            s += m_alpha[j]*cardinal_b_spline<5, Real>(x - j + 2);
+        if (isnan(right_endpoint_derivatives.first)) {
+            Real tmp = 49*y[n-1]/20 - 6*y[n-2] + 15*y[n-3]/2 - 20*y[n-4]/3 + 15*y[n-5]/4 - 6*y[n-6]/5 + y[n-7]/6;
+            right_endpoint_derivatives.first = tmp/h;
         }
-        return s;
-    }
-
-    Real prime(Real t) const {
-        using std::ceil;
-        using std::floor;
-        using boost::math::cardinal_b_spline_prime;
-        if (t < m_t0 || t > m_t0 + (m_alpha.size()-5)/m_inv_h) {
-            const char* err_msg = "Tried to evaluate the cardinal quintic b-spline outside the domain of of interpolation; extrapolation does not work.";
-            throw std::domain_error(err_msg);
+        if(isnan(left_endpoint_derivatives.second)) {
+            Real tmp = 469*y[0]/90 - 223*y[1]/10 + 879*y[2]/20 - 949*y[3]/18 + 41*y[4] - 201*y[5]/10 + 1019*y[6]/180 - 7*y[7]/10;
+            left_endpoint_derivatives.second = tmp/(h*h);
         }
-        Real x = (t-m_t0)*m_inv_h;
-        // Support of B_5 is [-3, 3]. So -3 < x - j + 2 < 3, so x-1 < j < x+5
-        int64_t j_min = std::max(int64_t(0), int64_t(ceil(x-1)));
-        int64_t j_max = std::min(int64_t(m_alpha.size() - 1), int64_t(floor(x+5)) );
-        Real s = 0;
-        for (int64_t j = j_min; j <= j_max; ++j) {
-            s += m_alpha[j]*cardinal_b_spline_prime<5, Real>(x - j + 2);
+        if (isnan(right_endpoint_derivatives.second)) {
+            Real tmp = 469*y[n-1]/90 - 223*y[n-2]/10 + 879*y[n-3]/20 - 949*y[n-4]/18 + 41*y[n-5] - 201*y[n-6]/10 + 1019*y[n-7]/180 - 7*y[n-8]/10;
+            right_endpoint_derivatives.second = tmp/(h*h);
         }
-        return s*m_inv_h;
 
-    }
-
-    Real double_prime(Real t) const {
-        using std::ceil;
-        using std::floor;
-        using boost::math::cardinal_b_spline_double_prime;
-        if (t < m_t0 || t > m_t0 + (m_alpha.size()-5)/m_inv_h) {
-            const char* err_msg = "Tried to evaluate the cardinal quintic b-spline outside the domain of of interpolation; extrapolation does not work.";
-            throw std::domain_error(err_msg);
-        }
-        Real x = (t-m_t0)*m_inv_h;
-        // Support of B_5 is [-3, 3]. So -3 < x - j + 2 < 3, so x-1 < j < x+5
-        int64_t j_min = std::max(int64_t(0), int64_t(ceil(x-1)));
-        int64_t j_max = std::min(int64_t(m_alpha.size() - 1), int64_t(floor(x+5)) );
-        Real s = 0;
-        for (int64_t j = j_min; j <= j_max; ++j) {
-            s += m_alpha[j]*cardinal_b_spline_double_prime<5, Real>(x - j + 2);
+        // The right hand side is reduced in place in m_alpha, and then overwritten by the back substitution:
+        Real* rhs = m_alpha.data();
+        rhs[0] = 20*y[0] - 12*h*left_endpoint_derivatives.first +  2*h*h*left_endpoint_derivatives.second;
+        rhs[1] = 60*y[0] - 12*h*left_endpoint_derivatives.first;
+        for (size_t i = 2; i < n + 2; ++i) {
+            rhs[i] = 120*y[i-2];
         }
-        return s*m_inv_h*m_inv_h;
-    }
+        rhs[n+2] = 60*y[n-1] + 12*h*right_endpoint_derivatives.first;
+        rhs[n+3] = 20*y[n-1] + 12*h*right_endpoint_derivatives.first +  2*h*h*right_endpoint_derivatives.second;
 
+        for (size_t i = 0; i < n+2; ++i) {
+            rhs[i] /= m_pivot[i];
+            rhs[i+1] /= m_first_multiplier[i];
+            rhs[i+1] += rhs[i];
+            rhs[i+2] /= m_second_multiplier[i];
+            rhs[i+2] += rhs[i];
+        }
+        rhs[n+2] /= m_last_pivots[0];
+        rhs[n+3] /= m_last_pivots[1];
+        rhs[n+3] += rhs[n+2];
 
-    Real t_max() const {
-        return m_t0 + (m_alpha.size()-5)/m_inv_h;
+        const Real* first_superdiagonal = m_first_superdiagonal.data();
+        const Real* second_superdiagonal = m_second_superdiagonal.data();
+        m_alpha[n+3] = rhs[n+3]/m_last_pivots[2];
+        m_alpha[n+2] = rhs[n+2] - first_superdiagonal[n+2]*m_alpha[n+3];
+        for (int64_t i = int64_t(n+1); i >= 0; --i) {
+            m_alpha[i] = rhs[i] - first_superdiagonal[i]*m_alpha[i+1] - second_superdiagonal[i]*m_alpha[i+2];
+        }
     }
 
-private:
     std::vector<Real> m_alpha;
+    // The row reduction of the matrix: the divisor of each row, the multipliers of the two rows below it,
+    // the last three pivots, and the reduced superdiagonals:
+    std::vector<Real> m_pivot;
+    std::vector<Real> m_first_multiplier;
+    std::vector<Real> m_second_multiplier;
+    Real m_last_pivots[3];
+    std::vector<Real> m_first_superdiagonal;
+    std::vector<Real> m_second_superdiagonal;
+    Real m_h;
     Real m_inv_h;
     Real m_t0;
 };
@@ -0,0 +1,491 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_INTERPOLATORS_DETAIL_CARDINAL_TENSOR_B_SPLINE_DETAIL_HPP
+#define BOOST_MATH_INTERPOLATORS_DETAIL_CARDINAL_TENSOR_B_SPLINE_DETAIL_HPP
+#include <array>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/special_functions/cardinal_b_spline.hpp>
+#include <boost/math/interpolators/detail/cardinal_cubic_b_spline_detail.hpp>
+#include <boost/math/interpolators/detail/cardinal_quintic_b_spline_detail.hpp>
+
+namespace boost::math::interpolators::detail {
+
+// The one dimensional interpolation problem along a single line of the grid, solved by the one dimensional splines.
+template<class Real, unsigned degree>
+class b_spline_prefilter;
+
+template<class Real>
+class b_spline_prefilter<Real, 3>
+{
+public:
+    static constexpr size_t min_samples = 5;
+
+    b_spline_prefilter(const std::vector<Real>& f, Real h) : imp_(f.begin(), f.end(), Real(0), h) {}
+
+    void update(const std::vector<Real>& f)
+    {
+        imp_.update(f.begin(), f.end());
+    }
+
+    // The coefficient of B3(x/h + 1 - k):
+    Real coefficient(size_t k) const
+    {
+        return imp_.coefficients()[k] + imp_.average();
+    }
+
+private:
+    cardinal_cubic_b_spline_imp<Real> imp_;
+};
+
+template<class Real>
+class b_spline_prefilter<Real, 5>
+{
+public:
+    static constexpr size_t min_samples = 8;
+
+    b_spline_prefilter(const std::vector<Real>& f, Real h) : imp_(f.data(), f.size(), Real(0), h, estimate(), estimate()) {}
+
+    void update(const std::vector<Real>& f)
+    {
+        imp_.update(f.data(), f.size(), estimate(), estimate());
+    }
+
+    // The coefficient of B5(x/h + 2 - k):
+    Real coefficient(size_t k) const
+    {
+        return imp_.coefficients()[k];
+    }
+
+private:
+    static std::pair<Real, Real> estimate()
+    {
+        return {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()};
+    }
+
+    cardinal_quintic_b_spline_detail<Real> imp_;
+};
+
+//
+// The values and derivatives of the degree + 1 B-splines which are nonzero at the point f, 0 <= f <= 1, of the cell
+// they cover, in order of increasing translate.
+//
+template<class Real, unsigned degree, unsigned order>
+void b_spline_stencil_weights(Real f, std::array<Real, degree + 1>& w, std::array<Real, degree + 1>& dw, std::array<Real, degree + 1>& d2w)
+{
+    if constexpr (degree == 3)
+    {
+        Real r = 1 - f;
+        w[0] = r*r*r/6;
+        w[1] = ((3*f - 6)*f*f + 4)/6;
+        w[2] = (((-3*f + 3)*f + 3)*f + 1)/6;
+        w[3] = f*f*f/6;
+        if constexpr (order >= 1)
+        {
+            dw[0] = -r*r/2;
+            dw[1] = f*(3*f - 4)/2;
+            dw[2] = (1 + f*(2 - 3*f))/2;
+            dw[3] = f*f/2;
+        }
+        if constexpr (order >= 2)
+        {
+            d2w[0] = r;
+            d2w[1] = 3*f - 2;
+            d2w[2] = 1 - 3*f;
+            d2w[3] = f;
+        }
+    }
+    else
+    {
+        static_assert(degree == 5, "Only cubic and quintic B-splines are supported.");
+        for (unsigned s = 0; s <= degree; ++s)
+        {
+            Real x = f + 2 - s;
+            w[s] = boost::math::cardinal_b_spline<5, Real>(x);
+            if constexpr (order >= 1)
+            {
+                dw[s] = boost::math::cardinal_b_spline_prime<5, Real>(x);
+            }
+            if constexpr (order >= 2)
+            {
+                d2w[s] = boost::math::cardinal_b_spline_double_prime<5, Real>(x);
+            }
+        }
+    }
+}
+
+template<class Real, size_t dimension, unsigned degree>
+class cardinal_tensor_b_spline_detail
+{
+public:
+    static_assert(dimension == 2 || dimension == 3, "Tensor product B-splines are implemented in two and three dimensions.");
+    static_assert(degree == 3 || degree == 5, "Tensor product B-splines are implemented for cubic and quintic B-splines.");
+    using point_type = std::array<Real, dimension>;
+    static constexpr size_t stencil = degree + 1;
+    // The coefficients are stored in tiles of tile^dimension, each of which is contiguous; see the constructor:
+    static constexpr size_t tile = 8;
+
+    cardinal_tensor_b_spline_detail(const std::vector<Real>& samples, std::array<size_t, dimension> extents,
+                                    point_type origin, point_type spacing)
+        : extents_{extents}, origin_{origin}, spacing_{spacing}
+    {
+        using std::isfinite;
+        size_t total = 1;
+        for (size_t a = 0; a < dimension; ++a)
+        {
+            if (extents[a] < b_spline_prefilter<Real, degree>::min_samples)
+            {
+                std::ostringstream oss;
+                oss << "The extent of the grid along each axis must be at least " << b_spline_prefilter<Real, degree>::min_samples
+                    << ", but along axis " << a << " it is " << extents[a] << ".";
+                throw std::domain_error(oss.str());
+            }
+            if (!(spacing[a] > 0) || !isfinite(spacing[a]) || !isfinite(origin[a]))
+            {
+                throw std::domain_error("The origin of the grid must be finite, and its spacing finite and positive.");
+            }
+            inv_spacing_[a] = 1/spacing[a];
+            total *= extents[a];
+        }
+        if (samples.size() != total)
+        {
+            std::ostringstream oss;
+            oss << "The grid has " << total << " points, but " << samples.size() << " samples were provided.";
+            throw std::domain_error(oss.str());
+        }
+
+        // The tensor product interpolation problem separates: solving the one dimensional problem along every line of
+        // the grid parallel to the first axis, then along every line of those coefficients parallel to the second axis,
+        // and so on, gives the coefficients of the tensor product spline.  Each pass adds degree - 1 coefficients along its axis.
+        std::vector<Real> c;
+        std::array<size_t, dimension> e = extents;
+        for (size_t a = 0; a < dimension; ++a)
+        {
+            const std::vector<Real>& source = (a == 0) ? samples : c;
+            size_t n = e[a];
+            size_t m = n + degree - 1;
+            size_t inner = 1;
+            for (size_t b = a + 1; b < dimension; ++b)
+            {
+                inner *= e[b];
+            }
+            size_t outer = 1;
+            for (size_t b = 0; b < a; ++b)
+            {
+                outer *= e[b];
+            }
+            std::vector<Real> next(outer*m*inner);
+            std::vector<Real> line(n);
+            std::optional<b_spline_prefilter<Real, degree>> filter;
+            for (size_t o = 0; o < outer; ++o)
+            {
+                for (size_t i = 0; i < inner; ++i)
+                {
+                    for (size_t k = 0; k < n; ++k)
+                    {
+                        line[k] = source[(o*n + k)*inner + i];
+                    }
+                    if (filter)
+                    {
+                        filter->update(line);
+                    }
+                    else
+                    {
+                        filter.emplace(line, spacing[a]);
+                    }
+                    for (size_t k = 0; k < m; ++k)
+                    {
+                        next[(o*m + k)*inner + i] = filter->coefficient(k);
+                    }
+                }
+            }
+            c = std::move(next);
+            e[a] = m;
+        }
+
+        // Store the coefficients in tiles of 8 along each axis, with the tiles and the coefficients within each tile in
+        // row major order.  A stencil then touches at most 2^dimension tiles, which in three dimensions are 4KB each
+        // for doubles, whereas in row major order its 16 lines along the last axis would lie in as many distant pages.
+        // The padding needed to fill the last tiles is zero and never read.
+        size_t tile_volume = 1;
+        for (size_t a = 0; a < dimension; ++a)
+        {
+            tile_volume *= tile;
+        }
+        std::array<size_t, dimension> tiles;
+        size_t tile_count = 1;
+        for (size_t a = 0; a < dimension; ++a)
+        {
+            tiles[a] = (e[a] + tile - 1)/tile;
+            tile_count *= tiles[a];
+        }
+        for (size_t a = dimension; a-- > 0;)
+        {
+            tile_stride_[a] = (a + 1 < dimension) ? tile_stride_[a + 1]*tiles[a + 1] : tile_volume;
+            in_tile_stride_[a] = (a + 1 < dimension) ? in_tile_stride_[a + 1]*tile : 1;
+        }
+        coefficients_.assign(tile_count*tile_volume, Real(0));
+        std::array<size_t, dimension> index{};
+        for (size_t j = 0; j < c.size(); ++j)
+        {
+            size_t k = 0;
+            for (size_t a = 0; a < dimension; ++a)
+            {
+                k += offset(a, index[a]);
+            }
+            coefficients_[k] = c[j];
+            // Advance the row major index:
+            for (size_t a = dimension; a-- > 0;)
+            {
+                if (++index[a] < e[a])
+                {
+                    break;
+                }
+                index[a] = 0;
+            }
+        }
+    }
+
+    Real operator()(const point_type& x) const
+    {
+        Real value;
+        evaluate<0>(x, value, nullptr, nullptr);
+        return value;
+    }
+
+    point_type gradient(const point_type& x) const
+    {
+        Real value;
+        point_type g;
+        evaluate<1>(x, value, &g, nullptr);
+        return g;
+    }
+
+    std::array<point_type, dimension> hessian(const point_type& x) const
+    {
+        Real value;
+        point_type g;
+        std::array<point_type, dimension> H;
+        evaluate<2>(x, value, &g, &H);
+        return H;
+    }
+
+    template<class PointContainer, class OutputContainer>
+    void evaluate(const PointContainer& x, OutputContainer& y) const
+    {
+        if (x.size() != y.size())
+        {
+            throw std::domain_error("There must be as many outputs as points.");
+        }
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            Real value;
+            evaluate<0>(x[i], value, nullptr, nullptr);
+            y[i] = value;
+        }
+    }
+
+    std::pair<point_type, point_type> domain() const
+    {
+        point_type upper;
+        for (size_t a = 0; a < dimension; ++a)
+        {
+            upper[a] = origin_[a] + (extents_[a] - 1)*spacing_[a];
+        }
+        return {origin_, upper};
+    }
+
+    int64_t bytes() const
+    {
+        return coefficients_.size()*sizeof(Real) + sizeof(*this);
+    }
+
+private:
+    size_t offset(size_t axis, size_t i) const
+    {
+        return (i/tile)*tile_stride_[axis] + (i % tile)*in_tile_stride_[axis];
+    }
+
+    template<unsigned order>
+    void evaluate(const point_type& x, Real& value, point_type* g, std::array<point_type, dimension>* H) const
+    {
+        using std::floor;
+        std::array<std::array<size_t, stencil>, dimension> off;
+        std::array<std::array<Real, stencil>, dimension> w;
+        std::array<std::array<Real, stencil>, dimension> dw;
+        std::array<std::array<Real, stencil>, dimension> d2w;
+        for (size_t a = 0; a < dimension; ++a)
+        {
+            Real n1 = static_cast<Real>(extents_[a] - 1);
+            if (!(x[a] >= origin_[a] && x[a] <= origin_[a] + n1*spacing_[a]))
+            {
+                std::ostringstream oss;
+                oss.precision(std::numeric_limits<Real>::digits10+3);
+                oss << "Requested abscissa x[" << a << "] = " << x[a] << ", which is outside of allowed range ["
+                    << origin_[a] << ", " << origin_[a] + n1*spacing_[a] << "]";
+                throw std::domain_error(oss.str());
+            }
+            // Rounding can put the ends of the domain slightly outside [0, n - 1]:
+            Real u = (x[a] - origin_[a])*inv_spacing_[a];
+            if (u > n1)
+            {
+                u = n1;
+            }
+            // The nonzero B-splines at x are those of the cell [j, j+1] containing u, and of the degree - 1 cells
+            // either side; the last cell includes its right end:
+            Real jj = floor(u);
+            if (jj > n1 - 1)
+            {
+                jj = n1 - 1;
+            }
+            size_t j = static_cast<size_t>(jj);
+            b_spline_stencil_weights<Real, degree, order>(u - jj, w[a], dw[a], d2w[a]);
+            for (size_t s = 0; s < stencil; ++s)
+            {
+                off[a][s] = offset(a, j + s);
+            }
+        }
+
+        const Real* c = coefficients_.data();
+        if constexpr (dimension == 2)
+        {
+            Real v = 0, g0 = 0, g1 = 0, h00 = 0, h01 = 0, h11 = 0;
+            for (size_t s0 = 0; s0 < stencil; ++s0)
+            {
+                const Real* row = c + off[0][s0];
+                Real r = 0, dr = 0, d2r = 0;
+                for (size_t s1 = 0; s1 < stencil; ++s1)
+                {
+                    Real ck = row[off[1][s1]];
+                    r += ck*w[1][s1];
+                    if constexpr (order >= 1)
+                    {
+                        dr += ck*dw[1][s1];
+                    }
+                    if constexpr (order >= 2)
+                    {
+                        d2r += ck*d2w[1][s1];
+                    }
+                }
+                v += w[0][s0]*r;
+                if constexpr (order >= 1)
+                {
+                    g0 += dw[0][s0]*r;
+                    g1 += w[0][s0]*dr;
+                }
+                if constexpr (order >= 2)
+                {
+                    h00 += d2w[0][s0]*r;
+                    h01 += dw[0][s0]*dr;
+                    h11 += w[0][s0]*d2r;
+                }
+            }
+            value = v;
+            if constexpr (order >= 1)
+            {
+                (*g)[0] = g0*inv_spacing_[0];
+                (*g)[1] = g1*inv_spacing_[1];
+            }
+            if constexpr (order >= 2)
+            {
+                (*H)[0][0] = h00*inv_spacing_[0]*inv_spacing_[0];
+                (*H)[0][1] = (*H)[1][0] = h01*inv_spacing_[0]*inv_spacing_[1];
+                (*H)[1][1] = h11*inv_spacing_[1]*inv_spacing_[1];
+            }
+        }
+        else
+        {
+            Real v = 0;
+            point_type gs{};
+            std::array<point_type, dimension> hs{};
+            for (size_t s0 = 0; s0 < stencil; ++s0)
+            {
+                // The contributions of the plane s0, and their derivatives along the second and third axes:
+                Real p = 0, p1 = 0, p2 = 0, p11 = 0, p12 = 0, p22 = 0;
+                for (size_t s1 = 0; s1 < stencil; ++s1)
+                {
+                    const Real* row = c + off[0][s0] + off[1][s1];
+                    Real r = 0, dr = 0, d2r = 0;
+                    for (size_t s2 = 0; s2 < stencil; ++s2)
+                    {
+                        Real ck = row[off[2][s2]];
+                        r += ck*w[2][s2];
+                        if constexpr (order >= 1)
+                        {
+                            dr += ck*dw[2][s2];
+                        }
+                        if constexpr (order >= 2)
+                        {
+                            d2r += ck*d2w[2][s2];
+                        }
+                    }
+                    p += w[1][s1]*r;
+                    if constexpr (order >= 1)
+                    {
+                        p1 += dw[1][s1]*r;
+                        p2 += w[1][s1]*dr;
+                    }
+                    if constexpr (order >= 2)
+                    {
+                        p11 += d2w[1][s1]*r;
+                        p12 += dw[1][s1]*dr;
+                        p22 += w[1][s1]*d2r;
+                    }
+                }
+                v += w[0][s0]*p;
+                if constexpr (order >= 1)
+                {
+                    gs[0] += dw[0][s0]*p;
+                    gs[1] += w[0][s0]*p1;
+                    gs[2] += w[0][s0]*p2;
+                }
+                if constexpr (order >= 2)
+                {
+                    hs[0][0] += d2w[0][s0]*p;
+                    hs[0][1] += dw[0][s0]*p1;
+                    hs[0][2] += dw[0][s0]*p2;
+                    hs[1][1] += w[0][s0]*p11;
+                    hs[1][2] += w[0][s0]*p12;
+                    hs[2][2] += w[0][s0]*p22;
+                }
+            }
+            value = v;
+            if constexpr (order >= 1)
+            {
+                for (size_t a = 0; a < dimension; ++a)
+                {
+                    (*g)[a] = gs[a]*inv_spacing_[a];
+                }
+            }
+            if constexpr (order >= 2)
+            {
+                for (size_t a = 0; a < dimension; ++a)
+                {
+                    for (size_t b = a; b < dimension; ++b)
+                    {
+                        (*H)[a][b] = (*H)[b][a] = hs[a][b]*inv_spacing_[a]*inv_spacing_[b];
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<Real> coefficients_;
+    std::array<size_t, dimension> extents_;
+    point_type origin_;
+    point_type spacing_;
+    point_type inv_spacing_;
+    std::array<size_t, dimension> tile_stride_;
+    std::array<size_t, dimension> in_tile_stride_;
+};
+
+}
+#endif
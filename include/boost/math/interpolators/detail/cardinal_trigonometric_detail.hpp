@@ -7,6 +7,7 @@
 #define BOOST_MATH_INTERPOLATORS_DETAIL_CARDINAL_TRIGONOMETRIC_HPP
 #include <cmath>
 #include <stdexcept>
+#include <vector>
 #include <fftw3.h>
 #include <boost/math/constants/constants.hpp>
 
@@ -48,6 +49,7 @@ public:
       throw std::logic_error("The step size must be > 0");
     }
     // The period sadly must be stored, since the complex vector has length that cannot be used to recover the period:
+    m_length = length;
     m_T = m_h*length;
     m_complex_vector_size = length/2 + 1;
     m_gamma = fftwf_alloc_complex(m_complex_vector_size);
@@ -182,6 +184,67 @@ public:
   }
 
 
+  // The interpolant (order = 0), or its first or second derivative, at t0 + j*h/factor for j = 0, 1, ..., factor*length - 1.
+  // The coefficients are zero padded and transformed back, which costs O(N log N) for all N = factor*length points.
+  std::vector<float> upsample(size_t factor, unsigned order) const
+  {
+    using boost::math::constants::two_pi;
+    if (factor == 0)
+    {
+      throw std::logic_error("The upsampling factor must be > 0");
+    }
+    if (order > 2)
+    {
+      throw std::logic_error("Only the first and second derivatives are supported.");
+    }
+    size_t N = factor*m_length;
+    size_t M = N/2 + 1;
+    std::vector<float> y(N);
+    fftwf_complex* c = fftwf_alloc_complex(M);
+    for (size_t k = 0; k < M; ++k)
+    {
+      c[k][0] = 0;
+      c[k][1] = 0;
+    }
+    float w = two_pi<float>()/m_T;
+    for (size_t k = 0; k < m_complex_vector_size; ++k)
+    {
+      float re = m_gamma[k][0];
+      float im = m_gamma[k][1];
+      if (order == 1)
+      {
+        float kw = k*w;
+        float tmp = re;
+        re = -kw*im;
+        im = kw*tmp;
+      }
+      else if (order == 2)
+      {
+        float kw2 = -(k*w)*(k*w);
+        re *= kw2;
+        im *= kw2;
+      }
+      // The inverse transform doubles the real part of every coefficient except the first and the Nyquist coefficient,
+      // which is only in range when factor = 1:
+      if (k > 0 && 2*k == N)
+      {
+        re *= 2;
+      }
+      c[k][0] = re;
+      c[k][1] = im;
+    }
+    fftwf_plan plan = fftwf_plan_dft_c2r_1d(N, c, y.data(), FFTW_ESTIMATE);
+    if (!plan)
+    {
+      fftwf_free(c);
+      throw std::logic_error("A null fftw plan was created.");
+    }
+    fftwf_execute(plan);
+    fftwf_destroy_plan(plan);
+    fftwf_free(c);
+    return y;
+  }
+
   ~cardinal_trigonometric_detail()
   {
     if (m_gamma)
@@ -196,6 +259,7 @@ private:
   float m_t0;
   float m_h;
   float m_T;
+  size_t m_length;
   fftwf_complex* m_gamma;
   size_t m_complex_vector_size;
 };
@@ -214,6 +278,7 @@ public:
     {
       throw std::logic_error("The step size must be > 0");
     }
+    m_length = length;
     m_T = m_h*length;
     m_complex_vector_size = length/2 + 1;
     m_gamma = fftw_alloc_complex(m_complex_vector_size);
@@ -341,6 +406,67 @@ public:
     return s*m_T;
   }
 
+  // The interpolant (order = 0), or its first or second derivative, at t0 + j*h/factor for j = 0, 1, ..., factor*length - 1.
+  // The coefficients are zero padded and transformed back, which costs O(N log N) for all N = factor*length points.
+  std::vector<double> upsample(size_t factor, unsigned order) const
+  {
+    using boost::math::constants::two_pi;
+    if (factor == 0)
+    {
+      throw std::logic_error("The upsampling factor must be > 0");
+    }
+    if (order > 2)
+    {
+      throw std::logic_error("Only the first and second derivatives are supported.");
+    }
+    size_t N = factor*m_length;
+    size_t M = N/2 + 1;
+    std::vector<double> y(N);
+    fftw_complex* c = fftw_alloc_complex(M);
+    for (size_t k = 0; k < M; ++k)
+    {
+      c[k][0] = 0;
+      c[k][1] = 0;
+    }
+    double w = two_pi<double>()/m_T;
+    for (size_t k = 0; k < m_complex_vector_size; ++k)
+    {
+      double re = m_gamma[k][0];
+      double im = m_gamma[k][1];
+      if (order == 1)
+      {
+        double kw = k*w;
+        double tmp = re;
+        re = -kw*im;
+        im = kw*tmp;
+      }
+      else if (order == 2)
+      {
+        double kw2 = -(k*w)*(k*w);
+        re *= kw2;
+        im *= kw2;
+      }
+      // The inverse transform doubles the real part of every coefficient except the first and the Nyquist coefficient,
+      // which is only in range when factor = 1:
+      if (k > 0 && 2*k == N)
+      {
+        re *= 2;
+      }
+      c[k][0] = re;
+      c[k][1] = im;
+    }
+    fftw_plan plan = fftw_plan_dft_c2r_1d(N, c, y.data(), FFTW_ESTIMATE);
+    if (!plan)
+    {
+      fftw_free(c);
+      throw std::logic_error("A null fftw plan was created.");
+    }
+    fftw_execute(plan);
+    fftw_destroy_plan(plan);
+    fftw_free(c);
+    return y;
+  }
+
   ~cardinal_trigonometric_detail()
   {
     if (m_gamma)
@@ -354,6 +480,7 @@ private:
   double m_t0;
   double m_h;
   double m_T;
+  size_t m_length;
   fftw_complex* m_gamma;
   size_t m_complex_vector_size;
 };
@@ -372,6 +499,7 @@ public:
     {
       throw std::logic_error("The step size must be > 0");
     }
+    m_length = length;
     m_T = m_h*length;
     m_complex_vector_size = length/2 + 1;
     m_gamma = fftwl_alloc_complex(m_complex_vector_size);
@@ -497,6 +625,67 @@ public:
     return s*m_T;
   }
 
+  // The interpolant (order = 0), or its first or second derivative, at t0 + j*h/factor for j = 0, 1, ..., factor*length - 1.
+  // The coefficients are zero padded and transformed back, which costs O(N log N) for all N = factor*length points.
+  std::vector<long double> upsample(size_t factor, unsigned order) const
+  {
+    using boost::math::constants::two_pi;
+    if (factor == 0)
+    {
+      throw std::logic_error("The upsampling factor must be > 0");
+    }
+    if (order > 2)
+    {
+      throw std::logic_error("Only the first and second derivatives are supported.");
+    }
+    size_t N = factor*m_length;
+    size_t M = N/2 + 1;
+    std::vector<long double> y(N);
+    fftwl_complex* c = fftwl_alloc_complex(M);
+    for (size_t k = 0; k < M; ++k)
+    {
+      c[k][0] = 0;
+      c[k][1] = 0;
+    }
+    long double w = two_pi<long double>()/m_T;
+    for (size_t k = 0; k < m_complex_vector_size; ++k)
+    {
+      long double re = m_gamma[k][0];
+      long double im = m_gamma[k][1];
+      if (order == 1)
+      {
+        long double kw = k*w;
+        long double tmp = re;
+        re = -kw*im;
+        im = kw*tmp;
+      }
+      else if (order == 2)
+      {
+        long double kw2 = -(k*w)*(k*w);
+        re *= kw2;
+        im *= kw2;
+      }
+      // The inverse transform doubles the real part of every coefficient except the first and the Nyquist coefficient,
+      // which is only in range when factor = 1:
+      if (k > 0 && 2*k == N)
+      {
+        re *= 2;
+      }
+      c[k][0] = re;
+      c[k][1] = im;
+    }
+    fftwl_plan plan = fftwl_plan_dft_c2r_1d(N, c, y.data(), FFTW_ESTIMATE);
+    if (!plan)
+    {
+      fftwl_free(c);
+      throw std::logic_error("A null fftw plan was created.");
+    }
+    fftwl_execute(plan);
+    fftwl_destroy_plan(plan);
+    fftwl_free(c);
+    return y;
+  }
+
   ~cardinal_trigonometric_detail()
   {
     if (m_gamma)
@@ -510,6 +699,7 @@ private:
   long double m_t0;
   long double m_h;
   long double m_T;
+  size_t m_length;
   fftwl_complex* m_gamma;
   size_t m_complex_vector_size;
 };
@@ -528,6 +718,7 @@ public:
     {
       throw std::logic_error("The step size must be > 0");
     }
+    m_length = length;
     m_T = m_h*length;
     m_complex_vector_size = length/2 + 1;
     m_gamma = fftwq_alloc_complex(m_complex_vector_size);
@@ -653,6 +844,67 @@ public:
     return s*m_T;
   }
 
+  // The interpolant (order = 0), or its first or second derivative, at t0 + j*h/factor for j = 0, 1, ..., factor*length - 1.
+  // The coefficients are zero padded and transformed back, which costs O(N log N) for all N = factor*length points.
+  std::vector<__float128> upsample(size_t factor, unsigned order) const
+  {
+    using boost::math::constants::two_pi;
+    if (factor == 0)
+    {
+      throw std::logic_error("The upsampling factor must be > 0");
+    }
+    if (order > 2)
+    {
+      throw std::logic_error("Only the first and second derivatives are supported.");
+    }
+    size_t N = factor*m_length;
+    size_t M = N/2 + 1;
+    std::vector<__float128> y(N);
+    fftwq_complex* c = fftwq_alloc_complex(M);
+    for (size_t k = 0; k < M; ++k)
+    {
+      c[k][0] = 0;
+      c[k][1] = 0;
+    }
+    __float128 w = two_pi<__float128>()/m_T;
+    for (size_t k = 0; k < m_complex_vector_size; ++k)
+    {
+      __float128 re = m_gamma[k][0];
+      __float128 im = m_gamma[k][1];
+      if (order == 1)
+      {
+        __float128 kw = k*w;
+        __float128 tmp = re;
+        re = -kw*im;
+        im = kw*tmp;
+      }
+      else if (order == 2)
+      {
+        __float128 kw2 = -(k*w)*(k*w);
+        re *= kw2;
+        im *= kw2;
+      }
+      // The inverse transform doubles the real part of every coefficient except the first and the Nyquist coefficient,
+      // which is only in range when factor = 1:
+      if (k > 0 && 2*k == N)
+      {
+        re *= 2;
+      }
+      c[k][0] = re;
+      c[k][1] = im;
+    }
+    fftwq_plan plan = fftwq_plan_dft_c2r_1d(N, c, y.data(), FFTW_ESTIMATE);
+    if (!plan)
+    {
+      fftwq_free(c);
+      throw std::logic_error("A null fftw plan was created.");
+    }
+    fftwq_execute(plan);
+    fftwq_destroy_plan(plan);
+    fftwq_free(c);
+    return y;
+  }
+
   ~cardinal_trigonometric_detail()
   {
     if (m_gamma)
@@ -667,6 +919,7 @@ private:
   __float128 m_t0;
   __float128 m_h;
   __float128 m_T;
+  size_t m_length;
   fftwq_complex* m_gamma;
   size_t m_complex_vector_size;
 };
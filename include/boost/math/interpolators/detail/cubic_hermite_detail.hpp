@@ -12,6 +12,8 @@
 #include <iostream>
 #include <sstream>
 #include <limits>
+#include <boost/math/interpolators/detail/interval_search.hpp>
+#include <boost/math/interpolators/detail/batch_evaluation.hpp>
 
 namespace boost::math::interpolators::detail {
 
@@ -64,74 +66,77 @@ public:
         x_.push_back(x);
         y_.push_back(y);
         dydx_.push_back(dydx);
+        index_.clear();
     }
 
     Real operator()(Real x) const
     {
-        if  (x < x_[0] || x > x_.back())
-        {
-            std::ostringstream oss;
-            oss.precision(std::numeric_limits<Real>::digits10+3);
-            oss << "Requested abscissa x = " << x << ", which is outside of allowed range ["
-                << x_[0] << ", " << x_.back() << "]";
-            throw std::domain_error(oss.str());
-        }
+        check_domain(x);
         // We need t := (x-x_k)/(x_{k+1}-x_k) \in [0,1) for this to work.
         // Sadly this neccessitates this loathesome check, otherwise we get t = 1 at x = xf.
         if (x == x_.back())
         {
             return y_.back();
         }
+        return unchecked_evaluation(x, segment(x));
+    }
 
-        auto it = std::upper_bound(x_.begin(), x_.end(), x);
-        auto i = std::distance(x_.begin(), it) -1;
-        Real x0 = *(it-1);
-        Real x1 = *it;
-        Real y0 = y_[i];
-        Real y1 = y_[i+1];
-        Real s0 = dydx_[i];
-        Real s1 = dydx_[i+1];
-        Real dx = (x1-x0);
-        Real t = (x-x0)/dx;
-
-        // See the section 'Representations' in the page
-        // https://en.wikipedia.org/wiki/Cubic_Hermite_spline
-        Real y = (1-t)*(1-t)*(y0*(1+2*t) + s0*(x-x0))
-              + t*t*(y1*(3-2*t) + dx*s1*(t-1));
-        return y;
+    Real operator()(Real x, interval_cursor& cursor) const
+    {
+        check_domain(x);
+        if (x == x_.back())
+        {
+            return y_.back();
+        }
+        return unchecked_evaluation(x, hinted_interval_search(x_, x, cursor.index));
     }
 
     Real prime(Real x) const
     {
-        if  (x < x_[0] || x > x_.back())
+        check_domain(x);
+        if (x == x_.back())
         {
-            std::ostringstream oss;
-            oss.precision(std::numeric_limits<Real>::digits10+3);
-            oss << "Requested abscissa x = " << x << ", which is outside of allowed range ["
-                << x_[0] << ", " << x_.back() << "]";
-            throw std::domain_error(oss.str());
+            return dydx_.back();
         }
+        return unchecked_prime(x, segment(x));
+    }
+
+    Real prime(Real x, interval_cursor& cursor) const
+    {
+        check_domain(x);
         if (x == x_.back())
         {
             return dydx_.back();
         }
-        auto it = std::upper_bound(x_.begin(), x_.end(), x);
-        auto i = std::distance(x_.begin(), it) -1;
-        Real x0 = *(it-1);
-        Real x1 = *it;
-        Real y0 = y_[i];
-        Real y1 = y_[i+1];
-        Real s0 = dydx_[i];
-        Real s1 = dydx_[i+1];
-        Real dx = (x1-x0);
+        return unchecked_prime(x, hinted_interval_search(x_, x, cursor.index));
+    }
 
-        Real d1 = (y1 - y0 - s0*dx)/(dx*dx);
-        Real d2 = (s1 - s0)/(2*dx);
-        Real c2 = 3*d1 - 2*d2;
-        Real c3 = 2*(d2 - d1)/dx;
-        return s0 + 2*c2*(x-x0) + 3*c3*(x-x0)*(x-x0); 
+    // y[j] = s(x[j]) for every j.  The intervals for a block of points are found first, walking from one to the
+    // next as a cursor does, so sorted x are cheapest; the polynomials are then evaluated in a loop free of searches.
+    template<class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& x, OutputContainer& y) const
+    {
+        batch_evaluate(x_, x, y, y_.back(), [this](Real t, size_t i) { return unchecked_evaluation(t, i); });
     }
 
+    template<class InputContainer, class OutputContainer>
+    void evaluate_prime(const InputContainer& x, OutputContainer& dydx) const
+    {
+        batch_evaluate(x_, x, dydx, dydx_.back(), [this](Real t, size_t i) { return unchecked_prime(t, i); });
+    }
+
+    // Speeds up the search for the interval containing x in calls which don't pass a cursor, at the cost of
+    // a second copy of the abscissas.  push_back discards the index.
+    void build_search_index()
+    {
+        index_.build(x_);
+    }
+
+    // For those who modify x_ directly:
+    void clear_search_index()
+    {
+        index_.clear();
+    }
 
     friend std::ostream& operator<<(std::ostream & os, const cubic_hermite_detail & m)
     {
@@ -152,7 +157,7 @@ public:
 
     int64_t bytes() const
     {
-        return 3*x_.size()*sizeof(Real) + 3*sizeof(x_);
+        return 3*x_.size()*sizeof(Real) + 3*sizeof(x_) + index_.bytes();
     }
 
     std::pair<Real, Real> domain() const
@@ -163,6 +168,68 @@ public:
     RandomAccessContainer x_;
     RandomAccessContainer y_;
     RandomAccessContainer dydx_;
+
+private:
+    void check_domain(Real x) const
+    {
+        if  (x < x_[0] || x > x_.back())
+        {
+            std::ostringstream oss;
+            oss.precision(std::numeric_limits<Real>::digits10+3);
+            oss << "Requested abscissa x = " << x << ", which is outside of allowed range ["
+                << x_[0] << ", " << x_.back() << "]";
+            throw std::domain_error(oss.str());
+        }
+    }
+
+    // The index i with x_[i] <= x < x_[i+1]:
+    size_t segment(Real x) const
+    {
+        if (!index_.empty())
+        {
+            size_t k = index_.upper_bound(x);
+            return k ? k - 1 : 0;
+        }
+        auto it = std::upper_bound(x_.begin(), x_.end(), x);
+        return std::distance(x_.begin(), it) - 1;
+    }
+
+    Real unchecked_evaluation(Real x, size_t i) const
+    {
+        Real x0 = x_[i];
+        Real x1 = x_[i+1];
+        Real y0 = y_[i];
+        Real y1 = y_[i+1];
+        Real s0 = dydx_[i];
+        Real s1 = dydx_[i+1];
+        Real dx = (x1-x0);
+        Real t = (x-x0)/dx;
+
+        // See the section 'Representations' in the page
+        // https://en.wikipedia.org/wiki/Cubic_Hermite_spline
+        Real y = (1-t)*(1-t)*(y0*(1+2*t) + s0*(x-x0))
+              + t*t*(y1*(3-2*t) + dx*s1*(t-1));
+        return y;
+    }
+
+    Real unchecked_prime(Real x, size_t i) const
+    {
+        Real x0 = x_[i];
+        Real x1 = x_[i+1];
+        Real y0 = y_[i];
+        Real y1 = y_[i+1];
+        Real s0 = dydx_[i];
+        Real s1 = dydx_[i+1];
+        Real dx = (x1-x0);
+
+        Real d1 = (y1 - y0 - s0*dx)/(dx*dx);
+        Real d2 = (s1 - s0)/(2*dx);
+        Real c2 = 3*d1 - 2*d2;
+        Real c3 = 2*(d2 - d1)/dx;
+        return s0 + 2*c2*(x-x0) + 3*c3*(x-x0)*(x-x0);
+    }
+
+    eytzinger_index<Real> index_;
 };
 
 template<class RandomAccessContainer>
@@ -267,6 +334,22 @@ public:
         return dy*inv_dx_;
     }
 
+    // y[j] = s(x[j]) for every j.  The whole batch is checked against the domain before any evaluation, so that the
+    // evaluation loop has no exits:
+    template<class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& x, OutputContainer& y) const
+    {
+        const Real xf = x0_ + (y_.size()-1)/inv_dx_;
+        cardinal_batch_evaluate(x, y, x0_, xf, this->operator()(xf), [this](Real t) { return unchecked_evaluation(t); });
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_prime(const InputContainer& x, OutputContainer& dydx) const
+    {
+        const Real xf = x0_ + (y_.size()-1)/inv_dx_;
+        cardinal_batch_evaluate(x, dydx, x0_, xf, this->prime(xf), [this](Real t) { return unchecked_prime(t); });
+    }
+
 
     auto size() const
     {
@@ -285,7 +368,6 @@ public:
     }
 
 private:
-
     RandomAccessContainer y_;
     RandomAccessContainer dy_;
     Real x0_;
@@ -401,6 +483,20 @@ public:
         return dy*inv_dx_;
     }
 
+    // y[j] = s(x[j]) for every j:
+    template<class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& x, OutputContainer& y) const
+    {
+        const Real xf = x0_ + (dat_.size()-1)/inv_dx_;
+        cardinal_batch_evaluate(x, y, x0_, xf, this->operator()(xf), [this](Real t) { return unchecked_evaluation(t); });
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_prime(const InputContainer& x, OutputContainer& dydx) const
+    {
+        const Real xf = x0_ + (dat_.size()-1)/inv_dx_;
+        cardinal_batch_evaluate(x, dydx, x0_, xf, this->prime(xf), [this](Real t) { return unchecked_prime(t); });
+    }
 
     auto size() const
     {
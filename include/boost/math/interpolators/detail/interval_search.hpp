@@ -0,0 +1,175 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_INTERPOLATORS_DETAIL_INTERVAL_SEARCH_HPP
+#define BOOST_MATH_INTERPOLATORS_DETAIL_INTERVAL_SEARCH_HPP
+#include <cstddef>
+#include <vector>
+
+namespace boost { namespace math { namespace interpolators {
+
+//
+// Remembers the interval found by the last evaluation of an interpolator which was passed this cursor, so that the
+// next search starts from there.  For sorted or nearly sorted queries each search is then O(1), and in general a
+// query d intervals away from the last one costs O(log d).  Each thread needs its own cursor.
+//
+struct interval_cursor
+{
+    // The index i of the last interval [x_i, x_{i+1}) found:
+    std::size_t index = 0;
+};
+
+namespace detail {
+
+//
+// The largest i with x[i] <= t, which is std::upper_bound(x.begin(), x.end(), t) - x.begin() - 1, given that x[0] <= t.
+// The search starts at hint, gallops away from it in steps of 1, 2, 4, ... until t is bracketed, and then bisects.
+// On return hint is the index found.
+//
+template<class RandomAccessContainer, class Real>
+std::size_t hinted_interval_search(const RandomAccessContainer& x, const Real& t, std::size_t& hint)
+{
+    std::size_t n = x.size();
+    std::size_t i = hint < n ? hint : n - 1;
+    // Maintain x[lo] <= t < x[hi], where hi == n stands for +infinity:
+    std::size_t lo;
+    std::size_t hi;
+    if (x[i] <= t)
+    {
+        // Most often t is in the same interval as last time:
+        if ((i + 1 == n) || (t < x[i + 1]))
+        {
+            hint = i;
+            return i;
+        }
+        lo = i + 1;
+        std::size_t step = 1;
+        hi = lo + step;
+        while ((hi < n) && (x[hi] <= t))
+        {
+            lo = hi;
+            step *= 2;
+            hi = lo + step;
+        }
+        if (hi > n)
+        {
+            hi = n;
+        }
+    }
+    else
+    {
+        hi = i;
+        std::size_t step = 1;
+        for (;;)
+        {
+            if (hi <= step)
+            {
+                lo = 0;
+                break;
+            }
+            lo = hi - step;
+            if (x[lo] <= t)
+            {
+                break;
+            }
+            hi = lo;
+            step *= 2;
+        }
+    }
+    while (hi - lo > 1)
+    {
+        std::size_t mid = lo + (hi - lo) / 2;
+        if (x[mid] <= t)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    hint = lo;
+    return lo;
+}
+
+//
+// A copy of the abscissas in Eytzinger (breadth first) order.  A binary search of this layout reads memory in an order
+// which the hardware prefetcher can follow, rather than jumping about the array as std::upper_bound does, and so is
+// several times faster once the abscissas no longer fit in cache.  The price is a second copy of the abscissas, plus
+// the position of each one in the original array.
+//
+template<class Real>
+class eytzinger_index
+{
+public:
+    template<class RandomAccessContainer>
+    void build(const RandomAccessContainer& x)
+    {
+        keys_.assign(x.size() + 1, Real(0));
+        rank_.assign(x.size() + 1, 0);
+        std::size_t i = 0;
+        fill(x, i, 1);
+    }
+
+    void clear()
+    {
+        keys_.clear();
+        rank_.clear();
+    }
+
+    bool empty() const
+    {
+        return keys_.empty();
+    }
+
+    // The number of abscissas <= t:
+    std::size_t upper_bound(const Real& t) const
+    {
+        std::size_t n = keys_.size() - 1;
+        std::size_t k = 1;
+        while (k <= n)
+        {
+            k = 2 * k + (keys_[k] <= t ? 1 : 0);
+        }
+        // Each trailing one bit of k is a step right; removing them and one more bit leaves the
+        // position of the last step left, which was at the first key > t:
+        while (k & 1)
+        {
+            k >>= 1;
+        }
+        k >>= 1;
+        return k == 0 ? n : rank_[k];
+    }
+
+    std::size_t bytes() const
+    {
+        return keys_.size() * sizeof(Real) + rank_.size() * sizeof(std::size_t);
+    }
+
+private:
+    // An in-order traversal of the implicit tree visits the positions k in the order of the sorted keys:
+    template<class RandomAccessContainer>
+    void fill(const RandomAccessContainer& x, std::size_t& i, std::size_t k)
+    {
+        if (k < keys_.size())
+        {
+            fill(x, i, 2 * k);
+            keys_[k] = x[i];
+            rank_[k] = i;
+            ++i;
+            fill(x, i, 2 * k + 1);
+        }
+    }
+
+    // 1-based, so that the children of position k are at 2k and 2k + 1:
+    std::vector<Real> keys_;
+    std::vector<std::size_t> rank_;
+};
+
+} // namespace detail
+
+}}} // namespaces
+#endif
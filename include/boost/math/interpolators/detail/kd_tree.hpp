@@ -0,0 +1,178 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_INTERPOLATORS_DETAIL_KD_TREE_HPP
+#define BOOST_MATH_INTERPOLATORS_DETAIL_KD_TREE_HPP
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace boost::math::interpolators::detail {
+
+//
+// A static k-d tree over a set of points, for finding all the points within a given distance of a query.
+//
+// The tree is implicit: the points are permuted so that each subtree occupies a contiguous range [lo, hi), with the
+// splitting point of the range at its midpoint, the points below the split to its left and those above to its right.
+// The split is along the axis on which the points of the range are most spread out.  The coordinates are stored in
+// this order, so that nearby points are nearby in memory, and the tree needs no other storage than the axis of each split.
+//
+template<class Real>
+class kd_tree
+{
+public:
+    kd_tree() = default;
+
+    template<class PointContainer>
+    explicit kd_tree(const PointContainer& points)
+    {
+        size_t n = points.size();
+        dimension_ = n > 0 ? points[0].size() : 0;
+        perm_.resize(n);
+        std::iota(perm_.begin(), perm_.end(), size_t(0));
+        split_.assign(n, 0);
+        build(points, 0, n);
+        coordinates_.resize(n*dimension_);
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (size_t a = 0; a < dimension_; ++a)
+            {
+                coordinates_[i*dimension_ + a] = points[perm_[i]][a];
+            }
+        }
+    }
+
+    size_t size() const
+    {
+        return perm_.size();
+    }
+
+    size_t dimension() const
+    {
+        return dimension_;
+    }
+
+    // The coordinates of the ith point in tree order:
+    const Real* point(size_t i) const
+    {
+        return coordinates_.data() + i*dimension_;
+    }
+
+    // The position in the original container of the ith point in tree order:
+    size_t original_index(size_t i) const
+    {
+        return perm_[i];
+    }
+
+    // Calls f(i, r2) for each point i, in tree order, whose squared distance r2 from x is at most radius^2:
+    template<class Point, class F>
+    void for_each_within(const Point& x, Real radius, F f) const
+    {
+        if (!perm_.empty())
+        {
+            search(x, radius*radius, 0, perm_.size(), f);
+        }
+    }
+
+    size_t bytes() const
+    {
+        return coordinates_.size()*sizeof(Real) + perm_.size()*sizeof(size_t) + split_.size()*sizeof(unsigned);
+    }
+
+private:
+    // Below this many points, a range is searched exhaustively:
+    static constexpr size_t leaf_size = 8;
+
+    template<class PointContainer>
+    void build(const PointContainer& points, size_t lo, size_t hi)
+    {
+        while (hi - lo > leaf_size)
+        {
+            unsigned axis = 0;
+            Real widest = -1;
+            for (size_t a = 0; a < dimension_; ++a)
+            {
+                Real lower = points[perm_[lo]][a];
+                Real upper = lower;
+                for (size_t i = lo + 1; i < hi; ++i)
+                {
+                    Real t = points[perm_[i]][a];
+                    lower = (std::min)(lower, t);
+                    upper = (std::max)(upper, t);
+                }
+                if (upper - lower > widest)
+                {
+                    widest = upper - lower;
+                    axis = static_cast<unsigned>(a);
+                }
+            }
+            size_t mid = lo + (hi - lo)/2;
+            std::nth_element(perm_.begin() + lo, perm_.begin() + mid, perm_.begin() + hi,
+                             [&](size_t i, size_t j) { return points[i][axis] < points[j][axis]; });
+            split_[mid] = axis;
+            build(points, lo, mid);
+            lo = mid + 1;
+        }
+    }
+
+    template<class Point, class F>
+    void search(const Point& x, Real r2, size_t lo, size_t hi, F& f) const
+    {
+        while (hi - lo > leaf_size)
+        {
+            size_t mid = lo + (hi - lo)/2;
+            visit(x, r2, mid, f);
+            Real d = x[split_[mid]] - coordinates_[mid*dimension_ + split_[mid]];
+            if (d < 0)
+            {
+                search(x, r2, lo, mid, f);
+                if (d*d > r2)
+                {
+                    return;
+                }
+                lo = mid + 1;
+            }
+            else
+            {
+                if (d*d <= r2)
+                {
+                    search(x, r2, lo, mid, f);
+                }
+                lo = mid + 1;
+            }
+        }
+        for (size_t i = lo; i < hi; ++i)
+        {
+            visit(x, r2, i, f);
+        }
+    }
+
+    template<class Point, class F>
+    void visit(const Point& x, Real r2, size_t i, F& f) const
+    {
+        const Real* p = coordinates_.data() + i*dimension_;
+        Real s = 0;
+        for (size_t a = 0; a < dimension_; ++a)
+        {
+            Real d = x[a] - p[a];
+            s += d*d;
+        }
+        if (s <= r2)
+        {
+            f(i, s);
+        }
+    }
+
+    size_t dimension_ = 0;
+    std::vector<size_t> perm_;
+    // The splitting axis of the range whose midpoint is i:
+    std::vector<unsigned> split_;
+    std::vector<Real> coordinates_;
+};
+
+}
+#endif
@@ -0,0 +1,117 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_INTERPOLATORS_DETAIL_LINEAR_RECURRENCE_HPP
+#define BOOST_MATH_INTERPOLATORS_DETAIL_LINEAR_RECURRENCE_HPP
+#include <cstddef>
+#include <vector>
+#include <future>
+
+namespace boost{ namespace math{ namespace interpolators{ namespace detail{
+
+//
+// Runs the first order recurrence x[i] = step(i, x[i], x[i - d]) for i = first, first + d, ..., stopping before last,
+// where d is +1 or -1 according as first < last or first > last.  On entry x[i] holds the data of row i, and
+// x[first - d] the value the recurrence starts from.  step must be affine in its last argument, and step(i, 0, p)
+// must be its homogeneous part; these are the forward and back substitutions of a factored tridiagonal system.
+//
+// With more than one thread the indices are split into contiguous blocks, each block is solved as though it started
+// from zero, the true starting values are passed from each block to the next, and each block is then corrected by its
+// homogeneous solution times its starting value.  For diagonally dominant systems the homogeneous solution decays
+// geometrically, and the correction stops once it has underflowed, so the parallel solve does little more work than
+// the serial one.  The result differs from the serial solve only by rounding.
+//
+template<class Real, class Step>
+void linear_recurrence(Real* x, std::ptrdiff_t first, std::ptrdiff_t last, Step step, unsigned threads = 1)
+{
+    const std::ptrdiff_t d = first < last ? 1 : -1;
+    const std::size_t length = static_cast<std::size_t>(d*(last - first));
+    // Below this, the cost of starting a thread exceeds the cost of the solve:
+    const std::size_t min_block = 8192;
+    std::size_t blocks = threads;
+    if (blocks > length/min_block)
+    {
+        blocks = length/min_block;
+    }
+    if (blocks < 2)
+    {
+        Real prev = x[first - d];
+        for (std::ptrdiff_t i = first; i != last; i += d)
+        {
+            prev = x[i] = step(i, x[i], prev);
+        }
+        return;
+    }
+
+    std::vector<std::ptrdiff_t> boundary(blocks + 1);
+    for (std::size_t k = 0; k <= blocks; ++k)
+    {
+        boundary[k] = first + d*static_cast<std::ptrdiff_t>(k*length/blocks);
+    }
+    // The value at the end of each block, and the homogeneous solution there, as though the block started from zero:
+    std::vector<Real> end_value(blocks);
+    std::vector<Real> decay(blocks);
+    auto solve_block = [&](std::size_t k)
+    {
+        Real prev = (k == 0) ? x[first - d] : Real(0);
+        for (std::ptrdiff_t i = boundary[k]; i != boundary[k + 1]; i += d)
+        {
+            prev = x[i] = step(i, x[i], prev);
+        }
+        end_value[k] = prev;
+        Real h = 1;
+        for (std::ptrdiff_t i = boundary[k]; (i != boundary[k + 1]) && (h != 0); i += d)
+        {
+            h = step(i, Real(0), h);
+        }
+        decay[k] = h;
+    };
+    std::vector<std::future<void>> futures;
+    for (std::size_t k = 1; k < blocks; ++k)
+    {
+        futures.push_back(std::async(std::launch::async, solve_block, k));
+    }
+    solve_block(0);
+    for (auto& f : futures)
+    {
+        f.get();
+    }
+
+    std::vector<Real> start(blocks);
+    Real carry = end_value[0];
+    for (std::size_t k = 1; k < blocks; ++k)
+    {
+        start[k] = carry;
+        carry = end_value[k] + decay[k]*carry;
+    }
+
+    auto correct_block = [&](std::size_t k)
+    {
+        Real h = 1;
+        for (std::ptrdiff_t i = boundary[k]; i != boundary[k + 1]; i += d)
+        {
+            h = step(i, Real(0), h);
+            if (h == 0)
+            {
+                break;
+            }
+            x[i] += h*start[k];
+        }
+    };
+    futures.clear();
+    for (std::size_t k = 2; k < blocks; ++k)
+    {
+        futures.push_back(std::async(std::launch::async, correct_block, k));
+    }
+    correct_block(1);
+    for (auto& f : futures)
+    {
+        f.get();
+    }
+}
+
+}}}}
+#endif
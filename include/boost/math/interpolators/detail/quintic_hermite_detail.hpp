@@ -10,6 +10,8 @@
 #include <stdexcept>
 #include <sstream>
 #include <cmath>
+#include <boost/math/interpolators/detail/interval_search.hpp>
+#include <boost/math/interpolators/detail/batch_evaluation.hpp>
 
 namespace boost::math::interpolators::detail {
 
@@ -59,9 +61,121 @@ public:
         y_.push_back(y);
         dydx_.push_back(dydx);
         d2ydx2_.push_back(d2ydx2);
+        index_.clear();
     }
 
     inline Real operator()(Real x) const
+    {
+        check_domain(x);
+        // We need t := (x-x_k)/(x_{k+1}-x_k) \in [0,1) for this to work.
+        // Sadly this neccessitates this loathesome check, otherwise we get t = 1 at x = xf.
+        if (x == x_.back())
+        {
+            return y_.back();
+        }
+        return unchecked_evaluation(x, segment(x));
+    }
+
+    inline Real operator()(Real x, interval_cursor& cursor) const
+    {
+        check_domain(x);
+        if (x == x_.back())
+        {
+            return y_.back();
+        }
+        return unchecked_evaluation(x, hinted_interval_search(x_, x, cursor.index));
+    }
+
+    inline Real prime(Real x) const
+    {
+        check_domain(x);
+        if (x == x_.back())
+        {
+            return dydx_.back();
+        }
+        return unchecked_prime(x, segment(x));
+    }
+
+    inline Real prime(Real x, interval_cursor& cursor) const
+    {
+        check_domain(x);
+        if (x == x_.back())
+        {
+            return dydx_.back();
+        }
+        return unchecked_prime(x, hinted_interval_search(x_, x, cursor.index));
+    }
+
+    inline Real double_prime(Real x) const
+    {
+        check_domain(x);
+        if (x == x_.back())
+        {
+            return d2ydx2_.back();
+        }
+        return unchecked_double_prime(x, segment(x));
+    }
+
+    inline Real double_prime(Real x, interval_cursor& cursor) const
+    {
+        check_domain(x);
+        if (x == x_.back())
+        {
+            return d2ydx2_.back();
+        }
+        return unchecked_double_prime(x, hinted_interval_search(x_, x, cursor.index));
+    }
+
+    // y[j] = s(x[j]) for every j.  The intervals for a block of points are found first, walking from one to the
+    // next as a cursor does, so sorted x are cheapest; the polynomials are then evaluated in a loop free of searches.
+    template<class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& x, OutputContainer& y) const
+    {
+        batch_evaluate(x_, x, y, y_.back(), [this](Real t, size_t i) { return unchecked_evaluation(t, i); });
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_prime(const InputContainer& x, OutputContainer& dydx) const
+    {
+        batch_evaluate(x_, x, dydx, dydx_.back(), [this](Real t, size_t i) { return unchecked_prime(t, i); });
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_double_prime(const InputContainer& x, OutputContainer& d2ydx2) const
+    {
+        batch_evaluate(x_, x, d2ydx2, d2ydx2_.back(), [this](Real t, size_t i) { return unchecked_double_prime(t, i); });
+    }
+
+    // Speeds up the search for the interval containing x in calls which don't pass a cursor, at the cost of
+    // a second copy of the abscissas.  push_back discards the index.
+    void build_search_index()
+    {
+        index_.build(x_);
+    }
+
+    friend std::ostream& operator<<(std::ostream & os, const quintic_hermite_detail & m)
+    {
+        os << "(x,y,y') = {";
+        for (size_t i = 0; i < m.x_.size() - 1; ++i) {
+            os << "(" << m.x_[i] << ", " << m.y_[i] << ", " << m.dydx_[i] << ", " << m.d2ydx2_[i] << "),  ";
+        }
+        auto n = m.x_.size()-1;
+        os << "(" << m.x_[n] << ", " << m.y_[n] << ", " << m.dydx_[n] << ", " << m.d2ydx2_[n] << ")}";
+        return os;
+    }
+
+    int64_t bytes() const
+    {
+        return 4*x_.size()*sizeof(x_) + index_.bytes();
+    }
+
+    std::pair<Real, Real> domain() const
+    {
+        return {x_.front(), x_.back()};
+    }
+
+private:
+    void check_domain(Real x) const
     {
         if  (x < x_[0] || x > x_.back())
         {
@@ -71,17 +185,24 @@ public:
                 << x_[0] << ", " << x_.back() << "]";
             throw std::domain_error(oss.str());
         }
-        // We need t := (x-x_k)/(x_{k+1}-x_k) \in [0,1) for this to work.
-        // Sadly this neccessitates this loathesome check, otherwise we get t = 1 at x = xf.
-        if (x == x_.back())
+    }
+
+    // The index i with x_[i] <= x < x_[i+1]:
+    size_t segment(Real x) const
+    {
+        if (!index_.empty())
         {
-            return y_.back();
+            size_t k = index_.upper_bound(x);
+            return k ? k - 1 : 0;
         }
-
         auto it = std::upper_bound(x_.begin(), x_.end(), x);
-        auto i = std::distance(x_.begin(), it) -1;
-        Real x0 = *(it-1);
-        Real x1 = *it;
+        return std::distance(x_.begin(), it) - 1;
+    }
+
+    Real unchecked_evaluation(Real x, size_t i) const
+    {
+        Real x0 = x_[i];
+        Real x1 = x_[i+1];
         Real y0 = y_[i];
         Real y1 = y_[i+1];
         Real v0 = dydx_[i];
@@ -104,25 +225,10 @@ public:
         return y;
     }
 
-    inline Real prime(Real x) const
+    Real unchecked_prime(Real x, size_t i) const
     {
-        if  (x < x_[0] || x > x_.back())
-        {
-            std::ostringstream oss;
-            oss.precision(std::numeric_limits<Real>::digits10+3);
-            oss << "Requested abscissa x = " << x << ", which is outside of allowed range ["
-                << x_[0] << ", " << x_.back() << "]";
-            throw std::domain_error(oss.str());
-        }
-        if (x == x_.back())
-        {
-            return dydx_.back();
-        }
-
-        auto it = std::upper_bound(x_.begin(), x_.end(), x);
-        auto i = std::distance(x_.begin(), it) -1;
-        Real x0 = *(it-1);
-        Real x1 = *it;
+        Real x0 = x_[i];
+        Real x1 = x_[i+1];
         Real dx = x1 - x0;
 
         Real y0 = y_[i];
@@ -140,25 +246,10 @@ public:
         return dydx;
     }
 
-    inline Real double_prime(Real x) const
+    Real unchecked_double_prime(Real x, size_t i) const
     {
-        if  (x < x_[0] || x > x_.back())
-        {
-            std::ostringstream oss;
-            oss.precision(std::numeric_limits<Real>::digits10+3);
-            oss << "Requested abscissa x = " << x << ", which is outside of allowed range ["
-                << x_[0] << ", " << x_.back() << "]";
-            throw std::domain_error(oss.str());
-        }
-        if (x == x_.back())
-        {
-            return d2ydx2_.back();
-        }
-
-        auto it = std::upper_bound(x_.begin(), x_.end(), x);
-        auto i = std::distance(x_.begin(), it) -1;
-        Real x0 = *(it-1);
-        Real x1 = *it;
+        Real x0 = x_[i];
+        Real x1 = x_[i+1];
         Real dx = x1 - x0;
 
         Real y0 = y_[i];
@@ -178,32 +269,11 @@ public:
         return d2ydx2;
     }
 
-    friend std::ostream& operator<<(std::ostream & os, const quintic_hermite_detail & m)
-    {
-        os << "(x,y,y') = {";
-        for (size_t i = 0; i < m.x_.size() - 1; ++i) {
-            os << "(" << m.x_[i] << ", " << m.y_[i] << ", " << m.dydx_[i] << ", " << m.d2ydx2_[i] << "),  ";
-        }
-        auto n = m.x_.size()-1;
-        os << "(" << m.x_[n] << ", " << m.y_[n] << ", " << m.dydx_[n] << ", " << m.d2ydx2_[n] << ")}";
-        return os;
-    }
-
-    int64_t bytes() const
-    {
-        return 4*x_.size()*sizeof(x_);
-    }
-
-    std::pair<Real, Real> domain() const
-    {
-        return {x_.front(), x_.back()};
-    }
-
-private:
     RandomAccessContainer x_;
     RandomAccessContainer y_;
     RandomAccessContainer dydx_;
     RandomAccessContainer d2ydx2_;
+    eytzinger_index<Real> index_;
 };
 
 
@@ -376,6 +446,29 @@ public:
         return d2ydx2;
     }
 
+    // y[j] = s(x[j]) for every j.  The whole batch is checked against the domain before any evaluation, so that the
+    // evaluation loop has no exits:
+    template<class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& x, OutputContainer& y) const
+    {
+        const Real xf = x0_ + (y_.size()-1)/inv_dx_;
+        cardinal_batch_evaluate(x, y, x0_, xf, this->operator()(xf), [this](Real t) { return unchecked_evaluation(t); });
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_prime(const InputContainer& x, OutputContainer& dydx) const
+    {
+        const Real xf = x0_ + (y_.size()-1)/inv_dx_;
+        cardinal_batch_evaluate(x, dydx, x0_, xf, this->prime(xf), [this](Real t) { return unchecked_prime(t); });
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_double_prime(const InputContainer& x, OutputContainer& d2ydx2) const
+    {
+        const Real xf = x0_ + (y_.size()-1)/inv_dx_;
+        cardinal_batch_evaluate(x, d2ydx2, x0_, xf, this->double_prime(xf), [this](Real t) { return unchecked_double_prime(t); });
+    }
+
     int64_t bytes() const
     {
         return 3*y_.size()*sizeof(Real) + 2*sizeof(Real);
@@ -557,6 +650,28 @@ public:
         return d2ydx2;
     }
 
+    // y[j] = s(x[j]) for every j:
+    template<class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& x, OutputContainer& y) const
+    {
+        const Real xf = x0_ + (data_.size()-1)/inv_dx_;
+        cardinal_batch_evaluate(x, y, x0_, xf, this->operator()(xf), [this](Real t) { return unchecked_evaluation(t); });
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_prime(const InputContainer& x, OutputContainer& dydx) const
+    {
+        const Real xf = x0_ + (data_.size()-1)/inv_dx_;
+        cardinal_batch_evaluate(x, dydx, x0_, xf, this->prime(xf), [this](Real t) { return unchecked_prime(t); });
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_double_prime(const InputContainer& x, OutputContainer& d2ydx2) const
+    {
+        const Real xf = x0_ + (data_.size()-1)/inv_dx_;
+        cardinal_batch_evaluate(x, d2ydx2, x0_, xf, this->double_prime(xf), [this](Real t) { return unchecked_double_prime(t); });
+    }
+
     int64_t bytes() const
     {
         return data_.size()*data_[0].size()*sizeof(Real) + 2*sizeof(Real);
@@ -0,0 +1,380 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_INTERPOLATORS_DETAIL_RADIAL_BASIS_FUNCTION_DETAIL_HPP
+#define BOOST_MATH_INTERPOLATORS_DETAIL_RADIAL_BASIS_FUNCTION_DETAIL_HPP
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/interpolators/detail/kd_tree.hpp>
+
+namespace boost::math::interpolators::detail {
+
+//
+// Solves Ax = b by Gaussian elimination with partial pivoting, where A is n x n in row major order.
+// A and b are overwritten, and on return b holds x.  Returns false if A is singular.
+//
+template<class Real>
+bool dense_solve(std::vector<Real>& A, std::vector<Real>& b, size_t n)
+{
+    using std::abs;
+    for (size_t k = 0; k < n; ++k)
+    {
+        size_t pivot = k;
+        for (size_t i = k + 1; i < n; ++i)
+        {
+            if (abs(A[i*n + k]) > abs(A[pivot*n + k]))
+            {
+                pivot = i;
+            }
+        }
+        if (A[pivot*n + k] == 0)
+        {
+            return false;
+        }
+        if (pivot != k)
+        {
+            std::swap_ranges(A.begin() + k*n, A.begin() + (k + 1)*n, A.begin() + pivot*n);
+            std::swap(b[k], b[pivot]);
+        }
+        Real inv = 1/A[k*n + k];
+        for (size_t i = k + 1; i < n; ++i)
+        {
+            Real m = A[i*n + k]*inv;
+            if (m != 0)
+            {
+                Real* row = A.data() + i*n;
+                const Real* pivot_row = A.data() + k*n;
+                for (size_t j = k + 1; j < n; ++j)
+                {
+                    row[j] -= m*pivot_row[j];
+                }
+                b[i] -= m*b[k];
+            }
+        }
+    }
+    for (size_t k = n; k-- > 0;)
+    {
+        Real s = b[k];
+        for (size_t j = k + 1; j < n; ++j)
+        {
+            s -= A[k*n + j]*b[j];
+        }
+        b[k] = s/A[k*n + k];
+    }
+    return true;
+}
+
+//
+// Solves Ax = b by the conjugate gradient method, where A is symmetric positive definite and stored in compressed
+// sparse row format, with the columns of each row in increasing order and every row containing its diagonal element.  The iteration is preconditioned by a symmetric
+// Gauss-Seidel sweep, which for interpolation matrices whose rows are ordered by a k-d tree cuts the number of
+// iterations several fold.  The iteration stops once the residual is a small multiple of the rounding error in b.
+//
+template<class Real>
+void sparse_conjugate_gradient(const std::vector<size_t>& row_start, const std::vector<size_t>& column,
+                               const std::vector<Real>& value, const std::vector<Real>& b, std::vector<Real>& x)
+{
+    using std::sqrt;
+    size_t n = b.size();
+    // The position of the diagonal element of each row, which separates L from U:
+    std::vector<size_t> diagonal(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        diagonal[i] = std::lower_bound(column.begin() + row_start[i], column.begin() + row_start[i + 1], i) - column.begin();
+    }
+    // z = M^-1 r, where M = (D + L) D^-1 (D + U):
+    auto precondition = [&](const std::vector<Real>& r, std::vector<Real>& z)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            Real s = r[i];
+            for (size_t j = row_start[i]; j < diagonal[i]; ++j)
+            {
+                s -= value[j]*z[column[j]];
+            }
+            z[i] = s/value[diagonal[i]];
+        }
+        for (size_t i = n; i-- > 0;)
+        {
+            Real s = 0;
+            for (size_t j = diagonal[i] + 1; j < row_start[i + 1]; ++j)
+            {
+                s += value[j]*z[column[j]];
+            }
+            z[i] -= s/value[diagonal[i]];
+        }
+    };
+
+    x.assign(n, Real(0));
+    std::vector<Real> r = b;
+    std::vector<Real> z(n);
+    precondition(r, z);
+    std::vector<Real> p = z;
+    std::vector<Real> Ap(n);
+    Real rr = 0;
+    Real rz = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        rr += r[i]*r[i];
+        rz += r[i]*z[i];
+    }
+    Real tol = 16*std::numeric_limits<Real>::epsilon();
+    tol *= tol*rr;
+    // In exact arithmetic the iteration terminates in n steps; allow for rounding:
+    size_t max_iterations = 2*n + 100;
+    for (size_t k = 0; (k < max_iterations) && (rr > tol); ++k)
+    {
+        Real pAp = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            Real s = 0;
+            for (size_t j = row_start[i]; j < row_start[i + 1]; ++j)
+            {
+                s += value[j]*p[column[j]];
+            }
+            Ap[i] = s;
+            pAp += p[i]*s;
+        }
+        Real alpha = rz/pAp;
+        rr = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            x[i] += alpha*p[i];
+            r[i] -= alpha*Ap[i];
+            rr += r[i]*r[i];
+        }
+        precondition(r, z);
+        Real rz_next = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            rz_next += r[i]*z[i];
+        }
+        Real beta = rz_next/rz;
+        rz = rz_next;
+        for (size_t i = 0; i < n; ++i)
+        {
+            p[i] = z[i] + beta*p[i];
+        }
+    }
+    if (!(rr <= tol))
+    {
+        std::ostringstream oss;
+        oss << "The conjugate gradient iteration failed to converge; the residual is " << sqrt(rr) << ". Are there repeated points?";
+        throw std::domain_error(oss.str());
+    }
+}
+
+// The largest dimension in which the kernel is (conditionally) positive definite, if it declares one:
+template<class Kernel, class = void>
+struct kernel_max_dimension
+{
+    static constexpr size_t value = (std::numeric_limits<size_t>::max)();
+};
+
+template<class Kernel>
+struct kernel_max_dimension<Kernel, std::void_t<decltype(Kernel::max_dimension)>>
+{
+    static constexpr size_t value = Kernel::max_dimension;
+};
+
+template<class Real, class Kernel>
+class radial_basis_function_detail
+{
+public:
+    template<class PointContainer>
+    radial_basis_function_detail(const PointContainer& points, const std::vector<Real>& values, Kernel kernel)
+        : kernel_{kernel}
+    {
+        using std::isfinite;
+        size_t n = points.size();
+        if (n == 0)
+        {
+            throw std::domain_error("At least one point is required.");
+        }
+        if (values.size() != n)
+        {
+            std::ostringstream oss;
+            oss << "There are " << n << " points, but " << values.size() << " values.";
+            throw std::domain_error(oss.str());
+        }
+        size_t d = points[0].size();
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (points[i].size() != d)
+            {
+                throw std::domain_error("All points must have the same dimension.");
+            }
+        }
+        if (d > kernel_max_dimension<Kernel>::value)
+        {
+            std::ostringstream oss;
+            oss << "The kernel is only positive definite in up to " << kernel_max_dimension<Kernel>::value
+                << " dimensions, but the points are in " << d << " dimensions.";
+            throw std::domain_error(oss.str());
+        }
+        tree_ = kd_tree<Real>(points);
+        std::vector<Real> f(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            f[i] = values[tree_.original_index(i)];
+        }
+
+        Real support = kernel_.support();
+        compact_ = isfinite(support);
+        if (compact_)
+        {
+            // The interpolation matrix is sparse, and since the kernel is positive definite, so is the matrix.
+            // Each row is built from a search of the tree, and is symmetric since distance is.
+            std::vector<size_t> row_start(n + 1, 0);
+            std::vector<size_t> column;
+            std::vector<Real> value;
+            std::vector<std::pair<size_t, Real>> row;
+            for (size_t i = 0; i < n; ++i)
+            {
+                row.clear();
+                tree_.for_each_within(tree_.point(i), support, [&](size_t j, Real r2) {
+                    using std::sqrt;
+                    Real phi = kernel_(sqrt(r2));
+                    if (phi != 0 || j == i)
+                    {
+                        row.emplace_back(j, phi);
+                    }
+                });
+                std::sort(row.begin(), row.end());
+                for (auto const & [j, phi] : row)
+                {
+                    column.push_back(j);
+                    value.push_back(phi);
+                }
+                row_start[i + 1] = column.size();
+            }
+            sparse_conjugate_gradient(row_start, column, value, f, weights_);
+            return;
+        }
+
+        // A kernel of global support which is only conditionally positive (or negative) definite needs a polynomial term,
+        // along with the condition that the weights annihilate polynomials of that degree.  The system is dense:
+        //
+        //   [ A   P ] [w]   [f]
+        //   [ P^T 0 ] [c] = [0]
+        //
+        // The polynomial is in coordinates relative to the centroid of the points, to keep P well scaled.
+        size_t m = 0;
+        if constexpr (Kernel::polynomial_degree >= 0)
+        {
+            m = (Kernel::polynomial_degree == 0) ? 1 : d + 1;
+            static_assert(Kernel::polynomial_degree <= 1, "Polynomial terms of degree at most one are supported.");
+        }
+        centroid_.assign(d, Real(0));
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (size_t a = 0; a < d; ++a)
+            {
+                centroid_[a] += tree_.point(i)[a];
+            }
+        }
+        for (size_t a = 0; a < d; ++a)
+        {
+            centroid_[a] /= n;
+        }
+        size_t N = n + m;
+        std::vector<Real> A(N*N, Real(0));
+        for (size_t i = 0; i < n; ++i)
+        {
+            const Real* xi = tree_.point(i);
+            for (size_t j = 0; j <= i; ++j)
+            {
+                A[i*N + j] = A[j*N + i] = kernel_(distance(xi, tree_.point(j)));
+            }
+            if (m > 0)
+            {
+                A[i*N + n] = A[n*N + i] = 1;
+                for (size_t a = 0; a + 1 < m; ++a)
+                {
+                    A[i*N + n + 1 + a] = A[(n + 1 + a)*N + i] = xi[a] - centroid_[a];
+                }
+            }
+        }
+        f.resize(N, Real(0));
+        if (!dense_solve(A, f, N))
+        {
+            throw std::domain_error("The interpolation system is singular. Are there repeated points, or too few points in general position for the polynomial term?");
+        }
+        polynomial_.assign(f.begin() + n, f.end());
+        f.resize(n);
+        weights_ = std::move(f);
+    }
+
+    template<class Point>
+    Real operator()(const Point& x) const
+    {
+        using std::sqrt;
+        size_t d = tree_.dimension();
+        if (x.size() != d)
+        {
+            throw std::domain_error("The dimension of the point must equal the dimension of the data.");
+        }
+        Real s = 0;
+        if (compact_)
+        {
+            tree_.for_each_within(x, kernel_.support(), [&](size_t i, Real r2) {
+                s += weights_[i]*kernel_(sqrt(r2));
+            });
+            return s;
+        }
+        for (size_t i = 0; i < weights_.size(); ++i)
+        {
+            s += weights_[i]*kernel_(distance(x, tree_.point(i)));
+        }
+        if (!polynomial_.empty())
+        {
+            s += polynomial_[0];
+            for (size_t a = 0; a + 1 < polynomial_.size(); ++a)
+            {
+                s += polynomial_[a + 1]*(x[a] - centroid_[a]);
+            }
+        }
+        return s;
+    }
+
+    int64_t bytes() const
+    {
+        return sizeof(*this) + tree_.bytes() + (weights_.size() + polynomial_.size() + centroid_.size())*sizeof(Real);
+    }
+
+private:
+    template<class Point>
+    Real distance(const Point& x, const Real* y) const
+    {
+        using std::sqrt;
+        Real s = 0;
+        for (size_t a = 0; a < tree_.dimension(); ++a)
+        {
+            Real t = x[a] - y[a];
+            s += t*t;
+        }
+        return sqrt(s);
+    }
+
+    Kernel kernel_;
+    bool compact_;
+    kd_tree<Real> tree_;
+    // In tree order:
+    std::vector<Real> weights_;
+    // The coefficients of 1, x_0 - centroid_0, x_1 - centroid_1, ...; empty for a compactly supported kernel:
+    std::vector<Real> polynomial_;
+    std::vector<Real> centroid_;
+};
+
+}
+#endif
@@ -115,6 +115,31 @@ public:
         return impl_->prime(x);
     }
 
+    // As above, but the search for the interval containing x starts from the one found by the last call with this cursor:
+    Real operator()(Real x, interval_cursor& cursor) const {
+        return impl_->operator()(x, cursor);
+    }
+
+    Real prime(Real x, interval_cursor& cursor) const {
+        return impl_->prime(x, cursor);
+    }
+
+    // y[j] = s(x[j]) for every j, for any containers with size() and operator[]:
+    template<class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& x, OutputContainer& y) const {
+        impl_->evaluate(x, y);
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_prime(const InputContainer& x, OutputContainer& dydx) const {
+        impl_->evaluate_prime(x, dydx);
+    }
+
+    // Speeds up the search for the interval containing x in calls without a cursor; push_back discards it:
+    void build_search_index() {
+        impl_->build_search_index();
+    }
+
     friend std::ostream& operator<<(std::ostream & os, const makima & m)
     {
         os << *m.impl_;
@@ -127,6 +152,7 @@ public:
         if (x <= impl_->x_.back()) {
              throw std::domain_error("Calling push_back must preserve the monotonicity of the x's");
         }
+        impl_->clear_search_index();
         impl_->x_.push_back(x);
         impl_->y_.push_back(y);
         impl_->dydx_.push_back(std::numeric_limits<Real>::quiet_NaN());
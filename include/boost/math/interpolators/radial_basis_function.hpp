@@ -0,0 +1,158 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See: Wendland, Scattered Data Approximation, Cambridge University Press, 2005.
+
+#ifndef BOOST_MATH_INTERPOLATORS_RADIAL_BASIS_FUNCTION_HPP
+#define BOOST_MATH_INTERPOLATORS_RADIAL_BASIS_FUNCTION_HPP
+#include <memory>
+#include <boost/math/interpolators/detail/radial_basis_function_detail.hpp>
+
+namespace boost::math::interpolators {
+
+//
+// A kernel provides phi(r), its support radius (infinity for a kernel of global support), and the degree of the
+// polynomial which must be added to the interpolant for the interpolation problem to be uniquely solvable,
+// which is -1 if none is needed.  Kernels of finite support must be positive definite.  A kernel which is only
+// positive definite up to some dimension declares it as max_dimension.
+//
+
+// phi(r) = r^2 log(r), conditionally positive definite of order 2:
+template<class Real>
+class thin_plate_spline
+{
+public:
+    static constexpr int polynomial_degree = 1;
+
+    Real operator()(Real r) const
+    {
+        using std::log;
+        return r == 0 ? Real(0) : r*r*log(r);
+    }
+
+    Real support() const
+    {
+        return std::numeric_limits<Real>::infinity();
+    }
+};
+
+// phi(r) = sqrt(r^2 + c^2), conditionally negative definite of order 1:
+template<class Real>
+class multiquadric
+{
+public:
+    static constexpr int polynomial_degree = 0;
+
+    explicit multiquadric(Real c = 1) : c2_{c*c}
+    {
+        using std::isfinite;
+        if (!(c > 0) || !isfinite(c))
+        {
+            throw std::domain_error("The shape parameter of the multiquadric must be finite and positive.");
+        }
+    }
+
+    Real operator()(Real r) const
+    {
+        using std::sqrt;
+        return sqrt(r*r + c2_);
+    }
+
+    Real support() const
+    {
+        return std::numeric_limits<Real>::infinity();
+    }
+
+private:
+    Real c2_;
+};
+
+// Wendland's phi_{3,1}(r/rho) = (1 - r/rho)_+^4 (4r/rho + 1), which is C^2, and positive definite in up to three dimensions:
+template<class Real>
+class wendland_c2
+{
+public:
+    static constexpr int polynomial_degree = -1;
+    static constexpr size_t max_dimension = 3;
+
+    explicit wendland_c2(Real radius) : radius_{radius}, inv_radius_{1/radius}
+    {
+        using std::isfinite;
+        if (!(radius > 0) || !isfinite(radius))
+        {
+            throw std::domain_error("The support radius of the Wendland function must be finite and positive.");
+        }
+    }
+
+    Real operator()(Real r) const
+    {
+        Real t = r*inv_radius_;
+        if (t >= 1)
+        {
+            return Real(0);
+        }
+        Real s = 1 - t;
+        s *= s;
+        return s*s*(4*t + 1);
+    }
+
+    Real support() const
+    {
+        return radius_;
+    }
+
+private:
+    Real radius_;
+    Real inv_radius_;
+};
+
+//
+// Interpolates values at scattered points in any dimension by a sum of radial basis functions centered at the points.
+// Kernels of compact support give a sparse interpolation problem and fast evaluation, whereas kernels of global
+// support give a dense problem, which is solved directly at O(n^3) cost, and evaluations cost O(n).
+//
+template<class PointContainer, class Kernel = thin_plate_spline<typename PointContainer::value_type::value_type>>
+class radial_basis_function
+{
+public:
+    using Point = typename PointContainer::value_type;
+    using Real = typename Point::value_type;
+
+    radial_basis_function(const PointContainer& points, const std::vector<Real>& values, Kernel kernel = Kernel())
+        : m_imp(std::make_shared<detail::radial_basis_function_detail<Real, Kernel>>(points, values, kernel))
+    {
+    }
+
+    Real operator()(const Point& x) const
+    {
+        return m_imp->operator()(x);
+    }
+
+    // y[i] = s(x[i]):
+    template<class OutputContainer>
+    void evaluate(const PointContainer& x, OutputContainer& y) const
+    {
+        if (x.size() != y.size())
+        {
+            throw std::domain_error("There must be as many outputs as points.");
+        }
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            y[i] = m_imp->operator()(x[i]);
+        }
+    }
+
+    int64_t bytes() const
+    {
+        return m_imp->bytes() + sizeof(m_imp);
+    }
+
+private:
+    std::shared_ptr<detail::radial_basis_function_detail<Real, Kernel>> m_imp;
+};
+
+}
+#endif
@@ -39,6 +39,41 @@ public:
         return impl_->double_prime(x);
     }
 
+    // As above, but the search for the interval containing x starts from the one found by the last call with this cursor:
+    inline Real operator()(Real x, interval_cursor& cursor) const
+    {
+        return impl_->operator()(x, cursor);
+    }
+
+    inline Real prime(Real x, interval_cursor& cursor) const
+    {
+        return impl_->prime(x, cursor);
+    }
+
+    inline Real double_prime(Real x, interval_cursor& cursor) const
+    {
+        return impl_->double_prime(x, cursor);
+    }
+
+    // y[j] = s(x[j]) for every j, for any containers with size() and operator[]:
+    template<class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& x, OutputContainer& y) const
+    {
+        impl_->evaluate(x, y);
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_prime(const InputContainer& x, OutputContainer& dydx) const
+    {
+        impl_->evaluate_prime(x, dydx);
+    }
+
+    // Speeds up the search for the interval containing x in calls without a cursor; push_back discards it:
+    void build_search_index()
+    {
+        impl_->build_search_index();
+    }
+
     friend std::ostream& operator<<(std::ostream & os, const septic_hermite & m)
     {
         os << *m.impl_;
@@ -85,6 +120,25 @@ public:
         return impl_->double_prime(x);
     }
 
+    // y[j] = s(x[j]) for every j, for any containers with size() and operator[]:
+    template<class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& x, OutputContainer& y) const
+    {
+        impl_->evaluate(x, y);
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_prime(const InputContainer& x, OutputContainer& dydx) const
+    {
+        impl_->evaluate_prime(x, dydx);
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_double_prime(const InputContainer& x, OutputContainer& d2ydx2) const
+    {
+        impl_->evaluate_double_prime(x, d2ydx2);
+    }
+
     int64_t bytes() const
     {
         return impl_->bytes() + sizeof(impl_);
@@ -124,6 +178,25 @@ public:
         return impl_->double_prime(x);
     }
 
+    // y[j] = s(x[j]) for every j, for any containers with size() and operator[]:
+    template<class InputContainer, class OutputContainer>
+    void evaluate(const InputContainer& x, OutputContainer& y) const
+    {
+        impl_->evaluate(x, y);
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_prime(const InputContainer& x, OutputContainer& dydx) const
+    {
+        impl_->evaluate_prime(x, dydx);
+    }
+
+    template<class InputContainer, class OutputContainer>
+    void evaluate_double_prime(const InputContainer& x, OutputContainer& d2ydx2) const
+    {
+        impl_->evaluate_double_prime(x, d2ydx2);
+    }
+
     int64_t bytes() const
     {
         return impl_.size() + sizeof(impl_);
@@ -0,0 +1,196 @@
+// Copyright The Boost.Math contributors 2026.
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ * Integration of a family of integrands over many intervals in one call.
+ *
+ * Item i of the batch is the integral of x -> f(x, i) over [a[i], b[i]], so that any parameters of the
+ * integrand are looked up by the integrand itself from its index, or if an array of parameters is given,
+ * of x -> f(x, params[i]), where each parameter may be a struct or a std::tuple holding any number of values.
+ * The items are independent of one another,
+ * and are shared out between a pool of threads by guided self-scheduling: each thread repeatedly claims a
+ * contiguous chunk of the items not yet started, whose size is a fraction of those remaining.  Chunks are
+ * large at first, so that there is little contention for the shared counter, and shrink towards the end of
+ * the batch, so that a few expensive items near the end do not leave the other threads idle.
+ *
+ * Since each item is integrated exactly as it would be by a single call to the underlying integrator, the
+ * results do not depend on the number of threads.  The results are written to structure-of-arrays outputs:
+ * one array each for the values, the error estimates and the L1 norms, any but the first of which may be null.
+ *
+ * The integrand is called concurrently from several threads, and must be thread safe.
+ */
+
+#ifndef BOOST_MATH_QUADRATURE_BATCH_QUADRATURE_HPP
+#define BOOST_MATH_QUADRATURE_BATCH_QUADRATURE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <boost/math/quadrature/gauss_kronrod.hpp>
+#include <boost/math/quadrature/tanh_sinh.hpp>
+
+namespace boost { namespace math { namespace quadrature {
+
+namespace detail {
+
+//
+// Calls work(i) for every i in [0, n), on the calling thread and up to threads - 1 others.
+// If any call throws, no further chunks are started and the first exception is rethrown
+// once all the threads have finished:
+//
+template <class Work>
+void batch_for_each(std::size_t n, unsigned threads, std::size_t min_chunk, const Work& work)
+{
+   std::atomic<std::size_t> next(0);
+   std::mutex mu;
+   std::exception_ptr exception;
+   std::size_t workers = (std::max)((std::min)(static_cast<std::size_t>(threads), n), std::size_t(1));
+
+   auto worker = [&]()
+   {
+      try
+      {
+         std::size_t start = next.load();
+         for (;;)
+         {
+            std::size_t chunk;
+            do
+            {
+               if (start >= n)
+                  return;
+               chunk = (std::min)((std::max)((n - start) / (2 * workers), min_chunk), n - start);
+            } while (!next.compare_exchange_weak(start, start + chunk));
+            for (std::size_t i = start; i < start + chunk; ++i)
+               work(i);
+            start = next.load();
+         }
+      }
+      catch (...)
+      {
+         std::lock_guard<std::mutex> lock(mu);
+         if (!exception)
+            exception = std::current_exception();
+         next = n;
+      }
+   };
+
+   std::vector<std::thread> pool;
+   for (std::size_t i = 1; i < workers; ++i)
+      pool.push_back(std::thread(worker));
+   worker();
+   std::for_each(pool.begin(), pool.end(), std::mem_fn(&std::thread::join));
+   if (exception)
+      std::rethrow_exception(exception);
+}
+
+}
+
+template <class Real, class Policy = boost::math::policies::policy<> >
+class batch_quadrature
+{
+public:
+   typedef Real value_type;
+
+   batch_quadrature(unsigned threads = std::thread::hardware_concurrency(), std::size_t min_chunk = 1)
+      : m_threads((std::max)(threads, 1u)), m_min_chunk((std::max)(min_chunk, std::size_t(1))) {}
+
+   //
+   // Each item by gauss_kronrod<Real, N>::integrate(g, a[i], b[i], max_depth, tol) with g(x) = f(x, i):
+   //
+   template <unsigned N, class F>
+   void integrate(const gauss_kronrod<Real, N, Policy>& rule, F f, const Real* a, const Real* b, std::size_t n,
+                  Real* results, Real* errors = nullptr, Real* L1s = nullptr,
+                  unsigned max_depth = 15, Real tol = tools::root_epsilon<Real>()) const
+   {
+      integrate_items(rule, f, [](std::size_t i) { return i; }, a, b, n, results, errors, L1s, max_depth, tol);
+   }
+   //
+   // As above, but with g(x) = f(x, params[i]):
+   //
+   template <unsigned N, class F, class P>
+   void integrate(const gauss_kronrod<Real, N, Policy>& rule, F f, const Real* a, const Real* b, const P* params, std::size_t n,
+                  Real* results, Real* errors = nullptr, Real* L1s = nullptr,
+                  unsigned max_depth = 15, Real tol = tools::root_epsilon<Real>()) const
+   {
+      integrate_items(rule, f, [params](std::size_t i)->const P& { return params[i]; }, a, b, n, results, errors, L1s, max_depth, tol);
+   }
+
+   //
+   // Each item by integrator.integrate(g, a[i], b[i], tol) with g(x) = f(x, i).  The tables of
+   // abscissa values are shared by all the threads:
+   //
+   template <class F>
+   void integrate(tanh_sinh<Real, Policy> integrator, F f, const Real* a, const Real* b, std::size_t n,
+                  Real* results, Real* errors = nullptr, Real* L1s = nullptr,
+                  Real tol = tools::root_epsilon<Real>()) const
+   {
+      integrate_items(integrator, f, [](std::size_t i) { return i; }, a, b, n, results, errors, L1s, tol);
+   }
+   //
+   // As above, but with g(x) = f(x, params[i]):
+   //
+   template <class F, class P>
+   void integrate(tanh_sinh<Real, Policy> integrator, F f, const Real* a, const Real* b, const P* params, std::size_t n,
+                  Real* results, Real* errors = nullptr, Real* L1s = nullptr,
+                  Real tol = tools::root_epsilon<Real>()) const
+   {
+      integrate_items(integrator, f, [params](std::size_t i)->const P& { return params[i]; }, a, b, n, results, errors, L1s, tol);
+   }
+
+   unsigned threads() const { return m_threads; }
+   std::size_t min_chunk() const { return m_min_chunk; }
+
+private:
+   //
+   // arg(i) is the second argument passed to f for item i:
+   //
+   template <unsigned N, class F, class Arg>
+   void integrate_items(const gauss_kronrod<Real, N, Policy>&, F& f, const Arg& arg, const Real* a, const Real* b, std::size_t n,
+                        Real* results, Real* errors, Real* L1s, unsigned max_depth, Real tol) const
+   {
+      auto work = [&](std::size_t i)
+      {
+         auto g = [&](Real x)->Real { return f(x, arg(i)); };
+         Real error = 0;
+         Real L1 = 0;
+         results[i] = gauss_kronrod<Real, N, Policy>::integrate(g, a[i], b[i], max_depth, tol, &error, &L1);
+         store(i, error, L1, errors, L1s);
+      };
+      detail::batch_for_each(n, m_threads, m_min_chunk, work);
+   }
+
+   template <class F, class Arg>
+   void integrate_items(tanh_sinh<Real, Policy>& integrator, F& f, const Arg& arg, const Real* a, const Real* b, std::size_t n,
+                        Real* results, Real* errors, Real* L1s, Real tol) const
+   {
+      auto work = [&](std::size_t i)
+      {
+         auto g = [&](Real x)->Real { return f(x, arg(i)); };
+         Real error = 0;
+         Real L1 = 0;
+         results[i] = integrator.integrate(g, a[i], b[i], tol, &error, &L1);
+         store(i, error, L1, errors, L1s);
+      };
+      detail::batch_for_each(n, m_threads, m_min_chunk, work);
+   }
+
+   static void store(std::size_t i, Real error, Real L1, Real* errors, Real* L1s)
+   {
+      if (errors)
+         errors[i] = error;
+      if (L1s)
+         L1s[i] = L1;
+   }
+
+   unsigned m_threads;
+   std::size_t m_min_chunk;
+};
+
+}}} // namespaces
+
+#endif
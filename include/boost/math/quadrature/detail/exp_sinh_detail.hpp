@@ -14,6 +14,7 @@
 #include <boost/math/special_functions/next.hpp>
 #include <boost/math/tools/atomic.hpp>
 #include <boost/detail/lightweight_mutex.hpp>
+#include <boost/math/quadrature/quadrature_statistics.hpp>
 
 namespace boost{ namespace math{ namespace quadrature { namespace detail{
 
@@ -41,7 +42,21 @@ public:
     exp_sinh_detail(size_t max_refinements);
 
     template<class F>
-    auto integrate(const F& f, Real* error, Real* L1, const char* function, Real tolerance, std::size_t* levels)->decltype(std::declval<F>()(std::declval<Real>())) const;
+    auto integrate(const F& f, Real* error, Real* L1, const char* function, Real tolerance, std::size_t* levels, quadrature_statistics<Real>* stats = nullptr)->decltype(std::declval<F>()(std::declval<Real>())) const;
+
+    //
+    // Computes every row up to max_refinements now rather than on demand, after which the tables
+    // are never modified again:
+    //
+    void extend_all_refinements()const
+    {
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+       while (m_committed_refinements.load() < m_max_refinements)
+#else
+       while (m_committed_refinements < m_max_refinements)
+#endif
+          extend_refinements();
+    }
 
 private:
    const std::vector<Real>& get_abscissa_row(std::size_t n)const
@@ -99,7 +114,12 @@ private:
       using std::sinh;
       using std::cosh;
       using std::exp;
-      std::size_t row  = ++m_committed_refinements;
+      // Readers don't take the lock, so the count is only bumped once the row is filled in:
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+      std::size_t row = m_committed_refinements.load() + 1;
+#else
+      std::size_t row = m_committed_refinements + 1;
+#endif
 
       Real h = ldexp(Real(1), -static_cast<int>(row));
       const Real t_max = m_t_min + m_abscissas[0].size() - 1;
@@ -119,6 +139,11 @@ private:
          m_weights[row].emplace_back(w);
          ++j;
       }
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+      m_committed_refinements = static_cast<boost::math::detail::atomic_unsigned_integer_type>(row);
+#else
+      m_committed_refinements = static_cast<unsigned>(row);
+#endif
    }
 
     Real m_tol, m_t_min;
@@ -136,14 +161,14 @@ private:
 
 template<class Real, class Policy>
 exp_sinh_detail<Real, Policy>::exp_sinh_detail(size_t max_refinements)
-   : m_abscissas(max_refinements), m_weights(max_refinements),
+   : m_abscissas(max_refinements + 1), m_weights(max_refinements + 1),
    m_max_refinements(max_refinements)
 {
    init(boost::integral_constant<int, initializer_selector>());
 }
 template<class Real, class Policy>
 template<class F>
-auto exp_sinh_detail<Real, Policy>::integrate(const F& f, Real* error, Real* L1, const char* function, Real tolerance, std::size_t* levels)->decltype(std::declval<F>()(std::declval<Real>())) const
+auto exp_sinh_detail<Real, Policy>::integrate(const F& f, Real* error, Real* L1, const char* function, Real tolerance, std::size_t* levels, quadrature_statistics<Real>* stats)->decltype(std::declval<F>()(std::declval<Real>())) const
 {
     typedef decltype(f(Real(0))) K;
     using std::abs;
@@ -188,6 +213,11 @@ auto exp_sinh_detail<Real, Policy>::integrate(const F& f, Real* error, Real* L1,
     L1_I1 *= half<Real>();
     Real err = abs(I0 - I1);
     //std::cout << "Second estimate: " << I1 << " Error estimate at level " << 1 << " = " << err << std::endl;
+    if (stats)
+    {
+       stats->evaluations += m_abscissas[0].size() + m_abscissas[1].size();
+       stats->errors.push_back(err);
+    }
 
     size_t i = 2;
     for(; i < m_abscissas.size(); ++i)
@@ -206,6 +236,7 @@ auto exp_sinh_detail<Real, Policy>::integrate(const F& f, Real* error, Real* L1,
 
         Real abterm1 = 1;
         Real eps = tools::epsilon<Real>()*L1_I1;
+        std::size_t evaluations = m_weights[i].size();
         for(size_t j = 0; j < m_weights[i].size(); ++j)
         {
             Real x = abscissas_row[j];
@@ -220,6 +251,7 @@ auto exp_sinh_detail<Real, Policy>::integrate(const F& f, Real* error, Real* L1,
             // However, starting the check at x = 10 rather than x = 100 will only save two function evaluations.
             if (x > (Real) 100 && abterm0 < eps && abterm1 < eps)
             {
+                evaluations = j + 1;
                 break;
             }
             abterm1 = abterm0;
@@ -229,6 +261,11 @@ auto exp_sinh_detail<Real, Policy>::integrate(const F& f, Real* error, Real* L1,
         L1_I1 += absum*h;
         err = abs(I0 - I1);
         //std::cout << "Estimate:        " << I1 << " Error estimate at level " << i  << " = " << err << std::endl;
+        if (stats)
+        {
+           stats->evaluations += evaluations;
+           stats->errors.push_back(err);
+        }
         // Use L1_I1 here to make it work with both complex and real valued integrands:
         if (!isfinite(L1_I1))
         {
@@ -255,6 +292,12 @@ auto exp_sinh_detail<Real, Policy>::integrate(const F& f, Real* error, Real* L1,
        *levels = i;
     }
 
+    if (stats)
+    {
+       stats->levels = i;
+       stats->intervals = 1;
+    }
+
     return I1;
 }
 
@@ -0,0 +1,152 @@
+//  Copyright The Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_GAUSS_CONSTEXPR_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_GAUSS_CONSTEXPR_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <array>
+#include <limits>
+#include <utility>
+#include <boost/config.hpp>
+
+//
+// Gauss-Legendre nodes and weights for any N computed by the compiler, so that the rules for float and
+// double need neither hard-coded tables nor root finding on first use.  Requires C++14 constexpr and
+// std::index_sequence; otherwise the rules not tabulated in gauss.hpp are computed on demand as before.
+//
+#if !defined(BOOST_NO_CXX14_CONSTEXPR) && (__cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L))
+#define BOOST_MATH_HAS_CONSTEXPR_GAUSS_NODES
+#endif
+
+#ifdef BOOST_MATH_HAS_CONSTEXPR_GAUSS_NODES
+
+//
+// The compiler's budget for constexpr evaluation is limited, and the cost of the rule grows as N^2,
+// so larger rules are left to the run-time computation:
+//
+#ifndef BOOST_MATH_GAUSS_CONSTEXPR_MAX_POINTS
+#define BOOST_MATH_GAUSS_CONSTEXPR_MAX_POINTS 128
+#endif
+
+namespace boost { namespace math{ namespace quadrature{ namespace detail{
+
+//
+// The non-negative nodes in increasing order, and their weights, as for the tables in gauss.hpp.
+// The arithmetic is done in long double, which is at least as precise as the double results.
+//
+template <unsigned N>
+struct gauss_constexpr_table
+{
+   long double abscissa[(N + 1) / 2];
+   long double weights[(N + 1) / 2];
+};
+
+// The cosine of x in [0, pi], only ever used for the starting points of the Newton iterations:
+constexpr long double gauss_constexpr_cos(long double x)
+{
+   long double term = 1;
+   long double sum = 1;
+   for (unsigned k = 1; k < 40; ++k)
+   {
+      term *= -x * x / ((2 * k - 1) * (2 * k));
+      sum += term;
+   }
+   return sum;
+}
+
+// P_N(x) and P_N'(x) by the three term recurrence:
+template <unsigned N>
+constexpr std::pair<long double, long double> gauss_constexpr_legendre(long double x)
+{
+   long double p0 = 1;
+   long double p1 = x;
+   for (unsigned k = 2; k <= N; ++k)
+   {
+      long double p2 = ((2 * k - 1) * x * p1 - (k - 1) * p0) / k;
+      p0 = p1;
+      p1 = p2;
+   }
+   return std::pair<long double, long double>(p1, N * (x * p1 - p0) / (x * x - 1));
+}
+
+template <unsigned N>
+constexpr gauss_constexpr_table<N> make_gauss_constexpr_table()
+{
+   gauss_constexpr_table<N> table{};
+   constexpr unsigned M = (N + 1) / 2;
+   constexpr long double pi = 3.141592653589793238462643383279502884L;
+   for (unsigned i = 1; i <= M; ++i)
+   {
+      // The i'th largest zero, starting from Tricomi's approximation:
+      long double n = N;
+      long double x = (1 - 1 / (8 * n * n) + 1 / (8 * n * n * n)) * gauss_constexpr_cos(pi * (i - 0.25L) / (n + 0.5L));
+      if ((N & 1) && (i == M))
+      {
+         x = 0;
+      }
+      else
+      {
+         // Stop once the correction is at the rounding level of x, or no longer shrinks because
+         // rounding error in P_N dominates it:
+         long double last = 2;
+         for (unsigned iteration = 0; iteration < 100; ++iteration)
+         {
+            std::pair<long double, long double> p = gauss_constexpr_legendre<N>(x);
+            long double dx = p.first / p.second;
+            if (dx < 0)
+               dx = -dx;
+            if (dx >= last)
+               break;
+            x -= p.first / p.second;
+            if (dx <= 2 * std::numeric_limits<long double>::epsilon() * x)
+               break;
+            last = dx;
+         }
+      }
+      long double dp = gauss_constexpr_legendre<N>(x).second;
+      table.abscissa[M - i] = x;
+      table.weights[M - i] = 2 / ((1 - x * x) * dp * dp);
+   }
+   return table;
+}
+
+template <class Real, unsigned N, std::size_t... I>
+constexpr std::array<Real, (N + 1) / 2> gauss_constexpr_to_array(const long double (&data)[(N + 1) / 2], std::index_sequence<I...>)
+{
+   return std::array<Real, (N + 1) / 2>{ { static_cast<Real>(data[I])... } };
+}
+
+//
+// A gauss_detail for any N, with the same interface as the hard-coded tables:
+//
+template <class Real, unsigned N>
+class gauss_constexpr_detail
+{
+   static constexpr gauss_constexpr_table<N> table = make_gauss_constexpr_table<N>();
+public:
+   static std::array<Real, (N + 1) / 2> const & abscissa()
+   {
+      static constexpr std::array<Real, (N + 1) / 2> data = gauss_constexpr_to_array<Real, N>(table.abscissa, std::make_index_sequence<(N + 1) / 2>());
+      return data;
+   }
+   static std::array<Real, (N + 1) / 2> const & weights()
+   {
+      static constexpr std::array<Real, (N + 1) / 2> data = gauss_constexpr_to_array<Real, N>(table.weights, std::make_index_sequence<(N + 1) / 2>());
+      return data;
+   }
+};
+
+template <class Real, unsigned N>
+constexpr gauss_constexpr_table<N> gauss_constexpr_detail<Real, N>::table;
+
+}}}} // namespaces
+
+#endif // BOOST_MATH_HAS_CONSTEXPR_GAUSS_NODES
+
+#endif
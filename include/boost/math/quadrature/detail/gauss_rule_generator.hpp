@@ -0,0 +1,269 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_GAUSS_RULE_GENERATOR_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_GAUSS_RULE_GENERATOR_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <vector>
+#include <boost/math/tools/precision.hpp>
+#include <boost/math/tools/atomic.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/detail/lightweight_mutex.hpp>
+
+namespace boost{ namespace math{ namespace quadrature { namespace detail{
+
+//
+// The nodes, in increasing order, and the weights of an n point Gauss rule for some weight function.
+//
+template<class Real>
+struct gauss_rule
+{
+   std::vector<Real> abscissa;
+   std::vector<Real> weights;
+};
+
+//
+// Evaluates the orthonormal polynomial p_n and its derivative at x from the three term recurrence
+//
+//    sqrt(b_{k+1}) p_{k+1}(x) = (x - a_k) p_k(x) - sqrt(b_k) p_{k-1}(x),   p_0 = 1/sqrt(mu_0),
+//
+// where Recurrence supplies a(k), sqrt_b(k) and mu0() for the weight function in question, along with the sum of
+// p_k(x)^2 for k < n.  At a zero of p_n the reciprocal of that sum is the Gauss weight, and unlike the equivalent
+// 1/(sqrt(b_n) p_{n-1} p_n') it is insensitive to small errors in the zero.  Orthonormal polynomials are used, rather
+// than the conventionally normalized ones, as they neither overflow nor underflow until n is very large.
+//
+template<class Real, class Recurrence>
+void orthonormal_polynomial(const Recurrence& r, unsigned n, Real x, Real& p, Real& dp, Real& sum_sq)
+{
+   using std::sqrt;
+   Real p0 = 1 / sqrt(r.mu0());
+   Real dp0 = 0;
+   Real p1 = (x - r.a(0)) * p0 / r.sqrt_b(1);
+   Real dp1 = p0 / r.sqrt_b(1);
+   sum_sq = p0 * p0;
+   for (unsigned k = 1; k < n; ++k)
+   {
+      sum_sq += p1 * p1;
+      Real sb = r.sqrt_b(k + 1);
+      Real p2 = ((x - r.a(k)) * p1 - r.sqrt_b(k) * p0) / sb;
+      Real dp2 = ((x - r.a(k)) * dp1 + p1 - r.sqrt_b(k) * dp0) / sb;
+      p0 = p1;
+      p1 = p2;
+      dp0 = dp1;
+      dp1 = dp2;
+   }
+   p = p1;
+   dp = dp1;
+}
+
+//
+// The eigenvalues of the symmetric tridiagonal Jacobi matrix with diagonal a_0 ... a_{n-1} and off diagonal
+// sqrt(b_1) ... sqrt(b_{n-1}), which are the zeros of p_n, by the implicit QL algorithm with Wilkinson shifts.
+// The eigenvalues are accurate to a few epsilon relative to the norm of the matrix, and are returned in increasing order.
+//
+template<class Real, class Recurrence, class Policy>
+std::vector<Real> jacobi_matrix_eigenvalues(const Recurrence& r, unsigned n, const char* function, const Policy& pol)
+{
+   using std::abs;
+   using std::sqrt;
+   std::vector<Real> d(n), e(n);
+   for (unsigned i = 0; i < n; ++i)
+   {
+      d[i] = r.a(i);
+      e[i] = (i + 1 < n) ? r.sqrt_b(i + 1) : Real(0);
+   }
+   boost::uintmax_t max_iter = policies::get_max_root_iterations<Policy>();
+   int N = static_cast<int>(n);
+   for (int l = 0; l < N; ++l)
+   {
+      boost::uintmax_t iter = 0;
+      int m;
+      do
+      {
+         for (m = l; m < N - 1; ++m)
+         {
+            Real dd = abs(d[m]) + abs(d[m + 1]);
+            if (abs(e[m]) <= tools::epsilon<Real>() * dd)
+               break;
+         }
+         if (m != l)
+         {
+            if (iter++ >= max_iter)
+            {
+               policies::raise_evaluation_error(function, "The eigenvalues of the Jacobi matrix failed to converge, last estimate was %1%", d[l], pol);
+               break;
+            }
+            Real g = (d[l + 1] - d[l]) / (2 * e[l]);
+            Real h = sqrt(g * g + 1);
+            g = d[m] - d[l] + e[l] / (g + (g >= 0 ? h : -h));
+            Real s = 1;
+            Real c = 1;
+            Real p = 0;
+            int i;
+            for (i = m - 1; i >= l; --i)
+            {
+               Real f = s * e[i];
+               Real b = c * e[i];
+               h = sqrt(f * f + g * g);
+               e[i + 1] = h;
+               if (h == 0)
+               {
+                  d[i + 1] -= p;
+                  e[m] = 0;
+                  break;
+               }
+               s = f / h;
+               c = g / h;
+               g = d[i + 1] - p;
+               h = (d[i] - g) * s + 2 * c * b;
+               p = s * h;
+               d[i + 1] = g + p;
+               g = c * h - b;
+            }
+            if ((h == 0) && (i >= l))
+               continue;
+            d[l] -= p;
+            e[l] = g;
+            e[m] = 0;
+         }
+      } while (m != l);
+   }
+   std::sort(d.begin(), d.end());
+   return d;
+}
+
+//
+// Polishes an estimate of a zero of p_n by Newton iteration, and returns it along with its Gauss weight.  The iteration stops once the correction is negligible, or once it stops
+// decreasing, as it will when it reaches the rounding error in p_n close to a zero near the origin:
+//
+template<class Real, class Recurrence, class Policy>
+Real refine_gauss_node(const Recurrence& r, unsigned n, Real z, Real& weight, const char* function, const Policy& pol)
+{
+   using std::abs;
+   Real p, dp, sum_sq;
+   boost::uintmax_t max_iter = policies::get_max_root_iterations<Policy>();
+   boost::uintmax_t iter = 0;
+   Real tol = 2 * tools::epsilon<Real>();
+   Real last_step = tools::max_value<Real>();
+   for (;;)
+   {
+      orthonormal_polynomial(r, n, z, p, dp, sum_sq);
+      Real dz = p / dp;
+      z -= dz;
+      Real step = abs(dz);
+      if ((step <= tol * abs(z)) || ((step >= last_step) && (step <= tools::root_epsilon<Real>() * abs(z))) || (z == 0))
+      {
+         break;
+      }
+      if (++iter >= max_iter)
+      {
+         policies::raise_evaluation_error(function, "Newton iteration for the Gauss nodes failed to converge, last estimate was %1%", z, pol);
+         break;
+      }
+      last_step = step;
+   }
+   // One more evaluation at the converged node, for the weight:
+   orthonormal_polynomial(r, n, z, p, dp, sum_sq);
+   weight = 1 / sum_sq;
+   return z;
+}
+
+//
+// The complete n point rule: the eigenvalues of the Jacobi matrix, each polished against the recurrence.
+// The work is done in value_type, which may be more precise than Real:
+//
+template<class Real, class value_type, class Recurrence, class Policy>
+std::shared_ptr<const gauss_rule<Real>> make_gauss_rule(const Recurrence& r, unsigned n, const char* function, const Policy& pol)
+{
+   std::vector<value_type> x = jacobi_matrix_eigenvalues<value_type>(r, n, function, pol);
+   std::shared_ptr<gauss_rule<Real>> rule(new gauss_rule<Real>);
+   rule->abscissa.resize(n);
+   rule->weights.resize(n);
+   for (unsigned i = 0; i < n; ++i)
+   {
+      value_type w;
+      value_type z = refine_gauss_node(r, n, x[i], w, function, pol);
+      rule->abscissa[i] = static_cast<Real>(z);
+      rule->weights[i] = static_cast<Real>(w);
+   }
+   return rule;
+}
+
+//
+// A process wide cache of rules: the first request for a given Key (the order and the parameters of the weight
+// function) generates the rule, and all later requests share it.  Entries live for the lifetime of the program.
+// The Policy determines the precision the rule is generated in, so each Policy has a cache of its own.
+//
+template<class Real, class Policy, class Key>
+class gauss_rule_cache
+{
+public:
+   template<class Factory>
+   static std::shared_ptr<const gauss_rule<Real>> get(const Key& key, Factory make)
+   {
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+      boost::detail::lightweight_mutex::scoped_lock guard(mutex());
+#endif
+      std::shared_ptr<const gauss_rule<Real>>& p = cache()[key];
+      if (!p)
+      {
+         p = make();
+      }
+      return p;
+   }
+
+private:
+   static std::map<Key, std::shared_ptr<const gauss_rule<Real>>>& cache()
+   {
+      static std::map<Key, std::shared_ptr<const gauss_rule<Real>>> data;
+      return data;
+   }
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+   static boost::detail::lightweight_mutex& mutex()
+   {
+      static boost::detail::lightweight_mutex m;
+      return m;
+   }
+#endif
+};
+
+// The rule of a quadrature object whose construction failed under a non-throwing policy:
+template<class Real>
+const gauss_rule<Real>& empty_gauss_rule()
+{
+   static const gauss_rule<Real> rule;
+   return rule;
+}
+
+//
+// Sum of w[i] f(x[i]) and of w[i] |f(x[i])| over the rule:
+//
+template<class Real, class F>
+auto gauss_rule_sum(const gauss_rule<Real>& rule, F& f, Real* pL1)->decltype(std::declval<F&>()(std::declval<Real>()))
+{
+   typedef decltype(f(Real(0))) K;
+   using std::abs;
+   K result = Real(0);
+   Real L1 = 0;
+   for (std::size_t i = 0; i < rule.abscissa.size(); ++i)
+   {
+      K y = f(rule.abscissa[i]);
+      result += rule.weights[i] * y;
+      L1 += rule.weights[i] * abs(y);
+   }
+   if (pL1)
+   {
+      *pL1 = L1;
+   }
+   return result;
+}
+
+}}}}
+#endif
@@ -0,0 +1,179 @@
+// Copyright The Boost.Math contributors 2026.
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_MAPPED_INTEGRAND_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_MAPPED_INTEGRAND_HPP
+
+#include <cmath>
+#include <utility>
+#include <boost/assert.hpp>
+#include <boost/math/tools/config.hpp>
+#include <boost/math/tools/precision.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/special_functions/next.hpp>
+
+namespace boost{ namespace math{ namespace quadrature{ namespace detail{
+
+//
+// The changes of variable used by tanh_sinh::integrate, as a functor of the abscissa pair (z, zc) on (-1, 1),
+// where zc is the complement of z: 1 - z for z > 0, and -1 - z for z < 0.  Passing the complement separately
+// keeps the mappings accurate next to the ends of (-1, 1), where the infinite ranges are mapped from.
+// The integral over [a, b] is scale() times the integral of the functor over (-1, 1).  Requires a <= b.
+// A tanh_sinh_session keeps one between levels, holding its own copy of f, whereas integrate() uses
+// F = const G& to refer to the caller's integrand.  The vectorized tanh_sinh and gauss_kronrod integrators
+// call map() directly, and evaluate f themselves, a row or an interval at a time:
+//
+template<class Real, class F>
+class tanh_sinh_mapped_integrand
+{
+public:
+   tanh_sinh_mapped_integrand(const F& f, Real a, Real b)
+      : m_f(f), m_a(a), m_b(b), m_avg(0), m_diff(0), m_avg_over_diff_m1(0), m_avg_over_diff_p1(0),
+        m_have_small_left(false), m_have_small_right(false), m_scale(0), m_left_min_complement(0), m_right_min_complement(0)
+   {
+      BOOST_MATH_STD_USING
+      using boost::math::constants::half;
+      if ((boost::math::isnan)(a) || (boost::math::isnan)(b))
+      {
+         m_kind = invalid;
+      }
+      else if ((a <= -tools::max_value<Real>()) && (b >= tools::max_value<Real>()))
+      {
+         m_kind = both_infinite;
+         m_scale = 1;
+         m_left_min_complement = m_right_min_complement = sqrt(tools::min_value<Real>()) * 4;
+      }
+      else if ((boost::math::isfinite)(a) && (b >= tools::max_value<Real>()))
+      {
+         m_kind = right_infinite;
+         m_scale = 2;
+         m_left_min_complement = sqrt(tools::min_value<Real>()) * 4;
+         m_right_min_complement = tools::min_value<Real>();
+      }
+      else if ((boost::math::isfinite)(b) && (a <= -tools::max_value<Real>()))
+      {
+         m_kind = left_infinite;
+         m_scale = 2;
+         m_left_min_complement = sqrt(tools::min_value<Real>()) * 4;
+         m_right_min_complement = tools::min_value<Real>();
+      }
+      else if ((boost::math::isfinite)(a) && (boost::math::isfinite)(b))
+      {
+         m_kind = a == b ? empty : finite;
+         if (m_kind == empty)
+            return;
+         m_avg = (a + b)*half<Real>();
+         m_diff = (b - a)*half<Real>();
+         m_scale = m_diff;
+         m_avg_over_diff_m1 = a / m_diff;
+         m_avg_over_diff_p1 = b / m_diff;
+         m_have_small_left = fabs(a) < 0.5f;
+         m_have_small_right = fabs(b) < 0.5f;
+         m_left_min_complement = float_next(m_avg_over_diff_m1) - m_avg_over_diff_m1;
+         Real min_complement_limit = (std::max)(tools::min_value<Real>(), Real(tools::min_value<Real>() / m_diff));
+         if (m_left_min_complement < min_complement_limit)
+            m_left_min_complement = min_complement_limit;
+         m_right_min_complement = m_avg_over_diff_p1 - float_prior(m_avg_over_diff_p1);
+         if (m_right_min_complement < min_complement_limit)
+            m_right_min_complement = min_complement_limit;
+         //
+         // These asserts will fail only if rounding errors on
+         // type Real have accumulated so much error that it's
+         // broken our internal logic.  Should that prove to be
+         // a persistent issue, we might need to add a bit of fudge
+         // factor to move left_min_complement and right_min_complement
+         // further from the end points of the range.
+         //
+         BOOST_ASSERT((m_left_min_complement * m_diff + a) > a);
+         BOOST_ASSERT((b - m_right_min_complement * m_diff) < b);
+      }
+      else
+      {
+         m_kind = invalid;
+      }
+   }
+
+   template<class G = F>
+   auto operator()(const Real& z, const Real& zc) const ->decltype(std::declval<const G&>()(std::declval<Real>()))
+   {
+      if ((m_kind == finite) || (m_kind == empty))
+         return m_f(map(z, zc));
+      Real jacobian;
+      Real x = map(z, zc, jacobian);
+      return m_f(x)*jacobian;
+   }
+   //
+   // Returns the argument of f for the abscissa pair (z, zc), and the Jacobian of the change of variable,
+   // which is one for finite ranges:
+   //
+   Real map(const Real& z, const Real& zc, Real& jacobian) const
+   {
+      switch (m_kind)
+      {
+      case both_infinite:
+      {
+         Real t_sq = z*z;
+         Real inv;
+         if (z > 0.5f)
+            inv = 1 / ((2 - zc) * zc);
+         else if (z < -0.5)
+            inv = 1 / ((2 + zc) * -zc);
+         else
+            inv = 1 / (1 - t_sq);
+         jacobian = (1 + t_sq)*inv*inv;
+         return z*inv;
+      }
+      case right_infinite:
+      case left_infinite:
+      {
+         Real u, arg;
+         if (z > -0.5f)
+            u = 1 / (z + 1);
+         else
+            u = -1 / zc;
+         if (z < 0.5)
+            arg = 2 * u - 1;
+         else
+            arg = zc / (2 - zc);
+         jacobian = u*u;
+         return m_kind == right_infinite ? Real(m_a + arg) : Real(m_b - arg);
+      }
+      default:
+         jacobian = 1;
+         return map(z, zc);
+      }
+   }
+
+   bool valid() const { return m_kind != invalid; }
+   bool is_empty() const { return m_kind == empty; }
+   Real scale() const { return m_scale; }
+   Real left_min_complement() const { return m_left_min_complement; }
+   Real right_min_complement() const { return m_right_min_complement; }
+
+private:
+   enum kind_type { invalid, empty, finite, both_infinite, right_infinite, left_infinite };
+
+   // The finite range case:
+   Real map(const Real& z, const Real& zc) const
+   {
+      if (z < -0.5)
+         return m_have_small_left ? Real(m_diff * (m_avg_over_diff_m1 - zc)) : Real(m_a - m_diff * zc);
+      if (z > 0.5)
+         return m_have_small_right ? Real(m_diff * (m_avg_over_diff_p1 - zc)) : Real(m_b - m_diff * zc);
+      return m_avg + m_diff*z;
+   }
+
+   F m_f;
+   kind_type m_kind;
+   Real m_a, m_b, m_avg, m_diff, m_avg_over_diff_m1, m_avg_over_diff_p1;
+   bool m_have_small_left, m_have_small_right;
+   Real m_scale, m_left_min_complement, m_right_min_complement;
+};
+
+}}}} // namespaces
+
+#endif
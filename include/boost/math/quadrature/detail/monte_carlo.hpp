@@ -0,0 +1,339 @@
+/*
+ * Copyright The Boost.Math contributors, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_MONTE_CARLO_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_MONTE_CARLO_HPP
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <boost/atomic.hpp>
+#include <boost/math/policies/error_handling.hpp>
+
+//
+// The machinery shared by the Monte-Carlo integrators: the mapping of the unit hypercube onto the
+// domain of integration, the pool of threads which take the samples, and the publication of the
+// current estimate to the threads reporting progress.
+//
+namespace boost { namespace math { namespace quadrature { namespace detail {
+
+  enum class limit_classification {FINITE,
+                                   LOWER_BOUND_INFINITE,
+                                   UPPER_BOUND_INFINITE,
+                                   DOUBLE_INFINITE};
+
+  //
+  // Maps points of the unit hypercube onto the product of the bounds, with the change of variables
+  // required for infinite bounds.  If the integrand may be singular on the boundary, the points are
+  // kept strictly inside it.
+  //
+  template<class Real, class Policy>
+  class monte_carlo_domain
+  {
+  public:
+      monte_carlo_domain(std::vector<std::pair<Real, Real>> const & bounds, bool singular, const char* function)
+      {
+          using std::numeric_limits;
+          uint64_t n = bounds.size();
+          m_lbs.resize(n);
+          m_dxs.resize(n);
+          m_limit_types.resize(n);
+          m_volume = 1;
+          for (uint64_t i = 0; i < n; ++i)
+          {
+              if (bounds[i].second <= bounds[i].first)
+              {
+                  boost::math::policies::raise_domain_error(function, "The upper bound is <= the lower bound.\n", bounds[i].second, Policy());
+                  return;
+              }
+              if (bounds[i].first == -numeric_limits<Real>::infinity())
+              {
+                  if (bounds[i].second == numeric_limits<Real>::infinity())
+                  {
+                      m_limit_types[i] = limit_classification::DOUBLE_INFINITE;
+                  }
+                  else
+                  {
+                      m_limit_types[i] = limit_classification::LOWER_BOUND_INFINITE;
+                      // Ok ok this is bad to use the second bound as the lower limit and then reflect.
+                      m_lbs[i] = bounds[i].second;
+                      m_dxs[i] = numeric_limits<Real>::quiet_NaN();
+                  }
+              }
+              else if (bounds[i].second == numeric_limits<Real>::infinity())
+              {
+                  m_limit_types[i] = limit_classification::UPPER_BOUND_INFINITE;
+                  if (singular)
+                  {
+                      // I've found that it's easier to sample on a closed set and perturb the boundary
+                      // than to try to sample very close to the boundary.
+                      m_lbs[i] = std::nextafter(bounds[i].first, (std::numeric_limits<Real>::max)());
+                  }
+                  else
+                  {
+                      m_lbs[i] = bounds[i].first;
+                  }
+                  m_dxs[i] = numeric_limits<Real>::quiet_NaN();
+              }
+              else
+              {
+                  m_limit_types[i] = limit_classification::FINITE;
+                  if (singular)
+                  {
+                      if (bounds[i].first == 0)
+                      {
+                          m_lbs[i] = std::numeric_limits<Real>::epsilon();
+                      }
+                      else
+                      {
+                          m_lbs[i] = std::nextafter(bounds[i].first, (std::numeric_limits<Real>::max)());
+                      }
+
+                      m_dxs[i] = std::nextafter(bounds[i].second, std::numeric_limits<Real>::lowest()) - m_lbs[i];
+                  }
+                  else
+                  {
+                      m_lbs[i] = bounds[i].first;
+                      m_dxs[i] = bounds[i].second - bounds[i].first;
+                  }
+                  m_volume *= m_dxs[i];
+              }
+          }
+      }
+
+      uint64_t dimension() const
+      {
+          return m_lbs.size();
+      }
+
+      // Maps x from the unit hypercube onto the domain in place, and returns the Jacobian of the mapping:
+      Real transform(std::vector<Real> & x) const
+      {
+          using std::numeric_limits;
+          using std::sqrt;
+          Real coeff = m_volume;
+          for (uint64_t i = 0; i < x.size(); ++i)
+          {
+              // Variable transformation are listed at:
+              // https://en.wikipedia.org/wiki/Numerical_integration
+              // However, we've made some changes to these so that we can evaluate on a compact domain.
+              if (m_limit_types[i] == limit_classification::FINITE)
+              {
+                  x[i] = m_lbs[i] + x[i]*m_dxs[i];
+              }
+              else if (m_limit_types[i] == limit_classification::UPPER_BOUND_INFINITE)
+              {
+                  Real t = x[i];
+                  Real z = 1/(1 + numeric_limits<Real>::epsilon() - t);
+                  coeff *= (z*z)*(1 + numeric_limits<Real>::epsilon());
+                  x[i] = m_lbs[i] + t*z;
+              }
+              else if (m_limit_types[i] == limit_classification::LOWER_BOUND_INFINITE)
+              {
+                  Real t = x[i];
+                  Real z = 1/(t+sqrt((numeric_limits<Real>::min)()));
+                  coeff *= (z*z);
+                  x[i] = m_lbs[i] + (t-1)*z;
+              }
+              else
+              {
+                  Real t1 = 1/(1+numeric_limits<Real>::epsilon() - x[i]);
+                  Real t2 = 1/(x[i]+numeric_limits<Real>::epsilon());
+                  x[i] = (2*x[i]-1)*t1*t2/4;
+                  coeff *= (t1*t1+t2*t2)/4;
+              }
+          }
+          return coeff;
+      }
+
+  private:
+      std::vector<Real> m_lbs;
+      std::vector<Real> m_dxs;
+      std::vector<limit_classification> m_limit_types;
+      Real m_volume;
+  };
+
+  // Enough padding to keep data written by different threads on different cache lines:
+  static const std::size_t monte_carlo_cache_line_size = 64;
+
+  // The seed of the thread_index'th random number stream: the SplitMix64 finalizer of the two combined,
+  // so that streams from nearby seeds or indices are unrelated.
+  inline uint64_t monte_carlo_stream_seed(uint64_t seed, uint64_t thread_index)
+  {
+      uint64_t z = seed + (thread_index + 1)*0x9E3779B97F4A7C15uLL;
+      z = (z ^ (z >> 30))*0xBF58476D1CE4E5B9uLL;
+      z = (z ^ (z >> 27))*0x94D049BB133111EBuLL;
+      return z ^ (z >> 31);
+  }
+
+  //
+  // The current estimate, published by the thread running the integration and read from any thread
+  // without locking.  A sequence lock ensures the readers see a consistent set of values: the writer
+  // makes the sequence number odd while it updates them, and readers retry if it was odd or changed.
+  //
+  template<class Real>
+  class monte_carlo_snapshot
+  {
+  public:
+      struct value_type
+      {
+          Real average;
+          Real variance;
+          uint64_t calls;
+      };
+
+      monte_carlo_snapshot() : m_sequence(0), m_average(0), m_variance(0), m_calls(0) {}
+
+      // Only ever called from one thread at a time:
+      void store(Real average, Real variance, uint64_t calls)
+      {
+          uint64_t s = m_sequence.load(boost::memory_order::relaxed);
+          m_sequence.store(s + 1, boost::memory_order::relaxed);
+          boost::atomic_thread_fence(boost::memory_order::release);
+          m_average.store(average, boost::memory_order::relaxed);
+          m_variance.store(variance, boost::memory_order::relaxed);
+          m_calls.store(calls, boost::memory_order::relaxed);
+          m_sequence.store(s + 2, boost::memory_order::release);
+      }
+
+      value_type load() const
+      {
+          value_type v;
+          for (;;)
+          {
+              uint64_t s1 = m_sequence.load(boost::memory_order::acquire);
+              v.average = m_average.load(boost::memory_order::relaxed);
+              v.variance = m_variance.load(boost::memory_order::relaxed);
+              v.calls = m_calls.load(boost::memory_order::relaxed);
+              boost::atomic_thread_fence(boost::memory_order::acquire);
+              uint64_t s2 = m_sequence.load(boost::memory_order::relaxed);
+              if (!(s1 & 1) && (s1 == s2))
+              {
+                  return v;
+              }
+          }
+      }
+
+  private:
+      boost::atomic<uint64_t> m_sequence;
+      boost::atomic<Real> m_average;
+      boost::atomic<Real> m_variance;
+      boost::atomic<uint64_t> m_calls;
+  };
+
+  //
+  // A persistent pool of threads which take their samples in rounds: run(work) calls work(i) on the
+  // i'th thread for every i, and returns once they have all finished, rethrowing the first exception
+  // thrown by any of them.  The threads are started by the first round, and wait between rounds.
+  //
+  // Since the threads are only ever touched by the work of one round at a time, anything one of them
+  // writes during a round may be read by the caller once run() returns, and vice versa.
+  //
+  class monte_carlo_thread_pool
+  {
+  public:
+      explicit monte_carlo_thread_pool(uint64_t threads) : m_size((std::max)(threads, (uint64_t) 1)) {}
+
+      monte_carlo_thread_pool(const monte_carlo_thread_pool&) = delete;
+      monte_carlo_thread_pool& operator=(const monte_carlo_thread_pool&) = delete;
+
+      ~monte_carlo_thread_pool()
+      {
+          {
+              std::lock_guard<std::mutex> lock(m_mutex);
+              m_shutdown = true;
+          }
+          m_start_round.notify_all();
+          std::for_each(m_threads.begin(), m_threads.end(), std::mem_fn(&std::thread::join));
+      }
+
+      uint64_t size() const
+      {
+          return m_size;
+      }
+
+      void run(const std::function<void(uint64_t)>& work)
+      {
+          std::unique_lock<std::mutex> lock(m_mutex);
+          if (m_threads.empty())
+          {
+              for (uint64_t i = 0; i < m_size; ++i)
+              {
+                  m_threads.push_back(std::thread(&monte_carlo_thread_pool::worker, this, i));
+              }
+          }
+          m_work = &work;
+          m_finished = 0;
+          m_exception = nullptr;
+          ++m_round;
+          m_start_round.notify_all();
+          m_round_finished.wait(lock, [this]() { return m_finished == m_size; });
+          m_work = nullptr;
+          if (m_exception)
+          {
+              std::rethrow_exception(m_exception);
+          }
+      }
+
+  private:
+      void worker(uint64_t thread_index)
+      {
+          uint64_t round = 0;
+          for (;;)
+          {
+              const std::function<void(uint64_t)>* work;
+              {
+                  std::unique_lock<std::mutex> lock(m_mutex);
+                  m_start_round.wait(lock, [&]() { return m_shutdown || m_round != round; });
+                  if (m_shutdown)
+                  {
+                      return;
+                  }
+                  round = m_round;
+                  work = m_work;
+              }
+              std::exception_ptr e;
+              try
+              {
+                  (*work)(thread_index);
+              }
+              catch (...)
+              {
+                  e = std::current_exception();
+              }
+              std::lock_guard<std::mutex> lock(m_mutex);
+              if (e && !m_exception)
+              {
+                  m_exception = e;
+              }
+              if (++m_finished == m_size)
+              {
+                  m_round_finished.notify_one();
+              }
+          }
+      }
+
+      uint64_t m_size;
+      std::vector<std::thread> m_threads;
+      std::mutex m_mutex;
+      std::condition_variable m_start_round;
+      std::condition_variable m_round_finished;
+      const std::function<void(uint64_t)>* m_work = nullptr;
+      uint64_t m_round = 0;
+      uint64_t m_finished = 0;
+      bool m_shutdown = false;
+      std::exception_ptr m_exception;
+  };
+
+}}}}
+#endif
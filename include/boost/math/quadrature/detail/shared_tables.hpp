@@ -0,0 +1,64 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_SHARED_TABLES_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_SHARED_TABLES_HPP
+
+#include <map>
+#include <memory>
+#include <boost/math/tools/atomic.hpp>
+#include <boost/detail/lightweight_mutex.hpp>
+
+namespace boost{ namespace math{ namespace quadrature { namespace detail{
+
+//
+// A process wide cache of abscissa/weight tables for the double exponential integrators.
+//
+// Detail is one of tanh_sinh_detail, exp_sinh_detail or sinh_sinh_detail, and Key whatever
+// identifies a set of tables for that type (the constructor arguments).  The first request for
+// a given key constructs the tables and computes every row up front, so that thereafter they are
+// never modified and all the integrators sharing them can read them without taking a lock.
+// The mutex below is only held while looking up, or building, an entry.
+//
+// Entries live for the lifetime of the program.
+//
+template<class Detail, class Key>
+class shared_tables
+{
+public:
+   template<class Factory>
+   static std::shared_ptr<Detail> get(const Key& key, Factory make)
+   {
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+      boost::detail::lightweight_mutex::scoped_lock guard(mutex());
+#endif
+      std::shared_ptr<Detail>& p = cache()[key];
+      if (!p)
+      {
+         std::shared_ptr<Detail> tables = make();
+         tables->extend_all_refinements();
+         p = tables;
+      }
+      return p;
+   }
+
+private:
+   static std::map<Key, std::shared_ptr<Detail>>& cache()
+   {
+      static std::map<Key, std::shared_ptr<Detail>> data;
+      return data;
+   }
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+   static boost::detail::lightweight_mutex& mutex()
+   {
+      static boost::detail::lightweight_mutex m;
+      return m;
+   }
+#endif
+};
+
+}}}}
+#endif
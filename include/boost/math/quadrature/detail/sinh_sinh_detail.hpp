@@ -14,6 +14,7 @@
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/tools/atomic.hpp>
 #include <boost/detail/lightweight_mutex.hpp>
+#include <boost/math/quadrature/quadrature_statistics.hpp>
 #include <boost/math/policies/error_handling.hpp>
 #include <boost/math/special_functions/trunc.hpp>
 
@@ -43,7 +44,21 @@ public:
     sinh_sinh_detail(size_t max_refinements);
 
     template<class F>
-    auto integrate(const F f, Real tolerance, Real* error, Real* L1, std::size_t* levels)->decltype(std::declval<F>()(std::declval<Real>())) const;
+    auto integrate(const F f, Real tolerance, Real* error, Real* L1, std::size_t* levels, quadrature_statistics<Real>* stats = nullptr)->decltype(std::declval<F>()(std::declval<Real>())) const;
+
+    //
+    // Computes every row up to max_refinements now rather than on demand, after which the tables
+    // are never modified again:
+    //
+    void extend_all_refinements()const
+    {
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+       while (m_committed_refinements.load() < m_max_refinements)
+#else
+       while (m_committed_refinements < m_max_refinements)
+#endif
+          extend_refinements();
+    }
 
 private:
 private:
@@ -104,7 +119,12 @@ private:
       using std::exp;
       using constants::half_pi;
 
-      std::size_t row = ++m_committed_refinements;
+      // Build the row first, and publish it below:
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+      std::size_t row = m_committed_refinements.load() + 1;
+#else
+      std::size_t row = m_committed_refinements + 1;
+#endif
 
       Real h = ldexp(Real(1), -static_cast<int>(row));
       size_t k = (size_t)boost::math::lltrunc(ceil(m_t_max / (2 * h)));
@@ -120,6 +140,11 @@ private:
          m_weights[row].emplace_back(w);
          arg += 2 * h;
       }
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+      m_committed_refinements = static_cast<boost::math::detail::atomic_unsigned_integer_type>(row);
+#else
+      m_committed_refinements = static_cast<unsigned>(row);
+#endif
    }
 
    Real m_t_max;
@@ -137,14 +162,14 @@ private:
 
 template<class Real, class Policy>
 sinh_sinh_detail<Real, Policy>::sinh_sinh_detail(size_t max_refinements)
-   : m_abscissas(max_refinements), m_weights(max_refinements), m_max_refinements(max_refinements)
+   : m_abscissas(max_refinements + 1), m_weights(max_refinements + 1), m_max_refinements(max_refinements)
 {
    init(boost::integral_constant<int, initializer_selector>());
 }
 
 template<class Real, class Policy>
 template<class F>
-auto sinh_sinh_detail<Real, Policy>::integrate(const F f, Real tolerance, Real* error, Real* L1, std::size_t* levels)->decltype(std::declval<F>()(std::declval<Real>())) const
+auto sinh_sinh_detail<Real, Policy>::integrate(const F f, Real tolerance, Real* error, Real* L1, std::size_t* levels, quadrature_statistics<Real>* stats)->decltype(std::declval<F>()(std::declval<Real>())) const
 {
     using std::abs;
     using std::sqrt;
@@ -198,6 +223,12 @@ auto sinh_sinh_detail<Real, Policy>::integrate(const F f, Real tolerance, Real*
     L1_I1 *= half<Real>();
     Real err = abs(I0 - I1);
     // std::cout << "Second estimate: " << I1 << " Error estimate at level " << 1 << " = " << err << std::endl;
+    if (stats)
+    {
+       // Both ends are checked for decay, then f(0) and f(+-x) on the first two rows:
+       stats->evaluations += 3 + 2 * (m_abscissas[0].size() + m_abscissas[1].size());
+       stats->errors.push_back(err);
+    }
 
     size_t i = 2;
     for(; i <= m_max_refinements; ++i)
@@ -217,6 +248,7 @@ auto sinh_sinh_detail<Real, Policy>::integrate(const F f, Real tolerance, Real*
         auto abscissa_row = get_abscissa_row(i);
         auto weight_row = get_weight_row(i);
 
+        std::size_t evaluations = 2 * abscissa_row.size();
         for(size_t j = 0; j < abscissa_row.size(); ++j)
         {
             Real x = abscissa_row[j];
@@ -229,6 +261,7 @@ auto sinh_sinh_detail<Real, Policy>::integrate(const F f, Real tolerance, Real*
             // We require two consecutive terms to be < eps in case we hit a zero of f.
             if (x > (Real) 100 && abterm0 < eps && abterm1 < eps)
             {
+                evaluations = 2 * (j + 1);
                 break;
             }
             abterm1 = abterm0;
@@ -238,6 +271,11 @@ auto sinh_sinh_detail<Real, Policy>::integrate(const F f, Real tolerance, Real*
         L1_I1 += absum*h;
         err = abs(I0 - I1);
         // std::cout << "Estimate:        " << I1 << " Error estimate at level " << i  << " = " << err << std::endl;
+        if (stats)
+        {
+           stats->evaluations += evaluations;
+           stats->errors.push_back(err);
+        }
         if (!(boost::math::isfinite)(L1_I1))
         {
             const char* err_msg = "The sinh_sinh quadrature evaluated your function at a singular point, leading to the value %1%.\n"
@@ -266,6 +304,12 @@ auto sinh_sinh_detail<Real, Policy>::integrate(const F f, Real tolerance, Real*
        *levels = i;
     }
 
+    if (stats)
+    {
+       stats->levels = i;
+       stats->intervals = 1;
+    }
+
     return I1;
 }
 
@@ -11,6 +11,7 @@
 #include <vector>
 #include <boost/math/tools/atomic.hpp>
 #include <boost/detail/lightweight_mutex.hpp>
+#include <boost/math/quadrature/quadrature_statistics.hpp>
 #include <typeinfo>
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/special_functions/next.hpp>
@@ -18,6 +19,134 @@
 namespace boost{ namespace math{ namespace quadrature { namespace detail{
 
 
+//
+// The running state of the level loop in tanh_sinh_detail::integrate: the estimates from the last two
+// levels, and the logical positions of the outermost abscissa values at which f may be evaluated.
+// It is kept apart from the loop so that an integral can also be refined one level at a time:
+//
+template<class Real, class K>
+struct tanh_sinh_level_state
+{
+   tanh_sinh_level_state(Real left, Real right)
+      : I0(0), I1(0), L1_I0(0), L1_I1(0), h(0), err(0), k(0), max_left_position(0), max_right_position(0),
+        left_min_complement(left), right_min_complement(right), thrash_count(0), stalled(false) {}
+
+   K I0, I1;
+   Real L1_I0, L1_I1;
+   Real h;
+   Real err;
+   // The number of levels (rows) evaluated so far:
+   std::size_t k;
+   std::size_t max_left_position, max_right_position;
+   Real left_min_complement, right_min_complement;
+   unsigned thrash_count;
+   // Set once the error estimate has started to increase, after which I1 is the last good estimate:
+   bool stalled;
+};
+
+//
+// The two ways of evaluating a row of abscissa values, for first_level and refine_level below.
+// Each pair (x, xc), with its weight, is passed to add() with flags saying which of f(x) and f(-x) are
+// in bounds, and finish() returns the weighted sum of the row, and its weighted L1 norm.
+//
+// tanh_sinh_scalar_row calls f(z, zc) as each abscissa is visited:
+//
+template<class Real, class F>
+class tanh_sinh_scalar_row
+{
+public:
+   typedef decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) result_type;
+
+   explicit tanh_sinh_scalar_row(const F& f) : m_f(f), m_sum(0), m_absum(0) {}
+
+   void add_origin(const Real& w)
+   {
+      using std::abs;
+      result_type y = w*m_f(0, 1);
+      m_sum += y;
+      m_absum += abs(y);
+   }
+   void add(const Real& x, const Real& xc, const Real& w, bool right, bool left)
+   {
+      using std::abs;
+      result_type yp = right ? m_f(x, -xc) : result_type(0);
+      result_type ym = left ? m_f(-x, xc) : result_type(0);
+      m_sum += (yp + ym)*w;
+      m_absum += (abs(yp) + abs(ym))*w;
+   }
+   result_type finish(Real& absum)
+   {
+      result_type sum = m_sum;
+      absum = m_absum;
+      m_sum = 0;
+      m_absum = 0;
+      return sum;
+   }
+
+private:
+   const F& m_f;
+   result_type m_sum;
+   Real m_absum;
+};
+//
+// tanh_sinh_vectorized_row gathers the whole row, and makes a single call f(x, y, n) at the end of it.
+// m.map(z, zc, jacobian) gives the argument of f for the abscissa pair (z, zc), and the Jacobian of that
+// change of variable.  The buffers are cleared but not released between rows, so they only reallocate
+// when a row is longer than any seen so far:
+//
+template<class Real, class F, class M>
+class tanh_sinh_vectorized_row
+{
+public:
+   typedef Real result_type;
+
+   tanh_sinh_vectorized_row(const F& f, const M& m) : m_f(f), m_m(m) {}
+
+   void add_origin(const Real& w)
+   {
+      push(Real(0), Real(1), w);
+   }
+   void add(const Real& x, const Real& xc, const Real& w, bool right, bool left)
+   {
+      if (right)
+         push(x, -xc, w);
+      if (left)
+         push(-x, xc, w);
+   }
+   Real finish(Real& absum)
+   {
+      using std::abs;
+      m_values.resize(m_args.size());
+      if (m_args.size())
+         m_f(static_cast<const Real*>(m_args.data()), m_values.data(), m_args.size());
+      Real sum = 0;
+      absum = 0;
+      for (std::size_t i = 0; i < m_values.size(); ++i)
+      {
+         Real y = m_values[i] * m_jacobians[i];
+         sum += y * m_weights[i];
+         absum += abs(y) * m_weights[i];
+      }
+      m_args.clear();
+      m_jacobians.clear();
+      m_weights.clear();
+      return sum;
+   }
+
+private:
+   void push(const Real& z, const Real& zc, const Real& w)
+   {
+      Real jacobian;
+      m_args.push_back(m_m.map(z, zc, jacobian));
+      m_jacobians.push_back(jacobian);
+      m_weights.push_back(w);
+   }
+
+   const F& m_f;
+   const M& m_m;
+   std::vector<Real> m_args, m_jacobians, m_weights, m_values;
+};
+
 // Returns the tanh-sinh quadrature of a function f over the open interval (-1, 1)
 
 template<class Real, class Policy>
@@ -45,9 +174,56 @@ public:
     }
 
     template<class F>
-    decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) integrate(const F f, Real* error, Real* L1, const char* function, Real left_min_complement, Real right_min_complement, Real tolerance, std::size_t* levels) const;
+    decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) integrate(const F f, Real* error, Real* L1, const char* function, Real left_min_complement, Real right_min_complement, Real tolerance, std::size_t* levels, quadrature_statistics<Real>* stats = nullptr) const
+    {
+       tanh_sinh_scalar_row<Real, F> row(f);
+       return integrate_rows(row, error, L1, function, left_min_complement, right_min_complement, tolerance, levels, stats);
+    }
+    //
+    // As above, but f is a "vectorized" functor called once per refinement level as f(x, y, n),
+    // where x[0..n) are the abscissa values to evaluate at and f writes f(x[i]) into y[i].
+    // m.map(z, zc, jacobian) maps an abscissa pair (z, zc) on (-1,1) to the argument passed to f,
+    // and stores the Jacobian of that change of variable in its third argument:
+    //
+    template<class F, class M>
+    Real integrate_vectorized(const F& f, const M& m, Real* error, Real* L1, const char* function, Real left_min_complement, Real right_min_complement, Real tolerance, std::size_t* levels, quadrature_statistics<Real>* stats = nullptr) const
+    {
+       tanh_sinh_vectorized_row<Real, F, M> row(f, m);
+       return integrate_rows(row, error, L1, function, left_min_complement, right_min_complement, tolerance, levels, stats);
+    }
+    //
+    // The steps of integrate() above: first_level evaluates row zero, and each call to refine_level
+    // then adds one more row, provided can_refine says that there is one.  Row is one of the
+    // tanh_sinh_*_row classes above:
+    //
+    template<class Row, class K>
+    void first_level(Row& row, tanh_sinh_level_state<Real, K>& s, quadrature_statistics<Real>* stats) const;
+    template<class Row, class K>
+    void refine_level(Row& row, tanh_sinh_level_state<Real, K>& s, quadrature_statistics<Real>* stats) const;
+    template<class K>
+    bool can_refine(const tanh_sinh_level_state<Real, K>& s) const
+    {
+       return !s.stalled && (s.k < 4 || (s.k < m_weights.size() && s.k < m_max_refinements));
+    }
+
+    //
+    // Computes every row up to max_refinements now rather than on demand, after which the tables
+    // are never modified again:
+    //
+    void extend_all_refinements()const
+    {
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+       while (m_committed_refinements.load() < m_max_refinements)
+#else
+       while (m_committed_refinements < m_max_refinements)
+#endif
+          extend_refinements();
+    }
 
 private:
+   template<class Row>
+   typename Row::result_type integrate_rows(Row& row, Real* error, Real* L1, const char* function, Real left_min_complement, Real right_min_complement, Real tolerance, std::size_t* levels, quadrature_statistics<Real>* stats) const;
+
    const std::vector<Real>& get_abscissa_row(std::size_t n)const
    {
 #ifndef BOOST_MATH_NO_ATOMIC_INT
@@ -114,11 +290,14 @@ private:
 
       using std::ldexp;
       using std::ceil;
-      ++m_committed_refinements;
+      //
+      // The new row is only published once it is complete, since other threads read the rows
+      // without taking the lock:
+      //
 #ifndef BOOST_MATH_NO_ATOMIC_INT
-      std::size_t row = m_committed_refinements.load();
+      std::size_t row = m_committed_refinements.load() + 1;
 #else
-      std::size_t row = m_committed_refinements;
+      std::size_t row = m_committed_refinements + 1;
 #endif
       Real h = ldexp(Real(1), -static_cast<int>(row));
       std::size_t first_complement = 0;
@@ -134,6 +313,11 @@ private:
       m_first_complements[row] = first_complement;
       for (Real pos = h; pos < m_t_max; pos += 2 * h)
          m_weights[row].push_back(weight_at_t(pos));
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+      m_committed_refinements = static_cast<boost::math::detail::atomic_unsigned_integer_type>(row);
+#else
+      m_committed_refinements = static_cast<unsigned>(row);
+#endif
    }
 
    static inline Real abscissa_at_t(const Real& t)
@@ -180,16 +364,10 @@ private:
 };
 
 template<class Real, class Policy>
-template<class F>
-decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sinh_detail<Real, Policy>::integrate(const F f, Real* error, Real* L1, const char* function, Real left_min_complement, Real right_min_complement, Real tolerance, std::size_t* levels) const
+template<class Row, class K>
+void tanh_sinh_detail<Real, Policy>::first_level(Row& row, tanh_sinh_level_state<Real, K>& s, quadrature_statistics<Real>* stats) const
 {
-    using std::abs;
     using std::fabs;
-    using std::floor;
-    using std::tanh;
-    using std::sinh;
-    using std::sqrt;
-    using boost::math::constants::half;
     using boost::math::constants::half_pi;
     //
     // We maintain 4 integer values:
@@ -206,34 +384,30 @@ decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sin
     //
     // max_left_position and max_right_position start off as the last element in row zero:
     //
-    std::size_t max_left_position(m_abscissas[0].size() - 1);
-    std::size_t max_left_index, max_right_position(max_left_position), max_right_index;
+    s.max_left_position = m_abscissas[0].size() - 1;
+    s.max_right_position = s.max_left_position;
     //
     // Decrement max_left_position and max_right_position until the complement
     // of the abscissa value is greater than the smallest permitted (as specified
     // by the function caller):
     //
-    while (max_left_position && fabs(m_abscissas[0][max_left_position]) < left_min_complement)
-       --max_left_position;
-    while (max_right_position && fabs(m_abscissas[0][max_right_position]) < right_min_complement)
-       --max_right_position;
+    while (s.max_left_position && fabs(m_abscissas[0][s.max_left_position]) < s.left_min_complement)
+       --s.max_left_position;
+    while (s.max_right_position && fabs(m_abscissas[0][s.max_right_position]) < s.right_min_complement)
+       --s.max_right_position;
     //
     // Assumption: left_min_complement/right_min_complement are sufficiently small that we only
     // ever decrement through the stored values that are complements (the negative ones), and
     // never ever hit the true abscissa values (positive stored values).
     //
-    BOOST_ASSERT(m_abscissas[0][max_left_position] < 0);
-    BOOST_ASSERT(m_abscissas[0][max_right_position] < 0);
-    //
-    // The type of the result:
-    typedef decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) result_type;
+    BOOST_ASSERT(m_abscissas[0][s.max_left_position] < 0);
+    BOOST_ASSERT(m_abscissas[0][s.max_right_position] < 0);
 
-    Real h = m_t_max / m_inital_row_length;
-    result_type I0 = half_pi<Real>()*f(0, 1);
-    Real L1_I0 = abs(I0);
+    s.h = m_t_max / m_inital_row_length;
+    row.add_origin(half_pi<Real>());
     for(size_t i = 1; i < m_abscissas[0].size(); ++i)
     {
-        if ((i > max_right_position) && (i > max_left_position))
+        if ((i > s.max_right_position) && (i > s.max_left_position))
             break;
         Real x = m_abscissas[0][i];
         Real xc = x;
@@ -245,11 +419,15 @@ decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sin
         }
         else
            xc = x - 1;
-        result_type yp, ym;
-        yp = i <= max_right_position ? f(x, -xc) : 0;
-        ym = i <= max_left_position ? f(-x, xc) : 0;
-        I0 += (yp + ym)*w;
-        L1_I0 += (abs(yp) + abs(ym))*w;
+        row.add(x, xc, w, i <= s.max_right_position, i <= s.max_left_position);
+    }
+    Real L1_I0;
+    K I0 = row.finish(L1_I0);
+    if (stats)
+    {
+       // f(0) and then f(x_i) for i <= max_right_position and f(-x_i) for i <= max_left_position:
+       std::size_t last = m_abscissas[0].size() - 1;
+       stats->evaluations += 1 + (std::min)(last, s.max_right_position) + (std::min)(last, s.max_left_position);
     }
     //
     // We have:
@@ -258,112 +436,136 @@ decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sin
     // I1 = current integral value.
     // L1_I0 and L1_I1 are the absolute integral values.
     //
-    size_t k = 1;
-    result_type I1 = I0;
-    Real L1_I1 = L1_I0;
-    Real err = 0;
+    s.k = 1;
+    s.I0 = I0;
+    s.I1 = I0;
+    s.L1_I0 = L1_I0;
+    s.L1_I1 = L1_I0;
+    s.err = 0;
+    s.thrash_count = 0;
+    s.stalled = false;
+}
+
+template<class Real, class Policy>
+template<class Row, class K>
+void tanh_sinh_detail<Real, Policy>::refine_level(Row& row, tanh_sinh_level_state<Real, K>& s, quadrature_statistics<Real>* stats) const
+{
+    using std::abs;
+    using std::fabs;
+    using boost::math::constants::half;
+
+    s.I0 = s.I1;
+    s.L1_I0 = s.L1_I1;
+
+    s.I1 = half<Real>()*s.I0;
+    s.L1_I1 = half<Real>()*s.L1_I0;
+    s.h *= half<Real>();
+    auto const& abscissa_row = this->get_abscissa_row(s.k);
+    auto const& weight_row = this->get_weight_row(s.k);
+    std::size_t first_complement_index = this->get_first_complement_index(s.k);
     //
-    // thrash_count is a heuristic - it counts how many time the error has actually increased
-    // rather than decreased, if this gets too high we abort...
+    // At the start of each new row we need to update the max left/right indexes
+    // at which we can evaluate f(x_i).  The new logical position is simply twice
+    // the old value.  The new max index is one position to the left of the new
+    // logical value (remember each row contains only odd numbered positions).
+    // Then we have to make a single check, to see if one position to the right
+    // is also in bounds (this is the new abscissa value in this row which is
+    // known to be in between a value known to be in bounds, and one known to be
+    // not in bounds).
+    // Thus, we filter which abscissa values generate a call to f(x_i), with a single
+    // floating point comparison per loop.  Everything else is integer logic.
     //
-    unsigned thrash_count = 0;
+    std::size_t max_left_index = s.max_left_position - 1;
+    s.max_left_position *= 2;
+    std::size_t max_right_index = s.max_right_position - 1;
+    s.max_right_position *= 2;
+    if ((abscissa_row.size() > max_left_index + 1) && (fabs(abscissa_row[max_left_index + 1]) > s.left_min_complement))
+    {
+       ++s.max_left_position;
+       ++max_left_index;
+    }
+    if ((abscissa_row.size() > max_right_index + 1) && (fabs(abscissa_row[max_right_index + 1]) > s.right_min_complement))
+    {
+       ++s.max_right_position;
+       ++max_right_index;
+    }
 
-    while (k < 4 || (k < m_weights.size() && k < m_max_refinements) )
+    for(size_t j = 0; j < weight_row.size(); ++j)
     {
-        I0 = I1;
-        L1_I0 = L1_I1;
-
-        I1 = half<Real>()*I0;
-        L1_I1 = half<Real>()*L1_I0;
-        h *= half<Real>();
-        result_type sum = 0;
-        Real absum = 0;
-        auto const& abscissa_row = this->get_abscissa_row(k);
-        auto const& weight_row = this->get_weight_row(k);
-        std::size_t first_complement_index = this->get_first_complement_index(k);
-        //
-        // At the start of each new row we need to update the max left/right indexes
-        // at which we can evaluate f(x_i).  The new logical position is simply twice
-        // the old value.  The new max index is one position to the left of the new
-        // logical value (remember each row contains only odd numbered positions).
-        // Then we have to make a single check, to see if one position to the right
-        // is also in bounds (this is the new abscissa value in this row which is
-        // known to be in between a value known to be in bounds, and one known to be
-        // not in bounds).
-        // Thus, we filter which abscissa values generate a call to f(x_i), with a single
-        // floating point comparison per loop.  Everything else is integer logic.
-        //
-        max_left_index = max_left_position - 1;
-        max_left_position *= 2;
-        max_right_index = max_right_position - 1;
-        max_right_position *= 2;
-        if ((abscissa_row.size() > max_left_index + 1) && (fabs(abscissa_row[max_left_index + 1]) > left_min_complement))
+        // If both left and right abscissa values are out of bounds at this step
+        // we can just stop this loop right now:
+        if ((j > max_left_index) && (j > max_right_index))
+            break;
+        Real x = abscissa_row[j];
+        Real xc = x;
+        Real w = weight_row[j];
+        if (j >= first_complement_index)
         {
-           ++max_left_position;
-           ++max_left_index;
+           // We have stored x - 1:
+           BOOST_ASSERT(x < 0);
+           x = 1 + xc;
         }
-        if ((abscissa_row.size() > max_right_index + 1) && (fabs(abscissa_row[max_right_index + 1]) > right_min_complement))
+        else
         {
-           ++max_right_position;
-           ++max_right_index;
+           BOOST_ASSERT(x >= 0);
+           xc = x - 1;
         }
 
-        for(size_t j = 0; j < weight_row.size(); ++j)
-        {
-            // If both left and right abscissa values are out of bounds at this step
-            // we can just stop this loop right now:
-            if ((j > max_left_index) && (j > max_right_index))
-                break;
-            Real x = abscissa_row[j];
-            Real xc = x;
-            Real w = weight_row[j];
-            if (j >= first_complement_index)
-            {
-               // We have stored x - 1:
-               BOOST_ASSERT(x < 0);
-               x = 1 + xc;
-            }
-            else
-            {
-               BOOST_ASSERT(x >= 0);
-               xc = x - 1;
-            }
-
-            result_type yp = j > max_right_index ? 0 : f(x, -xc);
-            result_type ym = j > max_left_index ? 0 : f(-x, xc);
-            result_type term = (yp + ym)*w;
-            sum += term;
-
-            // A question arises as to how accurately we actually need to estimate the L1 integral.
-            // For simple integrands, computing the L1 norm makes the integration 20% slower,
-            // but for more complicated integrands, this calculation is not noticeable.
-            Real abterm = (abs(yp) + abs(ym))*w;
-            absum += abterm;
-        }
+        // A question arises as to how accurately we actually need to estimate the L1 integral.
+        // For simple integrands, computing the L1 norm makes the integration 20% slower,
+        // but for more complicated integrands, this calculation is not noticeable.
+        row.add(x, xc, w, j <= max_right_index, j <= max_left_index);
+    }
+    Real absum;
+    K sum = row.finish(absum);
+
+    s.I1 += sum*s.h;
+    s.L1_I1 += absum*s.h;
+    ++s.k;
+    Real last_err = s.err;
+    s.err = abs(s.I0 - s.I1);
+    if (stats)
+    {
+       // The row index j <= max_right_index (resp. max_left_index) is evaluated on the right (left),
+       // and the indexes wrap round to zero when nothing on that side is in bounds:
+       stats->evaluations += (std::min)(weight_row.size(), max_right_index + 1) + (std::min)(weight_row.size(), max_left_index + 1);
+       stats->errors.push_back(s.err);
+    }
+    // std::cout << "Estimate:        " << s.I1 << " Error estimate at level " << s.k  << " = " << s.err << std::endl;
+    //
+    // If the error is increasing, and we're past level 4, something bad is very likely happening:
+    //
+    if ((boost::math::isfinite)(s.I1) && (s.err > last_err) && (s.k > 4) && (++s.thrash_count > 1))
+    {
+       // We could raise an evaluation_error, but since we likely have some sort of result, just return the last one
+       // (ie before the error started going up)
+       s.I1 = s.I0;
+       s.L1_I1 = s.L1_I0;
+       --s.k;
+       s.err = last_err;
+       s.stalled = true;
+    }
+}
 
-        I1 += sum*h;
-        L1_I1 += absum*h;
-        ++k;
-        Real last_err = err;
-        err = abs(I0 - I1);
-        // std::cout << "Estimate:        " << I1 << " Error estimate at level " << k  << " = " << err << std::endl;
+template<class Real, class Policy>
+template<class Row>
+typename Row::result_type tanh_sinh_detail<Real, Policy>::integrate_rows(Row& row, Real* error, Real* L1, const char* function, Real left_min_complement, Real right_min_complement, Real tolerance, std::size_t* levels, quadrature_statistics<Real>* stats) const
+{
+    using std::abs;
+    //
+    // The type of the result:
+    typedef typename Row::result_type result_type;
 
-        if (!(boost::math::isfinite)(I1))
-        {
-            return policies::raise_evaluation_error(function, "The tanh_sinh quadrature evaluated your function at a singular point and got %1%. Please narrow the bounds of integration or check your function for singularities.", I1, Policy());
-        }
-        //
-        // If the error is increasing, and we're past level 4, something bad is very likely happening:
-        //
-        if ((err > last_err) && (k > 4) && (++thrash_count > 1))
+    tanh_sinh_level_state<Real, result_type> s(left_min_complement, right_min_complement);
+    this->first_level(row, s, stats);
+
+    while (this->can_refine(s))
+    {
+        this->refine_level(row, s, stats);
+
+        if (!(boost::math::isfinite)(s.I1))
         {
-           // We could raise an evaluation_error, but since we likely have some sort of result, just return the last one
-           // (ie before the error started going up)
-           I1 = I0;
-           L1_I1 = L1_I0;
-           --k;
-           err = last_err;
-           break;
+            return policies::raise_evaluation_error(function, "The tanh_sinh quadrature evaluated your function at a singular point and got %1%. Please narrow the bounds of integration or check your function for singularities.", s.I1, Policy());
         }
         //
         // Termination condition:
@@ -374,7 +576,7 @@ decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sin
         // parameters.  We could keep hunting until we find something, but that would handicap
         // integrals which really are zero.... so a compromise then!
         //
-        if (err <= abs(tolerance*L1_I1))
+        if (s.stalled || (s.err <= abs(tolerance*s.L1_I1)))
         {
             break;
         }
@@ -382,20 +584,26 @@ decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sin
     }
     if (error)
     {
-        *error = err;
+        *error = s.err;
     }
 
     if (L1)
     {
-        *L1 = L1_I1;
+        *L1 = s.L1_I1;
     }
 
     if (levels)
     {
-       *levels = k;
+       *levels = s.k;
+    }
+
+    if (stats)
+    {
+       stats->levels = s.k;
+       stats->intervals = 1;
     }
 
-    return I1;
+    return s.I1;
 }
 
 template<class Real, class Policy>
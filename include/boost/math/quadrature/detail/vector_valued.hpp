@@ -0,0 +1,193 @@
+// Copyright The Boost.Math contributors 2026.
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_VECTOR_VALUED_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_VECTOR_VALUED_HPP
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+#include <vector>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/core/enable_if.hpp>
+
+namespace boost{ namespace math{ namespace quadrature { namespace detail{
+
+//
+// Support for integrands which return several values at once, as a std::array or std::vector.
+//
+// The quadrature routines are all written in terms of a result type K which need only support
+// addition, subtraction, scaling by Real, and abs().  component_vector wraps the integrand's
+// container in exactly that interface: arithmetic is performed component by component, while abs()
+// returns the largest absolute value of any component.  So every abscissa is evaluated once for all
+// the components, and each routine's usual error test becomes a test on the max-norm of the error
+// relative to the max-norm of the result: no component is considered converged until they all are.
+//
+template <class T>
+struct is_vector_valued : public boost::false_type {};
+template <class T, std::size_t M>
+struct is_vector_valued<std::array<T, M> > : public boost::true_type {};
+template <class T, class Alloc>
+struct is_vector_valued<std::vector<T, Alloc> > : public boost::true_type {};
+
+// Used to remove the scalar overloads from the overload set when the integrand is vector valued, and vice versa:
+template <class K, class R = K>
+struct enable_if_scalar_valued : public boost::enable_if_c<!is_vector_valued<K>::value, R> {};
+template <class K, class R = K>
+struct enable_if_vector_valued : public boost::enable_if_c<is_vector_valued<K>::value, R> {};
+
+template <class Real, class Container>
+class component_vector
+{
+public:
+   typedef typename Container::value_type value_type;
+   //
+   // A scalar converts to a vector with every component equal to that scalar: the routines
+   // only ever do this with zero (and NaN on error).  Since the size of a std::vector isn't
+   // known until the integrand has been called, an empty container acts as a "broadcast"
+   // value until it is combined with a real one:
+   //
+   component_vector() : m_data(), m_fill(Real(0))
+   {
+      fill(m_data, m_fill);
+   }
+   template <class T>
+   component_vector(const T& x, typename boost::enable_if_c<boost::is_convertible<T, Real>::value>::type* = 0) : m_data(), m_fill(Real(x))
+   {
+      fill(m_data, m_fill);
+   }
+   explicit component_vector(const Container& c) : m_data(c), m_fill(Real(0)) {}
+
+   std::size_t size()const { return m_data.size(); }
+   const Container& data()const { return m_data; }
+
+   component_vector& operator+=(const component_vector& o)
+   {
+      return apply(o, [](value_type& x, const value_type& y) { x += y; });
+   }
+   component_vector& operator-=(const component_vector& o)
+   {
+      return apply(o, [](value_type& x, const value_type& y) { x -= y; });
+   }
+   component_vector& operator*=(const Real& s)
+   {
+      for (std::size_t i = 0; i < m_data.size(); ++i)
+         m_data[i] *= s;
+      m_fill *= s;
+      return *this;
+   }
+   component_vector& operator/=(const Real& s)
+   {
+      for (std::size_t i = 0; i < m_data.size(); ++i)
+         m_data[i] /= s;
+      m_fill /= s;
+      return *this;
+   }
+   component_vector operator-()const
+   {
+      component_vector r(*this);
+      r *= Real(-1);
+      return r;
+   }
+
+   friend component_vector operator+(component_vector a, const component_vector& b) { return a += b; }
+   friend component_vector operator-(component_vector a, const component_vector& b) { return a -= b; }
+   friend component_vector operator*(component_vector a, const Real& s) { return a *= s; }
+   friend component_vector operator*(const Real& s, component_vector a) { return a *= s; }
+   friend component_vector operator/(component_vector a, const Real& s) { return a /= s; }
+
+   // The max-norm:
+   friend Real abs(const component_vector& a)
+   {
+      using std::abs;
+      Real r = abs(a.m_fill);
+      if (a.m_data.size())
+      {
+         r = 0;
+         for (std::size_t i = 0; i < a.m_data.size(); ++i)
+         {
+            Real t = abs(a.m_data[i]);
+            // NaN's must propagate so that the error tests fail:
+            if (!(t <= r))
+               r = t;
+         }
+      }
+      return r;
+   }
+
+   template <class charT, class traits>
+   friend std::basic_ostream<charT, traits>& operator<<(std::basic_ostream<charT, traits>& os, const component_vector& a)
+   {
+      os << "{";
+      for (std::size_t i = 0; i < a.m_data.size(); ++i)
+         os << (i ? ", " : " ") << a.m_data[i];
+      return os << " }";
+   }
+
+private:
+   template <class Op>
+   component_vector& apply(const component_vector& o, Op op)
+   {
+      if (!m_data.size() && o.m_data.size())
+      {
+         value_type f = m_fill;
+         m_data = o.m_data;
+         fill(m_data, f);
+      }
+      if (o.m_data.size())
+      {
+         for (std::size_t i = 0; i < m_data.size(); ++i)
+            op(m_data[i], o.m_data[i]);
+      }
+      else
+      {
+         for (std::size_t i = 0; i < m_data.size(); ++i)
+            op(m_data[i], o.m_fill);
+      }
+      op(m_fill, o.m_fill);
+      return *this;
+   }
+   static void fill(Container& c, const value_type& x)
+   {
+      for (std::size_t i = 0; i < c.size(); ++i)
+         c[i] = x;
+   }
+
+   Container m_data;
+   value_type m_fill;
+};
+
+//
+// Adapts an integrand returning Container to one returning component_vector:
+//
+template <class Real, class F>
+struct vector_valued_integrand
+{
+   typedef decltype(std::declval<F>()(std::declval<Real>())) container_type;
+   typedef component_vector<Real, container_type> result_type;
+
+   explicit vector_valued_integrand(const F& f) : m_f(f) {}
+   result_type operator()(const Real& x)const { return result_type(m_f(x)); }
+
+   const F& m_f;
+};
+
+//
+// The result of an integration, converted back to the integrand's container type, whose shape is that of the values
+// the integrand returned.  The integrand is never called just to learn the shape, as any point might be a singularity.
+// So should the routine have returned without calling it at all (because the range is empty, or the bounds are
+// invalid), a std::vector result is empty, whereas a std::array is filled with the routine's scalar result:
+//
+template <class Real, class Container>
+Container vector_valued_result(const component_vector<Real, Container>& r)
+{
+   return r.data();
+}
+
+}}}}
+#endif
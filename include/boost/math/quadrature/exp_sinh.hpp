@@ -19,6 +19,7 @@
 #include <limits>
 #include <memory>
 #include <boost/math/quadrature/detail/exp_sinh_detail.hpp>
+#include <boost/math/quadrature/detail/shared_tables.hpp>
 
 namespace boost{ namespace math{ namespace quadrature {
 
@@ -28,19 +29,31 @@ class exp_sinh
 public:
    exp_sinh(size_t max_refinements = 9)
       : m_imp(std::make_shared<detail::exp_sinh_detail<Real, Policy>>(max_refinements)) {}
+   //
+   // Returns an integrator whose tables are fully computed and shared with every other integrator
+   // obtained from this function with the same max_refinements:
+   //
+   static exp_sinh shared(size_t max_refinements = 9)
+   {
+      typedef detail::exp_sinh_detail<Real, Policy> detail_type;
+      return exp_sinh(detail::shared_tables<detail_type, size_t>::get(max_refinements,
+         [&]() { return std::make_shared<detail_type>(max_refinements); }));
+   }
 
     template<class F>
-    auto integrate(const F& f, Real a, Real b, Real tol = boost::math::tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))  const;
+    auto integrate(const F& f, Real a, Real b, Real tol = boost::math::tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr, quadrature_statistics<Real>* stats = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))  const;
     template<class F>
-    auto integrate(const F& f, Real tol = boost::math::tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))  const;
+    auto integrate(const F& f, Real tol = boost::math::tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr, quadrature_statistics<Real>* stats = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))  const;
 
 private:
+    explicit exp_sinh(const std::shared_ptr<detail::exp_sinh_detail<Real, Policy>>& imp) : m_imp(imp) {}
+
     std::shared_ptr<detail::exp_sinh_detail<Real, Policy>> m_imp;
 };
 
 template<class Real, class Policy>
 template<class F>
-auto exp_sinh<Real, Policy>::integrate(const F& f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels)->decltype(std::declval<F>()(std::declval<Real>()))  const
+auto exp_sinh<Real, Policy>::integrate(const F& f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels, quadrature_statistics<Real>* stats)->decltype(std::declval<F>()(std::declval<Real>()))  const
 {
     typedef decltype(f(a)) K;
     using std::abs;
@@ -48,6 +61,7 @@ auto exp_sinh<Real, Policy>::integrate(const F& f, Real a, Real b, Real toleranc
     using boost::math::quadrature::detail::exp_sinh_detail;
 
     static const char* function = "boost::math::quadrature::exp_sinh<%1%>::integrate";
+    detail::quadrature_statistics_scope<Real> scope(stats);
 
     // Neither limit may be a NaN:
     if((boost::math::isnan)(a) || (boost::math::isnan)(b))
@@ -60,16 +74,16 @@ auto exp_sinh<Real, Policy>::integrate(const F& f, Real a, Real b, Real toleranc
         // If a = 0, don't use an additional level of indirection:
         if (a == (Real) 0)
         {
-            return m_imp->integrate(f, error, L1, function, tolerance, levels);
+            return m_imp->integrate(f, error, L1, function, tolerance, levels, stats);
         }
         const auto u = [&](Real t)->K { return f(t + a); };
-        return m_imp->integrate(u, error, L1, function, tolerance, levels);
+        return m_imp->integrate(u, error, L1, function, tolerance, levels, stats);
     }
 
     if ((boost::math::isfinite)(b) && a <= -boost::math::tools::max_value<Real>())
     {
         const auto u = [&](Real t)->K { return f(b-t);};
-        return m_imp->integrate(u, error, L1, function, tolerance, levels);
+        return m_imp->integrate(u, error, L1, function, tolerance, levels, stats);
     }
 
     // Infinite limits:
@@ -83,10 +97,11 @@ auto exp_sinh<Real, Policy>::integrate(const F& f, Real a, Real b, Real toleranc
 
 template<class Real, class Policy>
 template<class F>
-auto exp_sinh<Real, Policy>::integrate(const F& f, Real tolerance, Real* error, Real* L1, std::size_t* levels)->decltype(std::declval<F>()(std::declval<Real>())) const
+auto exp_sinh<Real, Policy>::integrate(const F& f, Real tolerance, Real* error, Real* L1, std::size_t* levels, quadrature_statistics<Real>* stats)->decltype(std::declval<F>()(std::declval<Real>())) const
 {
     static const char* function = "boost::math::quadrature::exp_sinh<%1%>::integrate";
-    return m_imp->integrate(f, error, L1, function, tolerance, levels);
+    detail::quadrature_statistics_scope<Real> scope(stats);
+    return m_imp->integrate(f, error, L1, function, tolerance, levels, stats);
 }
 
 
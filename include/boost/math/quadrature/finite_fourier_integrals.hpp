@@ -0,0 +1,223 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_FINITE_FOURIER_INTEGRALS_HPP
+#define BOOST_MATH_QUADRATURE_FINITE_FOURIER_INTEGRALS_HPP
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/quadrature/detail/mapped_integrand.hpp>
+#include <boost/math/quadrature/detail/shared_tables.hpp>
+#include <boost/math/quadrature/detail/tanh_sinh_detail.hpp>
+
+namespace boost { namespace math { namespace quadrature {
+
+namespace detail {
+//
+// A row of the tanh-sinh level loop for finite_fourier_integrals: f is evaluated once at each node t, and
+// w*f(t)*cos(omega*t) and w*f(t)*sin(omega*t) for every frequency are added straight into sums[0..2n), which
+// the caller provides and folds into its estimates after each row.  So nothing is allocated per node.
+// The level loop itself only tracks the L1 norm of f: finish() returns zero for the integral.
+//
+template<class Real, class F, class M>
+class finite_fourier_row
+{
+public:
+    typedef Real result_type;
+
+    finite_fourier_row(const F& f, const M& m, const std::vector<Real>& omegas, Real* sums)
+        : m_f(f), m_m(m), m_omegas(omegas), m_sums(sums), m_absum(0) {}
+
+    void add_origin(const Real& w)
+    {
+        node(Real(0), Real(1), w);
+    }
+    void add(const Real& x, const Real& xc, const Real& w, bool right, bool left)
+    {
+        if (right)
+            node(x, -xc, w);
+        if (left)
+            node(-x, xc, w);
+    }
+    Real finish(Real& absum)
+    {
+        absum = m_absum;
+        m_absum = 0;
+        return 0;
+    }
+
+private:
+    void node(const Real& z, const Real& zc, const Real& w)
+    {
+        using std::abs;
+        using std::cos;
+        using std::sin;
+        Real jacobian;
+        Real t = m_m.map(z, zc, jacobian);
+        Real y = w*m_f(t);
+        m_absum += abs(y);
+        for (std::size_t k = 0; k < m_omegas.size(); ++k)
+        {
+            Real phase = m_omegas[k]*t;
+            m_sums[2*k] += y*cos(phase);
+            m_sums[2*k + 1] += y*sin(phase);
+        }
+    }
+
+    const F& m_f;
+    const M& m_m;
+    const std::vector<Real>& m_omegas;
+    Real* m_sums;
+    Real m_absum;
+};
+}
+
+//
+// Computes the Fourier integrals of f over a finite interval [a, b] for many frequencies at once:
+//
+//   I(omega) = int_a^b f(t) exp(i omega t) dt,
+//
+// so that the real part of I(omega) is the cosine integral and the imaginary part the sine integral.
+// Unlike Ooura's method, whose nodes are scaled by 1/omega, the nodes are those of a tanh-sinh rule
+// on [a, b] and so are independent of the frequency: f is evaluated once per node, and the oscillatory
+// factors for every frequency are formed from that single value.  The refinement continues until the
+// integrals for all the frequencies have converged, so the number of levels needed grows roughly as
+// log2(max|omega|*(b - a)).
+//
+template<class Real, class Policy = policies::policy<> >
+class finite_fourier_integrals
+{
+public:
+    finite_fourier_integrals(size_t max_refinements = 15)
+    {
+        typedef detail::tanh_sinh_detail<Real, Policy> detail_type;
+        Real min_complement = tools::min_value<Real>() * 4;
+        m_imp = detail::shared_tables<detail_type, std::pair<size_t, Real> >::get(std::make_pair(max_refinements, min_complement),
+            [&]() { return std::make_shared<detail_type>(max_refinements, min_complement); });
+    }
+
+    template<class F>
+    std::vector<std::complex<Real>> integrate(F const & f, Real a, Real b, std::vector<Real> const & omegas, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr)
+    {
+        using std::abs;
+        using boost::math::constants::half;
+        using boost::math::constants::pi;
+        static const char* function = "boost::math::quadrature::finite_fourier_integrals<%1%>::integrate";
+        std::vector<std::complex<Real>> r(omegas.size());
+        if (!(boost::math::isfinite)(a) || !(boost::math::isfinite)(b))
+        {
+            Real x = policies::raise_domain_error(function, "The interval of integration must be finite, but got a bound of %1%; use ooura_fourier_sin or ooura_fourier_cos for half infinite intervals.", (boost::math::isfinite)(a) ? b : a, Policy());
+            std::fill(r.begin(), r.end(), std::complex<Real>(x, x));
+            return r;
+        }
+        Real sign = 1;
+        if (b < a)
+        {
+            std::swap(a, b);
+            sign = -1;
+        }
+        if (error)
+            *error = 0;
+        if (L1)
+            *L1 = 0;
+        if (levels)
+            *levels = 0;
+        if (omegas.empty() || (a == b))
+        {
+            return r;
+        }
+        detail::tanh_sinh_mapped_integrand<Real, const F&> u(f, a, b);
+        //
+        // The running sums of the current row, and the estimates from the last two levels, of the cosine and
+        // sine integrals interleaved, all in the one buffer:
+        //
+        std::size_t n = 2*omegas.size();
+        std::vector<Real> buffer(3*n);
+        Real* sums = buffer.data();
+        Real* I0 = sums + n;
+        Real* I1 = I0 + n;
+        detail::finite_fourier_row<Real, F, detail::tanh_sinh_mapped_integrand<Real, const F&> > row(f, u, omegas, sums);
+        detail::tanh_sinh_level_state<Real, Real> s(u.left_min_complement(), u.right_min_complement());
+        m_imp->first_level(row, s, nullptr);
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            I1[j] = sums[j]*s.h;
+            sums[j] = 0;
+        }
+        //
+        // The error of the tanh-sinh rule only falls steadily once the nodes resolve every oscillation.  Before that
+        // the estimates are little better than aliasing, and their differences may shrink or grow by chance, so the
+        // tests for convergence and for a rising error are only made once the widest spacing between the nodes,
+        // (b - a)*pi*h/4 at the middle of the interval, is at most 1/max|omega|:
+        //
+        Real max_omega = 0;
+        for (std::size_t k = 0; k < omegas.size(); ++k)
+            max_omega = (std::max)(max_omega, Real(abs(omegas[k])));
+        Real omega_range = max_omega*(b - a)*pi<Real>()/4;
+        Real err = 0;
+        Real last_err = 0;
+        unsigned thrash_count = 0;
+        while (m_imp->can_refine(s))
+        {
+            m_imp->refine_level(row, s, nullptr);
+            last_err = err;
+            err = 0;
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                I0[j] = I1[j];
+                I1[j] = half<Real>()*I0[j] + sums[j]*s.h;
+                sums[j] = 0;
+                err = (std::max)(err, Real(abs(I1[j] - I0[j])));
+            }
+            if (!(boost::math::isfinite)(err) || !(boost::math::isfinite)(s.L1_I1))
+            {
+                Real x = policies::raise_evaluation_error(function, "The tanh_sinh quadrature evaluated your function at a singular point and got %1%. Please narrow the bounds of integration or check your function for singularities.", (boost::math::isfinite)(err) ? s.L1_I1 : err, Policy());
+                std::fill(r.begin(), r.end(), std::complex<Real>(x, x));
+                return r;
+            }
+            if (omega_range*s.h > 1)
+            {
+                continue;
+            }
+            if (err <= abs(tolerance*s.L1_I1))
+            {
+                break;
+            }
+            if ((err > last_err) && (++thrash_count > 1))
+            {
+                // The error is growing even though the oscillations are resolved: keep the previous level.
+                std::copy(I0, I0 + n, I1);
+                err = last_err;
+                --s.k;
+                break;
+            }
+        }
+        Real scale = u.scale();
+        for (std::size_t k = 0; k < omegas.size(); ++k)
+        {
+            r[k] = std::complex<Real>(sign*scale*I1[2*k], sign*scale*I1[2*k + 1]);
+        }
+        if (error)
+            *error = scale*err;
+        if (L1)
+            *L1 = scale*s.L1_I1;
+        if (levels)
+            *levels = s.k;
+        return r;
+    }
+
+private:
+    std::shared_ptr<detail::tanh_sinh_detail<Real, Policy>> m_imp;
+};
+
+}}}
+#endif
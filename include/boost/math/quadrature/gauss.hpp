@@ -10,9 +10,13 @@
 #pragma once
 #endif
 
+#include <array>
+#include <type_traits>
 #include <vector>
 #include <boost/math/special_functions/legendre.hpp>
 #include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/detail/vector_valued.hpp>
+#include <boost/math/quadrature/detail/gauss_constexpr.hpp>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -74,6 +78,19 @@ class gauss_detail;
 
 #endif
 
+#ifdef BOOST_MATH_HAS_CONSTEXPR_GAUSS_NODES
+//
+// float and double rules of up to BOOST_MATH_GAUSS_CONSTEXPR_MAX_POINTS points which aren't tabulated below
+// are computed at compile time, and larger ones on demand as for other types:
+//
+template <class Real, unsigned N>
+class gauss_detail<Real, N, 0>
+   : public std::conditional<(N <= BOOST_MATH_GAUSS_CONSTEXPR_MAX_POINTS), gauss_constexpr_detail<Real, N>, gauss_detail<Real, N, 999> >::type {};
+template <class Real, unsigned N>
+class gauss_detail<Real, N, 1>
+   : public std::conditional<(N <= BOOST_MATH_GAUSS_CONSTEXPR_MAX_POINTS), gauss_constexpr_detail<Real, N>, gauss_detail<Real, N, 999> >::type {};
+#endif
+
 template <class T>
 class gauss_detail<T, 7, 0>
 {
@@ -1164,6 +1181,76 @@ public:
    }
 };
 
+//
+// Unfolds a table over the non-negative nodes into one over the whole of [-1, 1] in increasing order
+// of the nodes: sign is -1 for the abscissa and +1 for the weights.  If N is odd the first entry
+// of the table is the one at zero, and isn't repeated:
+//
+template <class Real, unsigned N, class Table>
+std::array<Real, N> gauss_unfold_table(const Table& half, Real sign)
+{
+   std::array<Real, N> result;
+   unsigned m = static_cast<unsigned>(half.size());
+   unsigned j = 0;
+   for (unsigned i = m; i > (N & 1); --i)
+      result[j++] = sign * half[i - 1];
+   for (unsigned i = 0; i < m; ++i)
+      result[j++] = half[i];
+   return result;
+}
+
+//
+// The rule over the whole of [-1, 1], rather than just the non-negative half, so that a vectorized
+// integrand can be handed every abscissa at once and the weighted sums taken over contiguous arrays:
+//
+template <class Real, unsigned N, class Rule>
+class gauss_full_rule
+{
+public:
+   static const std::array<Real, N>& abscissa()
+   {
+      static const std::array<Real, N> data = gauss_unfold_table<Real, N>(Rule::abscissa(), Real(-1));
+      return data;
+   }
+   static const std::array<Real, N>& weights()
+   {
+      static const std::array<Real, N> data = gauss_unfold_table<Real, N>(Rule::weights(), Real(1));
+      return data;
+   }
+};
+
+//
+// Returns the sum of w[i]*y[i] and sets L1 to the sum of w[i]*|y[i]|.  Four independent partial
+// sums break the dependency chain of a single accumulator, so that the loop can be pipelined and
+// vectorized by the compiler:
+//
+template <class Real>
+Real gauss_weighted_sum(const Real* y, const Real* w, std::size_t n, Real& L1)
+{
+   using std::abs;
+   Real s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+   Real l0 = 0, l1 = 0, l2 = 0, l3 = 0;
+   std::size_t i = 0;
+   for (; i + 4 <= n; i += 4)
+   {
+      s0 += w[i] * y[i];
+      s1 += w[i + 1] * y[i + 1];
+      s2 += w[i + 2] * y[i + 2];
+      s3 += w[i + 3] * y[i + 3];
+      l0 += w[i] * abs(y[i]);
+      l1 += w[i + 1] * abs(y[i + 1]);
+      l2 += w[i + 2] * abs(y[i + 2]);
+      l3 += w[i + 3] * abs(y[i + 3]);
+   }
+   for (; i < n; ++i)
+   {
+      s0 += w[i] * y[i];
+      l0 += w[i] * abs(y[i]);
+   }
+   L1 = (l0 + l1) + (l2 + l3);
+   return (s0 + s1) + (s2 + s3);
+}
+
 }
 
 template <class Real, unsigned N, class Policy = boost::math::policies::policy<> >
@@ -1173,7 +1260,7 @@ class gauss : public detail::gauss_detail<Real, N, detail::gauss_constant_catego
 public:
 
    template <class F>
-   static auto integrate(F f, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+   static auto integrate(F f, Real* pL1 = nullptr)->typename detail::enable_if_scalar_valued<decltype(std::declval<F>()(std::declval<Real>()))>::type
    {
      // In many math texts, K represents the field of real or complex numbers.
      // Too bad we can't put blackboard bold into C++ source!
@@ -1201,7 +1288,7 @@ public:
       return result;
    }
    template <class F>
-   static auto integrate(F f, Real a, Real b, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+   static auto integrate(F f, Real a, Real b, Real* pL1 = nullptr)->typename detail::enable_if_scalar_valued<decltype(std::declval<F>()(std::declval<Real>()))>::type
    {
       typedef decltype(f(a)) K;
       static const char* function = "boost::math::quadrature::gauss<%1%>::integrate(f, %1%, %1%)";
@@ -1284,6 +1371,141 @@ public:
       }
       return static_cast<K>(policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy()));
    }
+   //
+   // Integrands returning a std::array or std::vector: each abscissa is evaluated once for all
+   // the components, and *pL1 is the L1 norm of the largest absolute value of any component:
+   //
+   template <class F>
+   static auto integrate(F f, Real* pL1 = nullptr)->typename detail::enable_if_vector_valued<decltype(std::declval<F>()(std::declval<Real>()))>::type
+   {
+      detail::vector_valued_integrand<Real, F> g(f);
+      return detail::vector_valued_result(integrate(g, pL1));
+   }
+   template <class F>
+   static auto integrate(F f, Real a, Real b, Real* pL1 = nullptr)->typename detail::enable_if_vector_valued<decltype(std::declval<F>()(std::declval<Real>()))>::type
+   {
+      detail::vector_valued_integrand<Real, F> g(f);
+      return detail::vector_valued_result(integrate(g, a, b, pL1));
+   }
+   //
+   // Vectorized integrand: f(x, y, n) is called once with all N abscissa values in x[0..n), and must
+   // store f(x[i]) in y[i].  The weighted sums are then taken over contiguous arrays:
+   //
+   template <class F>
+   static auto integrate(F f, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<const Real*>(), std::declval<Real*>(), std::declval<std::size_t>()), Real())
+   {
+      typedef detail::gauss_full_rule<Real, N, base> rule;
+      std::array<Real, N> y;
+      f(rule::abscissa().data(), y.data(), std::size_t(N));
+      Real L1;
+      Real result = detail::gauss_weighted_sum(y.data(), rule::weights().data(), N, L1);
+      if (pL1)
+         *pL1 = L1;
+      return result;
+   }
+   template <class F>
+   static auto integrate(F f, Real a, Real b, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<const Real*>(), std::declval<Real*>(), std::declval<std::size_t>()), Real())
+   {
+      static const char* function = "boost::math::quadrature::gauss<%1%>::integrate(f, %1%, %1%)";
+      //
+      // The changes of variable are exactly those used by the scalar version above, except that the
+      // Jacobian is folded into the weights:
+      //
+      if (!(boost::math::isnan)(a) && !(boost::math::isnan)(b))
+      {
+         Real min_inf = -tools::max_value<Real>();
+         if ((a <= min_inf) && (b >= tools::max_value<Real>()))
+         {
+            auto m = [](const Real& t, Real& jacobian)->Real
+            {
+               Real t_sq = t*t;
+               Real inv = 1 / (1 - t_sq);
+               jacobian = (1 + t_sq)*inv*inv;
+               return t*inv;
+            };
+            return integrate_mapped_vectorized(f, m, pL1);
+         }
+
+         if ((boost::math::isfinite)(a) && (b >= tools::max_value<Real>()))
+         {
+            auto m = [&](const Real& t, Real& jacobian)->Real
+            {
+               Real z = 1 / (t + 1);
+               jacobian = z*z;
+               return 2 * z + a - 1;
+            };
+            Real Q = 2 * integrate_mapped_vectorized(f, m, pL1);
+            if (pL1)
+            {
+               *pL1 *= 2;
+            }
+            return Q;
+         }
+
+         if ((boost::math::isfinite)(b) && (a <= -tools::max_value<Real>()))
+         {
+            auto m = [&](const Real& t, Real& jacobian)->Real
+            {
+               Real z = 1 / (t + 1);
+               jacobian = z*z;
+               return b - (2 * z - 1);
+            };
+            Real Q = 2 * integrate_mapped_vectorized(f, m, pL1);
+            if (pL1)
+            {
+               *pL1 *= 2;
+            }
+            return Q;
+         }
+
+         if ((boost::math::isfinite)(a) && (boost::math::isfinite)(b))
+         {
+            if (a == b)
+            {
+               return Real(0);
+            }
+            if (b < a)
+            {
+               return -integrate(f, b, a, pL1);
+            }
+            typedef detail::gauss_full_rule<Real, N, base> rule;
+            Real avg = (a + b)*constants::half<Real>();
+            Real scale = (b - a)*constants::half<Real>();
+            std::array<Real, N> x, y;
+            for (unsigned i = 0; i < N; ++i)
+               x[i] = avg + scale * rule::abscissa()[i];
+            f(x.data(), y.data(), std::size_t(N));
+            Real L1;
+            Real Q = scale * detail::gauss_weighted_sum(y.data(), rule::weights().data(), N, L1);
+            if (pL1)
+            {
+               *pL1 = L1 * scale;
+            }
+            return Q;
+         }
+      }
+      return policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy());
+   }
+
+private:
+   template <class F, class M>
+   static Real integrate_mapped_vectorized(F& f, const M& m, Real* pL1)
+   {
+      typedef detail::gauss_full_rule<Real, N, base> rule;
+      std::array<Real, N> x, y, w;
+      for (unsigned i = 0; i < N; ++i)
+      {
+         Real jacobian;
+         x[i] = m(rule::abscissa()[i], jacobian);
+         w[i] = rule::weights()[i] * jacobian;
+      }
+      f(x.data(), y.data(), std::size_t(N));
+      Real L1;
+      Real result = detail::gauss_weighted_sum(y.data(), w.data(), N, L1);
+      if (pL1)
+         *pL1 = L1;
+      return result;
+   }
 };
 
 } // namespace quadrature
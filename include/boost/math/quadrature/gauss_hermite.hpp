@@ -0,0 +1,119 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ * Gauss-Hermite quadrature: the n point rule for integrals of the form
+ *
+ *    \int_{-\infty}^{\infty} e^{-x^2} f(x) dx,
+ *
+ * which is exact when f is a polynomial of degree at most 2n - 1.  Expectations under a normal distribution
+ * are integrals of this form, and are provided directly.
+ *
+ * The nodes are the zeros of the Hermite polynomial H_n, found as the eigenvalues of the Jacobi matrix and then
+ * polished by Newton iteration, and the rules are computed once per order and type and cached.
+ */
+
+#ifndef BOOST_MATH_QUADRATURE_GAUSS_HERMITE_HPP
+#define BOOST_MATH_QUADRATURE_GAUSS_HERMITE_HPP
+
+#include <cmath>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/quadrature/detail/gauss_rule_generator.hpp>
+
+namespace boost{ namespace math{ namespace quadrature {
+
+namespace detail{
+
+// The recurrence for the polynomials orthonormal with respect to e^{-x^2}:
+template<class Real>
+struct hermite_recurrence
+{
+   Real a(unsigned) const { return 0; }
+   Real sqrt_b(unsigned k) const { using std::sqrt; return sqrt(Real(k) / 2); }
+   Real mu0() const { return constants::root_pi<Real>(); }
+};
+
+template<class Real, class Policy>
+std::shared_ptr<const gauss_rule<Real>> make_gauss_hermite_rule(unsigned n)
+{
+   static const char* function = "boost::math::quadrature::gauss_hermite<%1%>::gauss_hermite";
+   // Generated at the evaluation precision of the policy, so that float rules of high order do not overflow:
+   typedef typename policies::evaluation<Real, Policy>::type value_type;
+   std::shared_ptr<const gauss_rule<Real>> rule = make_gauss_rule<Real, value_type>(hermite_recurrence<value_type>(), n, function, Policy());
+   // Make the rule exactly symmetric:
+   std::shared_ptr<gauss_rule<Real>> symmetric(new gauss_rule<Real>(*rule));
+   for (unsigned i = 0; i < n / 2; ++i)
+   {
+      symmetric->abscissa[i] = -symmetric->abscissa[n - 1 - i];
+      symmetric->weights[i] = symmetric->weights[n - 1 - i];
+   }
+   if (n & 1)
+   {
+      symmetric->abscissa[n / 2] = 0;
+   }
+   return symmetric;
+}
+
+}
+
+template<class Real, class Policy = boost::math::policies::policy<> >
+class gauss_hermite
+{
+public:
+   typedef Real value_type;
+
+   explicit gauss_hermite(unsigned n)
+   {
+      static const char* function = "boost::math::quadrature::gauss_hermite<%1%>::gauss_hermite";
+      if (n == 0)
+      {
+         policies::raise_domain_error(function, "The order of the rule must be at least one, but got n = %1%.", Real(n), Policy());
+         n = 1;
+      }
+      m_rule = detail::gauss_rule_cache<Real, Policy, unsigned>::get(n, [n]() { return detail::make_gauss_hermite_rule<Real, Policy>(n); });
+   }
+
+   //
+   // \int_{-\infty}^{\infty} e^{-x^2} f(x) dx, and optionally the same integral of |f|:
+   //
+   template<class F>
+   auto integrate(F f, Real* pL1 = nullptr) const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      return detail::gauss_rule_sum(*m_rule, f, pL1);
+   }
+
+   //
+   // The expected value of f(X) where X is normally distributed with mean mu and standard deviation sigma:
+   //
+   template<class F>
+   auto expectation(F f, Real mu = 0, Real sigma = 1) const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      typedef decltype(f(mu)) K;
+      static const char* function = "boost::math::quadrature::gauss_hermite<%1%>::expectation";
+      if (!(boost::math::isfinite)(mu))
+      {
+         return static_cast<K>(policies::raise_domain_error(function, "The mean must be finite, but got mu = %1%.", mu, Policy()));
+      }
+      if (!(boost::math::isfinite)(sigma) || (sigma < 0))
+      {
+         return static_cast<K>(policies::raise_domain_error(function, "The standard deviation must be finite and non-negative, but got sigma = %1%.", sigma, Policy()));
+      }
+      Real scale = constants::root_two<Real>() * sigma;
+      auto g = [&](Real x)->K { return f(mu + scale * x); };
+      return detail::gauss_rule_sum(*m_rule, g, static_cast<Real*>(nullptr)) / constants::root_pi<Real>();
+   }
+
+   const std::vector<Real>& abscissa() const { return m_rule->abscissa; }
+   const std::vector<Real>& weights() const { return m_rule->weights; }
+   unsigned order() const { return static_cast<unsigned>(m_rule->abscissa.size()); }
+
+private:
+   std::shared_ptr<const detail::gauss_rule<Real>> m_rule;
+};
+
+}}}
+#endif
@@ -0,0 +1,167 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ * Gauss-Jacobi quadrature: the n point rule for integrals of the form
+ *
+ *    \int_{-1}^{1} (1-x)^{\alpha} (1+x)^{\beta} f(x) dx,   \alpha, \beta > -1,
+ *
+ * which is exact when f is a polynomial of degree at most 2n - 1.  Integrable algebraic singularities at
+ * the endpoints are thereby removed from the integrand altogether.
+ *
+ * The nodes are the zeros of the Jacobi polynomial P_n^{(\alpha, \beta)}, found as the eigenvalues of the Jacobi
+ * matrix and then polished by Newton iteration, and the rules are computed once per order, parameters and type and cached.
+ */
+
+#ifndef BOOST_MATH_QUADRATURE_GAUSS_JACOBI_HPP
+#define BOOST_MATH_QUADRATURE_GAUSS_JACOBI_HPP
+
+#include <cmath>
+#include <tuple>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/special_functions/beta.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/quadrature/detail/gauss_rule_generator.hpp>
+
+namespace boost{ namespace math{ namespace quadrature {
+
+namespace detail{
+
+// The recurrence for the polynomials orthonormal with respect to (1-x)^alpha (1+x)^beta on [-1, 1]:
+template<class Real, class Policy>
+struct jacobi_recurrence
+{
+   jacobi_recurrence(Real alpha, Real beta) : m_alpha(alpha), m_beta(beta) {}
+   Real a(unsigned k) const
+   {
+      if (k == 0)
+      {
+         return (m_beta - m_alpha) / (m_alpha + m_beta + 2);
+      }
+      Real s = 2 * k + m_alpha + m_beta;
+      return (m_beta - m_alpha) * (m_beta + m_alpha) / (s * (s + 2));
+   }
+   Real sqrt_b(unsigned k) const
+   {
+      using std::sqrt;
+      Real s = 2 * k + m_alpha + m_beta;
+      if (k == 1)
+      {
+         // The general expression is 0/0 when alpha + beta = -1:
+         return sqrt(4 * (1 + m_alpha) * (1 + m_beta) / (s * s * (s + 1)));
+      }
+      return sqrt(4 * k * (k + m_alpha) * (k + m_beta) * (k + m_alpha + m_beta) / (s * s * (s + 1) * (s - 1)));
+   }
+   Real mu0() const
+   {
+      using std::pow;
+      return pow(Real(2), m_alpha + m_beta + 1) * boost::math::beta(m_alpha + 1, m_beta + 1, Policy());
+   }
+   Real m_alpha;
+   Real m_beta;
+};
+
+template<class Real, class Policy>
+std::shared_ptr<const gauss_rule<Real>> make_gauss_jacobi_rule(unsigned n, Real alpha, Real beta)
+{
+   static const char* function = "boost::math::quadrature::gauss_jacobi<%1%>::gauss_jacobi";
+   typedef typename policies::evaluation<Real, Policy>::type value_type;
+   return make_gauss_rule<Real, value_type>(jacobi_recurrence<value_type, Policy>(alpha, beta), n, function, Policy());
+}
+
+}
+
+template<class Real, class Policy = boost::math::policies::policy<> >
+class gauss_jacobi
+{
+public:
+   typedef Real value_type;
+
+   gauss_jacobi(unsigned n, Real alpha, Real beta) : m_alpha(alpha), m_beta(beta)
+   {
+      static const char* function = "boost::math::quadrature::gauss_jacobi<%1%>::gauss_jacobi";
+      if (n == 0)
+      {
+         policies::raise_domain_error(function, "The order of the rule must be at least one, but got n = %1%.", Real(n), Policy());
+         n = 1;
+      }
+      if (!(boost::math::isfinite)(alpha) || (alpha <= -1))
+      {
+         m_alpha = policies::raise_domain_error(function, "The parameter alpha must be finite and greater than -1, but got alpha = %1%.", alpha, Policy());
+         return;
+      }
+      if (!(boost::math::isfinite)(beta) || (beta <= -1))
+      {
+         m_beta = policies::raise_domain_error(function, "The parameter beta must be finite and greater than -1, but got beta = %1%.", beta, Policy());
+         return;
+      }
+      m_rule = detail::gauss_rule_cache<Real, Policy, std::tuple<unsigned, Real, Real>>::get(std::make_tuple(n, alpha, beta), [n, alpha, beta]() { return detail::make_gauss_jacobi_rule<Real, Policy>(n, alpha, beta); });
+   }
+
+   //
+   // \int_{-1}^{1} (1-x)^{\alpha} (1+x)^{\beta} f(x) dx, and optionally the same integral of |f|:
+   //
+   template<class F>
+   auto integrate(F f, Real* pL1 = nullptr) const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      typedef decltype(f(Real(0))) K;
+      if (!m_rule)
+      {
+         return static_cast<K>(std::numeric_limits<Real>::quiet_NaN());
+      }
+      return detail::gauss_rule_sum(*m_rule, f, pL1);
+   }
+
+   //
+   // \int_{a}^{b} (b-x)^{\alpha} (x-a)^{\beta} f(x) dx, and optionally the same integral of |f|:
+   //
+   template<class F>
+   auto integrate(F f, Real a, Real b, Real* pL1 = nullptr) const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      using std::pow;
+      typedef decltype(f(a)) K;
+      static const char* function = "boost::math::quadrature::gauss_jacobi<%1%>::integrate";
+      if (!(boost::math::isfinite)(a) || !(boost::math::isfinite)(b) || (b < a))
+      {
+         return static_cast<K>(policies::raise_domain_error(function, "The interval of integration must be finite with a <= b, but got a = %1%.", a, Policy()));
+      }
+      if (!m_rule)
+      {
+         return static_cast<K>(std::numeric_limits<Real>::quiet_NaN());
+      }
+      if (a == b)
+      {
+         return K(0);
+      }
+      Real avg = (a + b) * constants::half<Real>();
+      Real scale = (b - a) * constants::half<Real>();
+      auto g = [&](Real t)->K { return f(avg + scale * t); };
+      Real jacobian = pow(scale, m_alpha + m_beta + 1);
+      K Q = detail::gauss_rule_sum(*m_rule, g, pL1);
+      if (pL1)
+      {
+         *pL1 *= jacobian;
+      }
+      return jacobian * Q;
+   }
+
+   // Empty if the parameters passed to the constructor were invalid:
+   const std::vector<Real>& abscissa() const { return rule().abscissa; }
+   const std::vector<Real>& weights() const { return rule().weights; }
+   unsigned order() const { return static_cast<unsigned>(rule().abscissa.size()); }
+   Real alpha() const { return m_alpha; }
+   Real beta() const { return m_beta; }
+
+private:
+   const detail::gauss_rule<Real>& rule() const { return m_rule ? *m_rule : detail::empty_gauss_rule<Real>(); }
+
+   Real m_alpha;
+   Real m_beta;
+   std::shared_ptr<const detail::gauss_rule<Real>> m_rule;
+};
+
+}}}
+#endif
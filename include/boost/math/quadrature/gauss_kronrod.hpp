@@ -13,10 +13,14 @@
 #pragma warning(disable: 4127)
 #endif
 
+#include <algorithm>
+#include <array>
 #include <vector>
 #include <boost/math/special_functions/legendre.hpp>
 #include <boost/math/special_functions/legendre_stieltjes.hpp>
 #include <boost/math/quadrature/gauss.hpp>
+#include <boost/math/quadrature/quadrature_statistics.hpp>
+#include <boost/math/quadrature/detail/mapped_integrand.hpp>
 
 namespace boost { namespace math{ namespace quadrature{ namespace detail{
 
@@ -32,7 +36,7 @@ class gauss_kronrod_detail
    }
    static std::vector<Real> calculate_abscissa()
    {
-      static std::vector<Real> result = boost::math::legendre_p_zeros<Real>((N - 1) / 2);
+      std::vector<Real> result = boost::math::legendre_p_zeros<Real>((N - 1) / 2);
       const legendre_stieltjes<Real> E = get_legendre_stieltjes();
       std::vector<Real> ls_zeros = E.zeros();
       result.insert(result.end(), ls_zeros.begin(), ls_zeros.end());
@@ -1764,6 +1768,197 @@ public:
 
 }
 
+namespace detail {
+
+template<class Real, class K>
+struct gauss_kronrod_interval
+{
+   Real a;
+   Real b;
+   K estimate;
+   Real error;
+   Real L1;
+   unsigned depth;
+};
+
+//
+// The state of a globally adaptive integration: every subinterval lives in a single arena (a vector
+// which is sized up front when a capacity is given, and otherwise only ever grows), and a heap of indexes
+// into the arena keeps the interval with the largest error on top.  Ties are broken on the index, so the
+// order of refinement never depends on the order in which intervals were pushed.
+//
+template<class Real, class K>
+class gauss_kronrod_interval_heap
+{
+public:
+   typedef gauss_kronrod_interval<Real, K> interval_type;
+
+   gauss_kronrod_interval_heap(const interval_type& root, unsigned max_depth, std::size_t capacity = 0)
+      : m_total(root.estimate), m_total_error(root.error), m_frozen_error(0), m_max_depth(max_depth)
+   {
+      m_intervals.reserve(capacity);
+      m_heap.reserve(capacity);
+      m_intervals.push_back(root);
+      if (root.depth < max_depth)
+         m_heap.push_back(0);
+   }
+
+   bool empty() const { return m_heap.empty(); }
+   std::size_t size() const { return m_intervals.size(); }
+   const interval_type& operator[](std::size_t i) const { return m_intervals[i]; }
+   //
+   // We're done when the total error meets the tolerance, or when the error is dominated by intervals that
+   // have reached max_depth: those errors can't be reduced any further, so once the refinable intervals
+   // contribute less than the frozen ones there's no point in continuing (and carrying on until the heap is
+   // empty would bisect every interval down to max_depth):
+   //
+   bool converged(Real tol) const
+   {
+      using std::abs;
+      return (m_total_error <= abs(m_total * tol)) || (m_total_error <= 2 * m_frozen_error);
+   }
+   // Removes the interval with the largest error from the heap, and returns its index:
+   std::size_t pop()
+   {
+      std::pop_heap(m_heap.begin(), m_heap.end(), compare(this));
+      std::size_t i = m_heap.back();
+      m_heap.pop_back();
+      return i;
+   }
+   // Replaces the interval at index parent with its two halves:
+   void replace(std::size_t parent, const interval_type& left, const interval_type& right)
+   {
+      m_total -= m_intervals[parent].estimate;
+      m_total_error -= m_intervals[parent].error;
+      m_intervals[parent] = left;
+      m_intervals.push_back(right);
+      m_total += left.estimate + right.estimate;
+      m_total_error += left.error + right.error;
+      if (left.depth < m_max_depth)
+      {
+         m_heap.push_back(parent);
+         std::push_heap(m_heap.begin(), m_heap.end(), compare(this));
+         m_heap.push_back(m_intervals.size() - 1);
+         std::push_heap(m_heap.begin(), m_heap.end(), compare(this));
+      }
+      else
+         m_frozen_error += left.error + right.error;
+   }
+   //
+   // The running totals are only used for the termination test, the final result is always
+   // summed in arena order so that it doesn't depend on the order of the updates:
+   //
+   K sum(Real* error, Real* pL1) const
+   {
+      K Q = 0;
+      Real err = 0;
+      Real L1 = 0;
+      for (std::size_t i = 0; i < m_intervals.size(); ++i)
+      {
+         Q += m_intervals[i].estimate;
+         err += m_intervals[i].error;
+         L1 += m_intervals[i].L1;
+      }
+      if (error)
+         *error = err;
+      if (pL1)
+         *pL1 = L1;
+      return Q;
+   }
+
+private:
+   struct compare
+   {
+      explicit compare(const gauss_kronrod_interval_heap* p) : self(p) {}
+      bool operator()(std::size_t i, std::size_t j) const
+      {
+         const interval_type& x = self->m_intervals[i];
+         const interval_type& y = self->m_intervals[j];
+         if (x.error != y.error)
+            return x.error < y.error;
+         return i > j;
+      }
+      const gauss_kronrod_interval_heap* self;
+   };
+
+   std::vector<interval_type> m_intervals;
+   std::vector<std::size_t> m_heap;
+   K m_total;
+   Real m_total_error;
+   Real m_frozen_error;
+   unsigned m_max_depth;
+};
+
+//
+// The Kronrod rule over the whole of [-1, 1], along with the weights of the embedded Gauss rule
+// at the same nodes (zero at the nodes which are Kronrod's alone):
+//
+template <class Real, unsigned N, class Rule, class GaussRule>
+class gauss_kronrod_full_rule
+{
+   static std::vector<Real> gauss_half_weights()
+   {
+      std::size_t m = Rule::abscissa().size();
+      std::vector<Real> result(m, Real(0));
+      // The Gauss nodes are the even numbered ones if the Gauss order is odd, and the odd numbered ones otherwise:
+      unsigned gauss_start = ((N - 1) / 2) & 1 ? 0 : 1;
+      for (std::size_t i = gauss_start; i < m; i += 2)
+         result[i] = GaussRule::weights()[i / 2];
+      return result;
+   }
+public:
+   static const std::array<Real, N>& abscissa()
+   {
+      static const std::array<Real, N> data = gauss_unfold_table<Real, N>(Rule::abscissa(), Real(-1));
+      return data;
+   }
+   static const std::array<Real, N>& weights()
+   {
+      static const std::array<Real, N> data = gauss_unfold_table<Real, N>(Rule::weights(), Real(1));
+      return data;
+   }
+   static const std::array<Real, N>& gauss_weights()
+   {
+      static const std::array<Real, N> data = gauss_unfold_table<Real, N>(gauss_half_weights(), Real(1));
+      return data;
+   }
+};
+
+//
+// Returns the Kronrod sum of y, and sets gauss to the Gauss sum and L1 to the Kronrod sum of |y|.
+// As for gauss_weighted_sum, the partial sums are independent so that the loop may be vectorized:
+//
+template <class Real>
+Real gauss_kronrod_weighted_sums(const Real* y, const Real* kronrod_weights, const Real* gauss_weights, std::size_t n, Real& gauss, Real& L1)
+{
+   using std::abs;
+   Real k0 = 0, k1 = 0, g0 = 0, g1 = 0, l0 = 0, l1 = 0;
+   std::size_t i = 0;
+   for (; i + 2 <= n; i += 2)
+   {
+      k0 += kronrod_weights[i] * y[i];
+      k1 += kronrod_weights[i + 1] * y[i + 1];
+      g0 += gauss_weights[i] * y[i];
+      g1 += gauss_weights[i + 1] * y[i + 1];
+      l0 += kronrod_weights[i] * abs(y[i]);
+      l1 += kronrod_weights[i + 1] * abs(y[i + 1]);
+   }
+   for (; i < n; ++i)
+   {
+      k0 += kronrod_weights[i] * y[i];
+      g0 += gauss_weights[i] * y[i];
+      l0 += kronrod_weights[i] * abs(y[i]);
+   }
+   gauss = g0 + g1;
+   L1 = l0 + l1;
+   return k0 + k1;
+}
+
+}
+
+template <class Real, unsigned N, class Policy>
+class parallel_gauss_kronrod;
+
 template <class Real, unsigned N, class Policy = boost::math::policies::policy<> >
 class gauss_kronrod : public detail::gauss_kronrod_detail<Real, N, detail::gauss_constant_category<Real>::value>
 {
@@ -1771,6 +1966,8 @@ class gauss_kronrod : public detail::gauss_kronrod_detail<Real, N, detail::gauss
 public:
   typedef Real value_type;
 private:
+   template <class, unsigned, class> friend class parallel_gauss_kronrod;
+
    template <class F>
    static auto integrate_non_adaptive_m1_1(F f, Real* error = nullptr, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
    {
@@ -1823,6 +2020,8 @@ private:
    {
       F f;
       Real tol;
+      unsigned max_depth;
+      quadrature_statistics<Real>* stats;
    };
 
    template <class F>
@@ -1839,6 +2038,8 @@ private:
       };
       K r1 = integrate_non_adaptive_m1_1(ff, &error_local, L1);
       K estimate = scale * r1;
+      if (info->stats)
+         info->stats->evaluations += N;
 
       K tmp = estimate * info->tol;
       Real abs_tol1 = abs(tmp);
@@ -1861,15 +2062,108 @@ private:
          *L1 *= scale;
       if (error)
          *error = error_local;
+      if (info->stats)
+      {
+         std::size_t depth = info->max_depth - max_levels;
+         ++info->stats->intervals;
+         info->stats->levels = (std::max)(info->stats->levels, depth);
+         if (info->stats->errors.size() <= depth)
+            info->stats->errors.resize(depth + 1, Real(0));
+         info->stats->errors[depth] += error_local;
+      }
       return estimate;
    }
 
-public:
+   //
+   // Non-adaptive quadrature over the interval [I.a, I.b], fills in the estimate, error and L1 norm:
+   //
+   template <class F, class Interval>
+   static void integrate_interval(const F& f, Interval& I)
+   {
+      typedef decltype(f(I.a)) K;
+      Real mean = (I.b + I.a) / 2;
+      Real scale = (I.b - I.a) / 2;
+      auto ff = [&](const Real& x)->K
+      {
+         return f(scale * x + mean);
+      };
+      I.estimate = scale * integrate_non_adaptive_m1_1(ff, &I.error, &I.L1);
+      I.error *= scale;
+      I.L1 *= scale;
+   }
+
+   template <class F, class Interval>
+   static void bisect(const F& f, const Interval& parent, Interval& left, Interval& right)
+   {
+      Real mid = (parent.a + parent.b) / 2;
+      left.a = parent.a;
+      left.b = mid;
+      left.depth = parent.depth + 1;
+      right.a = mid;
+      right.b = parent.b;
+      right.depth = parent.depth + 1;
+      integrate_interval(f, left);
+      integrate_interval(f, right);
+   }
+
    template <class F>
-   static auto integrate(F f, Real a, Real b, unsigned max_depth = 15, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+   static auto global_adaptive_integrate(const F& f, Real a, Real b, unsigned max_depth, Real tol, std::size_t max_intervals, Real* error, Real* pL1)->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      typedef decltype(f(a)) K;
+      typedef detail::gauss_kronrod_interval_heap<Real, K> heap_type;
+      typedef typename heap_type::interval_type interval_type;
+
+      interval_type root, left, right;
+      root.a = a;
+      root.b = b;
+      root.depth = 0;
+      integrate_interval(f, root);
+      heap_type heap(root, max_depth, max_intervals);
+      while (!heap.empty() && !heap.converged(tol) && (heap.size() < max_intervals))
+      {
+         std::size_t parent = heap.pop();
+         bisect(f, heap[parent], left, right);
+         heap.replace(parent, left, right);
+      }
+      return heap.sum(error, pL1);
+   }
+
+   struct serial_driver
+   {
+      unsigned max_depth;
+      Real tol;
+      quadrature_statistics<Real>* stats;
+      template <class F>
+      auto operator()(const F& f, Real a, Real b, Real* error, Real* pL1) const ->decltype(std::declval<F>()(std::declval<Real>()))
+      {
+         recursive_info<F> info = { f, tol, max_depth, stats };
+         return recursive_adaptive_integrate(&info, a, b, max_depth, Real(0), error, pL1);
+      }
+   };
+
+   struct global_driver
+   {
+      unsigned max_depth;
+      Real tol;
+      std::size_t max_intervals;
+      template <class F>
+      auto operator()(const F& f, Real a, Real b, Real* error, Real* pL1) const ->decltype(std::declval<F>()(std::declval<Real>()))
+      {
+         return global_adaptive_integrate(f, a, b, max_depth, tol, max_intervals, error, pL1);
+      }
+   };
+
+   //
+   // Maps the range [a,b] to a finite one, and calls driver(g, a, b, error, pL1) to perform the actual
+   // integration of the transformed integrand g over a finite range with a < b.  The drivers are
+   // serial_driver for integrate(), global_driver for integrate_global(), and parallel_gauss_kronrod's.
+   // On half infinite ranges the result and L1 norm are doubled, and so is the error estimate when
+   // scale_error is set.  integrate() has always returned the unscaled error there, and still does:
+   //
+   template <class F, class Driver>
+   static auto integrate_mapped(F f, Real a, Real b, const Driver& driver, const char* function, Real* error, Real* pL1, bool scale_error = true)->decltype(std::declval<F>()(std::declval<Real>()))
    {
       typedef decltype(f(a)) K;
-      static const char* function = "boost::math::quadrature::gauss_kronrod<%1%>::integrate(f, %1%, %1%)";
       if (!(boost::math::isnan)(a) && !(boost::math::isnan)(b))
       {
          // Infinite limits:
@@ -1884,9 +2178,7 @@ public:
                K res = f(arg)*w;
                return res;
             };
-            recursive_info<decltype(u)> info = { u, tol };
-            K res = recursive_adaptive_integrate(&info, Real(-1), Real(1), max_depth, Real(0), error, pL1);
-            return res;
+            return driver(u, Real(-1), Real(1), error, pL1);
          }
 
          // Right limit is infinite:
@@ -1899,12 +2191,15 @@ public:
                K res = f(arg)*z*z;
                return res;
             };
-            recursive_info<decltype(u)> info = { u, tol };
-            K Q = Real(2) * recursive_adaptive_integrate(&info, Real(-1), Real(1), max_depth, Real(0), error, pL1);
+            K Q = Real(2) * driver(u, Real(-1), Real(1), error, pL1);
             if (pL1)
             {
                *pL1 *= 2;
             }
+            if (error && scale_error)
+            {
+               *error *= 2;
+            }
             return Q;
          }
 
@@ -1916,31 +2211,171 @@ public:
                Real arg = 2 * z - 1;
                return f(b - arg) * z * z;
             };
-            recursive_info<decltype(v)> info = { v, tol };
-            K Q = Real(2) * recursive_adaptive_integrate(&info, Real(-1), Real(1), max_depth, Real(0), error, pL1);
+            K Q = Real(2) * driver(v, Real(-1), Real(1), error, pL1);
             if (pL1)
             {
                *pL1 *= 2;
             }
+            if (error && scale_error)
+            {
+               *error *= 2;
+            }
             return Q;
          }
 
          if ((boost::math::isfinite)(a) && (boost::math::isfinite)(b))
          {
-            if (a==b)
+            if (a == b)
             {
                return K(0);
             }
-            recursive_info<F> info = { f, tol };
             if (b < a)
             {
-               return -recursive_adaptive_integrate(&info, b, a, max_depth, Real(0), error, pL1);
+               return -driver(f, b, a, error, pL1);
             }
-            return recursive_adaptive_integrate(&info, a, b, max_depth, Real(0), error, pL1);
+            return driver(f, a, b, error, pL1);
          }
       }
       return static_cast<K>(policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy()));
    }
+
+   //
+   // As recursive_adaptive_integrate, for a vectorized integrand: f is called once per interval with all N
+   // abscissa values.  m(z, zc, jacobian) maps them onto the domain of f, and returns the Jacobian, as
+   // tanh_sinh_mapped_integrand::map does.  zc is the complement of z, found from the nearer end of [a, b]
+   // so that it keeps its accuracy as the intervals close in on -1 or 1:
+   //
+   template <class F, class M>
+   static Real recursive_vectorized_integrate(F& f, const M& m, Real a, Real b, unsigned max_levels, Real abs_tol, Real tol, Real* error, Real* L1)
+   {
+      using std::abs;
+      typedef detail::gauss_kronrod_full_rule<Real, N, base, gauss<Real, (N - 1) / 2> > rule;
+      Real mean = (b + a) / 2;
+      Real scale = (b - a) / 2;
+      std::array<Real, N> x, y, jacobian;
+      for (unsigned i = 0; i < N; ++i)
+      {
+         Real t = rule::abscissa()[i];
+         Real z = scale * t + mean;
+         Real zc = z > 0 ? Real((1 - b) + scale * (1 - t)) : Real(-((1 + a) + scale * (1 + t)));
+         x[i] = m(z, zc, jacobian[i]);
+      }
+      f(x.data(), y.data(), std::size_t(N));
+      for (unsigned i = 0; i < N; ++i)
+         y[i] *= jacobian[i];
+      Real gauss_result, L1_local;
+      Real kronrod_result = detail::gauss_kronrod_weighted_sums(y.data(), rule::weights().data(), rule::gauss_weights().data(), N, gauss_result, L1_local);
+      Real error_local = (std::max)(static_cast<Real>(abs(kronrod_result - gauss_result)), static_cast<Real>(abs(kronrod_result * tools::epsilon<Real>() * Real(2))));
+      if (L1)
+         *L1 = L1_local;
+      Real estimate = scale * kronrod_result;
+
+      Real abs_tol1 = abs(estimate * tol);
+      if (abs_tol == 0)
+         abs_tol = abs_tol1;
+
+      if (max_levels && (abs_tol1 < error_local) && (abs_tol < error_local))
+      {
+         Real mid = (a + b) / 2;
+         Real L1_right;
+         estimate = recursive_vectorized_integrate(f, m, a, mid, max_levels - 1, abs_tol / 2, tol, error, L1);
+         estimate += recursive_vectorized_integrate(f, m, mid, b, max_levels - 1, abs_tol / 2, tol, &error_local, &L1_right);
+         if (error)
+            *error += error_local;
+         if (L1)
+            *L1 += L1_right;
+         return estimate;
+      }
+      if (L1)
+         *L1 *= scale;
+      if (error)
+         *error = error_local;
+      return estimate;
+   }
+
+public:
+   template <class F>
+   static auto integrate(F f, Real a, Real b, unsigned max_depth = 15, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr, quadrature_statistics<Real>* stats = nullptr)->typename detail::enable_if_scalar_valued<decltype(std::declval<F>()(std::declval<Real>()))>::type
+   {
+      static const char* function = "boost::math::quadrature::gauss_kronrod<%1%>::integrate(f, %1%, %1%)";
+      detail::quadrature_statistics_scope<Real> scope(stats);
+      serial_driver driver = { max_depth, tol, stats };
+      return integrate_mapped(f, a, b, driver, function, error, pL1, false);
+   }
+   //
+   // Globally adaptive version, rather than descending depth first and splitting the tolerance between the two
+   // halves, we repeatedly bisect whichever interval has the largest error estimate until the sum of the
+   // errors meets the tolerance.  At most max_intervals interval records are ever created:
+   //
+   template <class F>
+   static auto integrate_global(F f, Real a, Real b, unsigned max_depth = 15, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr, std::size_t max_intervals = 1000)->typename detail::enable_if_scalar_valued<decltype(std::declval<F>()(std::declval<Real>()))>::type
+   {
+      static const char* function = "boost::math::quadrature::gauss_kronrod<%1%>::integrate_global(f, %1%, %1%)";
+      global_driver driver = { max_depth, tol, (std::max)(max_intervals, std::size_t(1)) };
+      return integrate_mapped(f, a, b, driver, function, error, pL1);
+   }
+   //
+   // Integrands returning a std::array or std::vector: each abscissa is evaluated once for all the
+   // components, and the error estimate and L1 norm are those of the largest absolute value of any
+   // component, so that integration continues until every component meets the tolerance relative
+   // to the largest:
+   //
+   template <class F>
+   static auto integrate(F f, Real a, Real b, unsigned max_depth = 15, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr, quadrature_statistics<Real>* stats = nullptr)->typename detail::enable_if_vector_valued<decltype(std::declval<F>()(std::declval<Real>()))>::type
+   {
+      detail::vector_valued_integrand<Real, F> g(f);
+      return detail::vector_valued_result(integrate(g, a, b, max_depth, tol, error, pL1, stats));
+   }
+   template <class F>
+   static auto integrate_global(F f, Real a, Real b, unsigned max_depth = 15, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr, std::size_t max_intervals = 1000)->typename detail::enable_if_vector_valued<decltype(std::declval<F>()(std::declval<Real>()))>::type
+   {
+      detail::vector_valued_integrand<Real, F> g(f);
+      return detail::vector_valued_result(integrate_global(g, a, b, max_depth, tol, error, pL1, max_intervals));
+   }
+   //
+   // Vectorized integrand: f(x, y, n) is called once per interval with all N abscissa values in x[0..n),
+   // and must store f(x[i]) in y[i].  The adaptive strategy is that of integrate() above.  Finite ranges are
+   // bisected directly, as there; infinite ones are mapped onto (-1, 1) by the changes of variable tanh_sinh uses:
+   //
+   template <class F>
+   static auto integrate(F f, Real a, Real b, unsigned max_depth = 15, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<const Real*>(), std::declval<Real*>(), std::declval<std::size_t>()), Real())
+   {
+      static const char* function = "boost::math::quadrature::gauss_kronrod<%1%>::integrate(f, %1%, %1%)";
+      // As everywhere else, limits of magnitude max_value are infinite:
+      if ((a > -tools::max_value<Real>()) && (b < tools::max_value<Real>()) && (boost::math::isfinite)(a) && (boost::math::isfinite)(b))
+      {
+         if (a == b)
+         {
+            return Real(0);
+         }
+         auto m = [](const Real& z, const Real&, Real& jacobian)->Real
+         {
+            jacobian = 1;
+            return z;
+         };
+         if (b < a)
+         {
+            return -recursive_vectorized_integrate(f, m, b, a, max_depth, Real(0), tol, error, pL1);
+         }
+         return recursive_vectorized_integrate(f, m, a, b, max_depth, Real(0), tol, error, pL1);
+      }
+      detail::tanh_sinh_mapped_integrand<Real, const F&> u(f, a, b);
+      if (!u.valid())
+      {
+         return policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy());
+      }
+      auto m = [&u](const Real& z, const Real& zc, Real& jacobian)->Real
+      {
+         return u.map(z, zc, jacobian);
+      };
+      // As for the scalar integrand, the L1 norm is scaled with the result on half infinite ranges but the error is not:
+      Real Q = u.scale() * recursive_vectorized_integrate(f, m, Real(-1), Real(1), max_depth, Real(0), tol, error, pL1);
+      if (pL1)
+      {
+         *pL1 *= u.scale();
+      }
+      return Q;
+   }
 };
 
 } // namespace quadrature
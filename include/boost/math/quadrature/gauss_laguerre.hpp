@@ -0,0 +1,102 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ * Gauss-Laguerre quadrature: the n point rule for integrals of the form
+ *
+ *    \int_{0}^{\infty} x^{\alpha} e^{-x} f(x) dx,   \alpha > -1,
+ *
+ * which is exact when f is a polynomial of degree at most 2n - 1.
+ *
+ * The nodes are the zeros of the generalized Laguerre polynomial L_n^{(\alpha)}, found as the eigenvalues of the
+ * Jacobi matrix and then polished by Newton iteration, and the rules are computed once per order, parameter and type and cached.
+ */
+
+#ifndef BOOST_MATH_QUADRATURE_GAUSS_LAGUERRE_HPP
+#define BOOST_MATH_QUADRATURE_GAUSS_LAGUERRE_HPP
+
+#include <cmath>
+#include <utility>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/quadrature/detail/gauss_rule_generator.hpp>
+
+namespace boost{ namespace math{ namespace quadrature {
+
+namespace detail{
+
+// The recurrence for the polynomials orthonormal with respect to x^alpha e^{-x}:
+template<class Real, class Policy>
+struct laguerre_recurrence
+{
+   laguerre_recurrence(Real alpha) : m_alpha(alpha) {}
+   Real a(unsigned k) const { return 2 * k + m_alpha + 1; }
+   Real sqrt_b(unsigned k) const { using std::sqrt; return sqrt(k * (k + m_alpha)); }
+   Real mu0() const { return boost::math::tgamma(m_alpha + 1, Policy()); }
+   Real m_alpha;
+};
+
+template<class Real, class Policy>
+std::shared_ptr<const gauss_rule<Real>> make_gauss_laguerre_rule(unsigned n, Real alpha)
+{
+   static const char* function = "boost::math::quadrature::gauss_laguerre<%1%>::gauss_laguerre";
+   typedef typename policies::evaluation<Real, Policy>::type value_type;
+   return make_gauss_rule<Real, value_type>(laguerre_recurrence<value_type, Policy>(alpha), n, function, Policy());
+}
+
+}
+
+template<class Real, class Policy = boost::math::policies::policy<> >
+class gauss_laguerre
+{
+public:
+   typedef Real value_type;
+
+   explicit gauss_laguerre(unsigned n, Real alpha = 0) : m_alpha(alpha)
+   {
+      static const char* function = "boost::math::quadrature::gauss_laguerre<%1%>::gauss_laguerre";
+      if (n == 0)
+      {
+         policies::raise_domain_error(function, "The order of the rule must be at least one, but got n = %1%.", Real(n), Policy());
+         n = 1;
+      }
+      if (!(boost::math::isfinite)(alpha) || (alpha <= -1))
+      {
+         m_alpha = policies::raise_domain_error(function, "The parameter alpha must be finite and greater than -1, but got alpha = %1%.", alpha, Policy());
+         return;
+      }
+      m_rule = detail::gauss_rule_cache<Real, Policy, std::pair<unsigned, Real>>::get(std::make_pair(n, alpha), [n, alpha]() { return detail::make_gauss_laguerre_rule<Real, Policy>(n, alpha); });
+   }
+
+   //
+   // \int_{0}^{\infty} x^{\alpha} e^{-x} f(x) dx, and optionally the same integral of |f|:
+   //
+   template<class F>
+   auto integrate(F f, Real* pL1 = nullptr) const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      typedef decltype(f(Real(0))) K;
+      if (!m_rule)
+      {
+         return static_cast<K>(std::numeric_limits<Real>::quiet_NaN());
+      }
+      return detail::gauss_rule_sum(*m_rule, f, pL1);
+   }
+
+   // Empty if the parameters passed to the constructor were invalid:
+   const std::vector<Real>& abscissa() const { return rule().abscissa; }
+   const std::vector<Real>& weights() const { return rule().weights; }
+   unsigned order() const { return static_cast<unsigned>(rule().abscissa.size()); }
+   Real alpha() const { return m_alpha; }
+
+private:
+   const detail::gauss_rule<Real>& rule() const { return m_rule ? *m_rule : detail::empty_gauss_rule<Real>(); }
+
+   Real m_alpha;
+   std::shared_ptr<const detail::gauss_rule<Real>> m_rule;
+};
+
+}}}
+#endif
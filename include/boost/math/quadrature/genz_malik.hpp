@@ -0,0 +1,474 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ * Globally adaptive cubature over hyperrectangles.
+ *
+ * Each box is integrated with the degree 7 rule of Genz and Malik, with the embedded degree 5 rule
+ * supplying the error estimate:
+ *
+ * A. C. Genz and A. A. Malik, "An adaptive algorithm for numerical integration over an N-dimensional
+ * rectangular region", J. Comput. Appl. Math. 6 (1980), 295-302.
+ *
+ * The boxes are kept in a heap ordered on their error estimates, and the worst are repeatedly
+ * bisected until the sum of the error estimates meets the requested tolerance.  A box is split along
+ * the axis on which the integrand's fourth divided difference is largest, so the refinement
+ * concentrates in the directions where the integrand is hardest, rather than in every direction as
+ * nesting one dimensional routines does.  The rule needs 2^n + 2n^2 + 2n + 1 evaluations per box in
+ * dimension n, so is best suited to n between 2 and about 10.
+ *
+ * Refinement proceeds in rounds of up to batch_size boxes.  The boxes of a round may be evaluated
+ * concurrently on a pool of threads, but the batches do not depend on the number of threads, so the
+ * result is the same whether run on one thread or many.
+ */
+
+#ifndef BOOST_MATH_QUADRATURE_GENZ_MALIK_HPP
+#define BOOST_MATH_QUADRATURE_GENZ_MALIK_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/tools/precision.hpp>
+
+namespace boost { namespace math { namespace quadrature {
+
+namespace detail {
+
+//
+// The abscissas and weights of the degree 7/5 pair for a given dimension.  Abscissas are given as
+// fractions of the box half widths, and the weights are normalised to a box of unit volume:
+//
+template <class Real>
+struct genz_malik_rule
+{
+   explicit genz_malik_rule(std::size_t n)
+   {
+      using std::sqrt;
+      Real d = Real(n);
+      lambda2 = sqrt(Real(9) / 70);
+      lambda4 = sqrt(Real(9) / 10);
+      lambda5 = sqrt(Real(9) / 19);
+      weight1 = (12824 - 9120 * d + 400 * d * d) / 19683;
+      weight2 = Real(980) / 6561;
+      weight3 = (1820 - 400 * d) / 19683;
+      weight4 = Real(200) / 19683;
+      weight5 = Real(6859) / 19683;
+      for (std::size_t i = 0; i < n; ++i)
+         weight5 /= 2;
+      embedded_weight1 = (729 - 950 * d + 50 * d * d) / 729;
+      embedded_weight2 = Real(245) / 486;
+      embedded_weight3 = (265 - 100 * d) / 1458;
+      embedded_weight4 = Real(25) / 729;
+      // (lambda2 / lambda4)^2, used to eliminate the second derivative from the fourth difference:
+      ratio = Real(1) / 7;
+   }
+   static std::size_t points(std::size_t n)
+   {
+      return (std::size_t(1) << n) + 2 * n * n + 2 * n + 1;
+   }
+
+   Real lambda2, lambda4, lambda5;
+   Real weight1, weight2, weight3, weight4, weight5;
+   Real embedded_weight1, embedded_weight2, embedded_weight3, embedded_weight4;
+   Real ratio;
+};
+
+template <class Real, class Container, class K>
+struct genz_malik_region
+{
+   Container center;
+   Container half_width;
+   K result;
+   Real error;
+   Real L1;
+   // The axis along which to bisect this region should it need refining:
+   std::size_t split;
+};
+
+template <class Region>
+struct genz_malik_region_less
+{
+   bool operator()(const Region& a, const Region& b) const { return a.error < b.error; }
+};
+
+//
+// The helper threads of an integration, started once and kept for all its rounds.  Each call to run()
+// releases them by bumping the generation count, and they pull work from a shared counter along with
+// the calling thread.  Every participant checks in once per generation when it runs out of work, and
+// run() returns only once all have, so no helper can still be reading the previous round's job when
+// the caller prepares the next:
+//
+class genz_malik_workers
+{
+public:
+   explicit genz_malik_workers(std::size_t helpers)
+      : m_generation(0), m_finished(0), m_count(0), m_next(0), m_job(nullptr), m_done(false)
+   {
+      try
+      {
+         for (std::size_t i = 0; i < helpers; ++i)
+            m_pool.push_back(std::thread([this]() { worker(); }));
+      }
+      catch (...)
+      {
+         stop();
+         throw;
+      }
+   }
+   genz_malik_workers(const genz_malik_workers&) = delete;
+   genz_malik_workers& operator=(const genz_malik_workers&) = delete;
+   ~genz_malik_workers()
+   {
+      stop();
+   }
+
+   // Calls job(i) for each i < count, and rethrows the first exception thrown by any of the calls:
+   void run(std::size_t count, const std::function<void(std::size_t)>& job)
+   {
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         m_job = &job;
+         m_count = count;
+         m_next = 0;
+         m_finished = 0;
+         m_exception = nullptr;
+         ++m_generation;
+      }
+      m_cv.notify_all();
+      work();
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_cv.wait(lock, [this]() { return m_finished == m_pool.size() + 1; });
+      if (m_exception)
+         std::rethrow_exception(m_exception);
+   }
+
+private:
+   void work()
+   {
+      try
+      {
+         std::size_t i;
+         while ((i = m_next++) < m_count)
+            (*m_job)(i);
+      }
+      catch (...)
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         if (!m_exception)
+            m_exception = std::current_exception();
+         // Make sure nobody picks up any more work this round:
+         m_next = m_count;
+      }
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (++m_finished == m_pool.size() + 1)
+         m_cv.notify_all();
+   }
+
+   void worker()
+   {
+      std::size_t seen = 0;
+      for (;;)
+      {
+         {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [&]() { return m_done || (m_generation != seen); });
+            if (m_done)
+               return;
+            seen = m_generation;
+         }
+         work();
+      }
+   }
+
+   void stop()
+   {
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         m_done = true;
+      }
+      m_cv.notify_all();
+      std::for_each(m_pool.begin(), m_pool.end(), std::mem_fn(&std::thread::join));
+   }
+
+   std::vector<std::thread> m_pool;
+   std::mutex m_mutex;
+   std::condition_variable m_cv;
+   std::size_t m_generation;
+   std::size_t m_finished;
+   std::size_t m_count;
+   std::atomic<std::size_t> m_next;
+   const std::function<void(std::size_t)>* m_job;
+   std::exception_ptr m_exception;
+   bool m_done;
+};
+
+} // namespace detail
+
+template <class Real, class Policy = boost::math::policies::policy<> >
+class genz_malik
+{
+public:
+   typedef Real value_type;
+
+   genz_malik(unsigned threads = 1, std::size_t batch_size = 32)
+      : m_threads((std::max)(threads, 1u)), m_batch_size((std::max)(batch_size, std::size_t(1))) {}
+
+   //
+   // Integrates f over the box with lower corner a and upper corner b, where f is called with a
+   // single argument of the same container type as a and b.  Integration stops once the estimated
+   // error is less than tol times the absolute value of the result, or when no further box may be
+   // bisected without exceeding max_evaluations calls to f.
+   //
+   template <class F, class Container>
+   auto integrate(F f, const Container& a, const Container& b, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr, std::size_t max_evaluations = 1000000) const ->decltype(std::declval<F>()(std::declval<const Container&>()))
+   {
+      using std::abs;
+      static const char* function = "boost::math::quadrature::genz_malik<%1%>::integrate";
+      typedef decltype(f(a)) K;
+      typedef detail::genz_malik_region<Real, Container, K> region_type;
+      typedef detail::genz_malik_region_less<region_type> less_type;
+
+      std::size_t n = a.size();
+      if (b.size() != n)
+      {
+         return static_cast<K>(policies::raise_domain_error(function, "The upper and lower corners of the box must have the same number of dimensions, but the upper corner has %1% dimensions.", Real(b.size()), Policy()));
+      }
+      if (n < 2)
+      {
+         return static_cast<K>(policies::raise_domain_error(function, "The Genz-Malik rule requires at least two dimensions, but got %1%: use gauss_kronrod for one dimensional integrals.", Real(n), Policy()));
+      }
+      if (n >= std::numeric_limits<std::size_t>::digits - 1)
+      {
+         return static_cast<K>(policies::raise_domain_error(function, "Too many dimensions: %1%.", Real(n), Policy()));
+      }
+      region_type root;
+      root.center = a;
+      root.half_width = a;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         if (!(boost::math::isfinite)(a[i]) || !(boost::math::isfinite)(b[i]))
+         {
+            return static_cast<K>(policies::raise_domain_error(function, "The box must be finite, but found a limit of %1%.", Real((boost::math::isfinite)(a[i]) ? b[i] : a[i]), Policy()));
+         }
+         root.center[i] = (a[i] + b[i]) / 2;
+         root.half_width[i] = (b[i] - a[i]) / 2;
+      }
+
+      detail::genz_malik_rule<Real> rule(n);
+      std::size_t points = rule.points(n);
+      evaluate(f, rule, root);
+      std::size_t evaluations = points;
+
+      std::vector<region_type> heap(1, root);
+      K total = root.result;
+      Real total_error = root.error;
+
+      std::vector<region_type> batch, children;
+      // The helper threads, if any, persist until the integration is complete:
+      std::size_t helpers = (std::min)(static_cast<std::size_t>(m_threads), m_batch_size) - 1;
+      std::unique_ptr<detail::genz_malik_workers> workers;
+      while (total_error > tol * abs(total))
+      {
+         //
+         // Take the worst boxes, stopping early if what remains would already meet the tolerance,
+         // so that a large batch does little more work than refining one box at a time:
+         //
+         batch.clear();
+         Real remaining = total_error;
+         while ((batch.size() < m_batch_size) && (evaluations + 2 * points <= max_evaluations))
+         {
+            std::pop_heap(heap.begin(), heap.end(), less_type());
+            batch.push_back(heap.back());
+            heap.pop_back();
+            evaluations += 2 * points;
+            remaining -= batch.back().error;
+            if (heap.empty() || (remaining <= tol * abs(total)))
+               break;
+         }
+         if (batch.empty())
+            break;
+         children.resize(2 * batch.size());
+         if (helpers && (batch.size() > 1) && !workers)
+            workers.reset(new detail::genz_malik_workers(helpers));
+         bisect_batch(f, rule, batch, children, workers.get());
+         for (std::size_t i = 0; i < batch.size(); ++i)
+         {
+            total -= batch[i].result;
+            total_error -= batch[i].error;
+            for (std::size_t j = 2 * i; j < 2 * i + 2; ++j)
+            {
+               total += children[j].result;
+               total_error += children[j].error;
+               heap.push_back(children[j]);
+               std::push_heap(heap.begin(), heap.end(), less_type());
+            }
+         }
+      }
+      //
+      // The running totals accumulate rounding error as boxes are replaced, so sum afresh:
+      //
+      total = K(0);
+      total_error = 0;
+      Real L1 = 0;
+      for (std::size_t i = 0; i < heap.size(); ++i)
+      {
+         total += heap[i].result;
+         total_error += heap[i].error;
+         L1 += heap[i].L1;
+      }
+      if (error)
+         *error = total_error;
+      if (pL1)
+         *pL1 = L1;
+      return total;
+   }
+
+   unsigned threads() const { return m_threads; }
+   std::size_t batch_size() const { return m_batch_size; }
+
+private:
+   //
+   // Applies the rule to r, setting its result, error estimate, L1 norm, and split axis:
+   //
+   template <class F, class Region>
+   static void evaluate(const F& f, const detail::genz_malik_rule<Real>& rule, Region& r)
+   {
+      using std::abs;
+      typedef decltype(r.result) K;
+      std::size_t n = r.center.size();
+      const auto& c = r.center;
+      const auto& h = r.half_width;
+      auto x = c;
+
+      K f0 = f(x);
+      K sum2 = K(0), sum3 = K(0), sum4 = K(0), sum5 = K(0);
+      Real abs_sum2 = 0, abs_sum3 = 0, abs_sum4 = 0, abs_sum5 = 0;
+      //
+      // Split along the axis with the largest fourth difference, or failing that (all differences zero)
+      // the widest axis:
+      //
+      std::size_t split = 0;
+      for (std::size_t i = 1; i < n; ++i)
+      {
+         if (abs(h[i]) > abs(h[split]))
+            split = i;
+      }
+      Real max_difference = -1;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         x[i] = c[i] - rule.lambda2 * h[i];
+         K f2 = f(x);
+         x[i] = c[i] + rule.lambda2 * h[i];
+         f2 += f(x);
+         x[i] = c[i] - rule.lambda4 * h[i];
+         K f3 = f(x);
+         x[i] = c[i] + rule.lambda4 * h[i];
+         f3 += f(x);
+         x[i] = c[i];
+         sum2 += f2;
+         sum3 += f3;
+         abs_sum2 += abs(f2);
+         abs_sum3 += abs(f3);
+         Real difference = abs(f2 - 2 * f0 - rule.ratio * (f3 - 2 * f0));
+         if ((difference > max_difference) || ((difference == max_difference) && (abs(h[i]) > abs(h[split]))))
+         {
+            max_difference = difference;
+            split = i;
+         }
+      }
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         for (std::size_t j = i + 1; j < n; ++j)
+         {
+            for (unsigned k = 0; k < 4; ++k)
+            {
+               x[i] = c[i] + ((k & 1) ? rule.lambda4 : -rule.lambda4) * h[i];
+               x[j] = c[j] + ((k & 2) ? rule.lambda4 : -rule.lambda4) * h[j];
+               K y = f(x);
+               sum4 += y;
+               abs_sum4 += abs(y);
+            }
+            x[j] = c[j];
+         }
+         x[i] = c[i];
+      }
+      //
+      // Visit the 2^n corners of the inner box in Gray code order, so that only one coordinate
+      // changes between each evaluation:
+      //
+      for (std::size_t i = 0; i < n; ++i)
+         x[i] = c[i] - rule.lambda5 * h[i];
+      std::size_t corners = std::size_t(1) << n;
+      for (std::size_t m = 0; m < corners; ++m)
+      {
+         if (m)
+         {
+            std::size_t i = 0;
+            while (!(m & (std::size_t(1) << i)))
+               ++i;
+            x[i] = c[i] + (((m ^ (m >> 1)) & (std::size_t(1) << i)) ? rule.lambda5 : -rule.lambda5) * h[i];
+         }
+         K y = f(x);
+         sum5 += y;
+         abs_sum5 += abs(y);
+      }
+
+      Real volume = 1;
+      for (std::size_t i = 0; i < n; ++i)
+         volume *= 2 * h[i];
+      K result = rule.weight1 * f0 + rule.weight2 * sum2 + rule.weight3 * sum3 + rule.weight4 * sum4 + rule.weight5 * sum5;
+      K embedded = rule.embedded_weight1 * f0 + rule.embedded_weight2 * sum2 + rule.embedded_weight3 * sum3 + rule.embedded_weight4 * sum4;
+      r.result = volume * result;
+      r.error = abs(volume * (result - embedded));
+      r.L1 = abs(volume) * abs(rule.weight1 * abs(f0) + rule.weight2 * abs_sum2 + rule.weight3 * abs_sum3 + rule.weight4 * abs_sum4 + rule.weight5 * abs_sum5);
+      r.split = split;
+   }
+
+   template <class F, class Region>
+   static void bisect(const F& f, const detail::genz_malik_rule<Real>& rule, const Region& parent, Region& left, Region& right)
+   {
+      std::size_t i = parent.split;
+      left.center = parent.center;
+      left.half_width = parent.half_width;
+      left.half_width[i] /= 2;
+      right.center = left.center;
+      right.half_width = left.half_width;
+      left.center[i] -= left.half_width[i];
+      right.center[i] += left.half_width[i];
+      evaluate(f, rule, left);
+      evaluate(f, rule, right);
+   }
+
+   template <class F, class Region>
+   static void bisect_batch(const F& f, const detail::genz_malik_rule<Real>& rule, const std::vector<Region>& batch, std::vector<Region>& children, detail::genz_malik_workers* workers)
+   {
+      if (!workers || (batch.size() == 1))
+      {
+         for (std::size_t i = 0; i < batch.size(); ++i)
+            bisect(f, rule, batch[i], children[2 * i], children[2 * i + 1]);
+         return;
+      }
+      workers->run(batch.size(), [&](std::size_t i) { bisect(f, rule, batch[i], children[2 * i], children[2 * i + 1]); });
+   }
+
+   unsigned m_threads;
+   std::size_t m_batch_size;
+};
+
+} // namespace quadrature
+} // namespace math
+} // namespace boost
+
+#endif // BOOST_MATH_QUADRATURE_GENZ_MALIK_HPP
@@ -0,0 +1,283 @@
+// Copyright The Boost.Math contributors 2026.
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ * Multi-threaded adaptive Gauss-Kronrod quadrature.
+ *
+ * Rather than bisecting depth first as gauss_kronrod::integrate does, we keep every subinterval in a
+ * heap ordered on its error estimate, and a pool of worker threads repeatedly bisects the intervals
+ * with the largest error until the sum of the error estimates meets the requested tolerance.
+ *
+ * Two scheduling modes are provided:
+ *
+ * In deterministic mode the work proceeds in rounds: each round removes the batch_size worst intervals
+ * from the heap, the workers pull the resulting bisections from a shared counter and evaluate them,
+ * and the calling thread then merges the results back in a fixed order.  Since the batch size does not
+ * depend on the number of threads, the result is bit-for-bit identical whether run on one thread or many.
+ *
+ * Otherwise each worker takes the current worst interval as soon as it becomes free, which gives better
+ * load balancing when the cost of the integrand varies a great deal across the range, but the order
+ * in which intervals are refined (and hence the last few bits of the result) depends on thread timing.
+ *
+ * In either case there is a single heap, shared by all the threads and guarded by a mutex, rather than
+ * per-thread work-stealing queues: the intervals have to be refined in order of their error estimates
+ * across the whole range, which no thread can see from a local queue, and a bisection costs 2N calls
+ * of the integrand, which dwarfs the cost of taking the lock.
+ *
+ * The integrand is called concurrently from several threads, and must be thread safe.
+ */
+
+#ifndef BOOST_MATH_QUADRATURE_PARALLEL_GAUSS_KRONROD_HPP
+#define BOOST_MATH_QUADRATURE_PARALLEL_GAUSS_KRONROD_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <boost/math/quadrature/gauss_kronrod.hpp>
+
+namespace boost { namespace math { namespace quadrature {
+
+template <class Real, unsigned N, class Policy = boost::math::policies::policy<> >
+class parallel_gauss_kronrod
+{
+public:
+   typedef Real value_type;
+
+   parallel_gauss_kronrod(unsigned threads = std::thread::hardware_concurrency(), bool deterministic = true, std::size_t batch_size = 32)
+      : m_threads((std::max)(threads, 1u)), m_deterministic(deterministic), m_batch_size((std::max)(batch_size, std::size_t(1))) {}
+
+   template <class F>
+   auto integrate(F f, Real a, Real b, unsigned max_depth = 15, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr) const ->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      static const char* function = "boost::math::quadrature::parallel_gauss_kronrod<%1%>::integrate(f, %1%, %1%)";
+      driver d = { this, max_depth, tol };
+      return rule_type::integrate_mapped(f, a, b, d, function, error, pL1);
+   }
+
+   unsigned threads() const { return m_threads; }
+   bool deterministic() const { return m_deterministic; }
+   std::size_t batch_size() const { return m_batch_size; }
+
+private:
+   typedef gauss_kronrod<Real, N, Policy> rule_type;
+
+   struct driver
+   {
+      const parallel_gauss_kronrod* self;
+      unsigned max_depth;
+      Real tol;
+      template <class F>
+      auto operator()(const F& f, Real a, Real b, Real* error, Real* pL1) const ->decltype(std::declval<F>()(std::declval<Real>()))
+      {
+         return self->adaptive_integrate(f, a, b, max_depth, tol, error, pL1);
+      }
+   };
+
+   template <class F>
+   auto adaptive_integrate(const F& f, Real a, Real b, unsigned max_depth, Real tol, Real* error, Real* pL1) const ->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      typedef decltype(f(a)) K;
+      typedef detail::gauss_kronrod_interval_heap<Real, K> heap_type;
+      typedef typename heap_type::interval_type interval_type;
+
+      interval_type root;
+      root.a = a;
+      root.b = b;
+      root.depth = 0;
+      rule_type::integrate_interval(f, root);
+      heap_type heap(root, max_depth);
+
+      if (m_deterministic)
+         refine_in_rounds(f, heap, tol);
+      else
+         refine_asynchronously(f, heap, tol);
+      return heap.sum(error, pL1);
+   }
+
+   template <class F, class Heap>
+   void refine_in_rounds(const F& f, Heap& heap, Real tol) const
+   {
+      typedef typename Heap::interval_type interval_type;
+
+      std::vector<std::size_t> batch;
+      std::vector<interval_type> children;
+      //
+      // The workers persist for the whole integration, and are released once per round by
+      // bumping the generation count; they pull work from next_child until it is exhausted.
+      // Every participant checks in once per generation when it leaves work(), and the next
+      // round doesn't start until all have, so nobody can enter a round late and find the batch
+      // being rebuilt under it:
+      //
+      std::mutex mu;
+      std::condition_variable cv;
+      std::size_t generation = 0;
+      std::size_t finished = 0;
+      bool done = false;
+      std::atomic<std::size_t> next_child(0);
+      std::exception_ptr exception;
+      std::size_t helpers = (std::min)(static_cast<std::size_t>(m_threads), m_batch_size) - 1;
+
+      auto work = [&]()
+      {
+         try
+         {
+            std::size_t i;
+            while ((i = next_child++) < batch.size())
+               rule_type::bisect(f, heap[batch[i]], children[2 * i], children[2 * i + 1]);
+         }
+         catch (...)
+         {
+            std::lock_guard<std::mutex> lock(mu);
+            if (!exception)
+               exception = std::current_exception();
+            // Make sure nobody picks up any more work this round:
+            next_child = batch.size();
+         }
+         std::lock_guard<std::mutex> lock(mu);
+         if (++finished == helpers + 1)
+            cv.notify_all();
+      };
+
+      auto worker = [&]()
+      {
+         std::size_t seen = 0;
+         for (;;)
+         {
+            {
+               std::unique_lock<std::mutex> lock(mu);
+               cv.wait(lock, [&]() { return done || (generation != seen); });
+               if (done)
+                  return;
+               seen = generation;
+            }
+            work();
+         }
+      };
+
+      std::vector<std::thread> pool;
+      for (std::size_t i = 0; i < helpers; ++i)
+         pool.push_back(std::thread(worker));
+
+      while (!heap.empty() && !heap.converged(tol))
+      {
+         batch.clear();
+         while ((batch.size() < m_batch_size) && !heap.empty())
+            batch.push_back(heap.pop());
+         children.resize(2 * batch.size());
+         {
+            std::lock_guard<std::mutex> lock(mu);
+            next_child = 0;
+            finished = 0;
+            ++generation;
+         }
+         cv.notify_all();
+         work();
+         //
+         // Wait for every worker to have checked in for this round, since we are about
+         // to modify the batch they read from:
+         //
+         {
+            std::unique_lock<std::mutex> lock(mu);
+            cv.wait(lock, [&]() { return finished == helpers + 1; });
+         }
+         if (exception)
+            break;
+         //
+         // Merge in batch order: the left child replaces its parent, the right child is appended:
+         //
+         for (std::size_t i = 0; i < batch.size(); ++i)
+            heap.replace(batch[i], children[2 * i], children[2 * i + 1]);
+      }
+      {
+         std::lock_guard<std::mutex> lock(mu);
+         done = true;
+      }
+      cv.notify_all();
+      std::for_each(pool.begin(), pool.end(), std::mem_fn(&std::thread::join));
+      if (exception)
+         std::rethrow_exception(exception);
+   }
+
+   template <class F, class Heap>
+   void refine_asynchronously(const F& f, Heap& heap, Real tol) const
+   {
+      typedef typename Heap::interval_type interval_type;
+
+      std::mutex mu;
+      std::condition_variable cv;
+      std::size_t in_flight = 0;
+      bool done = false;
+      std::exception_ptr exception;
+
+      auto worker = [&]()
+      {
+         std::unique_lock<std::mutex> lock(mu);
+         for (;;)
+         {
+            if (done)
+               return;
+            if (!heap.empty() && !heap.converged(tol))
+            {
+               std::size_t parent = heap.pop();
+               // Take a copy, as other threads may grow the arena while we work:
+               interval_type p = heap[parent];
+               interval_type left, right;
+               ++in_flight;
+               lock.unlock();
+               try
+               {
+                  rule_type::bisect(f, p, left, right);
+               }
+               catch (...)
+               {
+                  lock.lock();
+                  if (!exception)
+                     exception = std::current_exception();
+                  done = true;
+                  cv.notify_all();
+                  return;
+               }
+               lock.lock();
+               --in_flight;
+               heap.replace(parent, left, right);
+               cv.notify_all();
+            }
+            else if (in_flight == 0)
+            {
+               // Nothing left to refine, and nothing in progress which might produce more work:
+               done = true;
+               cv.notify_all();
+               return;
+            }
+            else
+            {
+               cv.wait(lock);
+            }
+         }
+      };
+
+      std::vector<std::thread> pool;
+      for (unsigned i = 1; i < m_threads; ++i)
+         pool.push_back(std::thread(worker));
+      worker();
+      std::for_each(pool.begin(), pool.end(), std::mem_fn(&std::thread::join));
+      if (exception)
+         std::rethrow_exception(exception);
+   }
+
+   unsigned m_threads;
+   bool m_deterministic;
+   std::size_t m_batch_size;
+};
+
+} // namespace quadrature
+} // namespace math
+} // namespace boost
+
+#endif // BOOST_MATH_QUADRATURE_PARALLEL_GAUSS_KRONROD_HPP
@@ -0,0 +1,76 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_QUADRATURE_STATISTICS_HPP
+#define BOOST_MATH_QUADRATURE_QUADRATURE_STATISTICS_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace boost { namespace math { namespace quadrature {
+
+//
+// Records how an integral was computed, for those integrators which accept a pointer to one as their last argument.
+// Nothing is recorded, and nothing is timed, when that pointer is null.
+//
+template <class Real>
+struct quadrature_statistics
+{
+   quadrature_statistics() : evaluations(0), levels(0), intervals(0), elapsed(0) {}
+
+   // The number of calls to the integrand:
+   std::size_t evaluations;
+   // The number of refinement levels for the double exponential and trapezoidal rules,
+   // or the depth of the deepest bisection for Gauss-Kronrod quadrature:
+   std::size_t levels;
+   // The number of subintervals making up the final estimate:
+   std::size_t intervals;
+   // The error estimate after each refinement level, or for Gauss-Kronrod quadrature,
+   // the sum of the error estimates of the subintervals at each depth:
+   std::vector<Real> errors;
+   // The wall clock time taken by the integration:
+   std::chrono::duration<double> elapsed;
+};
+
+namespace detail {
+
+//
+// Resets *stats on construction, and records the time elapsed on destruction, if stats is not null:
+//
+template <class Real>
+class quadrature_statistics_scope
+{
+public:
+   explicit quadrature_statistics_scope(quadrature_statistics<Real>* stats) : m_stats(stats)
+   {
+      if (m_stats)
+      {
+         m_stats->evaluations = 0;
+         m_stats->levels = 0;
+         m_stats->intervals = 0;
+         m_stats->errors.clear();
+         m_start = std::chrono::steady_clock::now();
+      }
+   }
+   ~quadrature_statistics_scope()
+   {
+      if (m_stats)
+         m_stats->elapsed = std::chrono::steady_clock::now() - m_start;
+   }
+private:
+   quadrature_statistics_scope(const quadrature_statistics_scope&);
+   quadrature_statistics_scope& operator=(const quadrature_statistics_scope&);
+
+   quadrature_statistics<Real>* m_stats;
+   std::chrono::steady_clock::time_point m_start;
+};
+
+}
+
+}}} // namespaces
+
+#endif
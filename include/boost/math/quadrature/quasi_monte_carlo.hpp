@@ -0,0 +1,387 @@
+/*
+ * Copyright The Boost.Math contributors, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef BOOST_MATH_QUADRATURE_QUASI_MONTE_CARLO_HPP
+#define BOOST_MATH_QUADRATURE_QUASI_MONTE_CARLO_HPP
+#include <sstream>
+#include <algorithm>
+#include <vector>
+#include <functional>
+#include <future>
+#include <thread>
+#include <utility>
+#include <random>
+#include <chrono>
+#include <cstdint>
+#include <boost/atomic.hpp>
+#include <boost/random/sobol.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/quadrature/detail/monte_carlo.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/special_functions/prime.hpp>
+
+namespace boost { namespace math { namespace quadrature {
+
+enum class low_discrepancy_sequence { sobol, halton };
+
+namespace detail {
+
+//
+// Generates the points of a low discrepancy sequence by index, so that each thread can work on
+// its own block of the sequence.  Each point is randomized afresh for each replicate: Sobol points
+// by a random digital shift (xor'ing the binary expansion of each coordinate with a random
+// bit pattern), and Halton points by a random shift modulo 1.  Either preserves the low discrepancy
+// of the point set, while making each replicate an unbiased estimate of the integral.
+//
+template<class Real>
+class qmc_point_generator
+{
+public:
+    qmc_point_generator(low_discrepancy_sequence sequence, std::size_t dimension)
+      : m_sequence(sequence), m_dimension(dimension), m_sobol(sequence == low_discrepancy_sequence::sobol ? dimension : 1),
+        m_index(0), m_sobol_point(dimension), m_halton_point(dimension) {}
+
+    static std::size_t max_dimension(low_discrepancy_sequence sequence)
+    {
+        return sequence == low_discrepancy_sequence::sobol ? boost::random::default_sobol_table::max_dimension : boost::math::max_prime;
+    }
+
+    // Moves to the index'th point of the sequence:
+    void seek(std::uint64_t index)
+    {
+        m_index = index;
+        if (m_sequence == low_discrepancy_sequence::sobol)
+        {
+            m_sobol.seed(index);
+        }
+    }
+
+    // Computes the next point of the sequence, before randomization:
+    void next()
+    {
+        if (m_sequence == low_discrepancy_sequence::sobol)
+        {
+            for (std::size_t i = 0; i < m_dimension; ++i)
+            {
+                m_sobol_point[i] = m_sobol();
+            }
+        }
+        else
+        {
+            // The point at index zero is the origin, which we skip just as the Sobol generator does:
+            std::uint64_t n = m_index + 1;
+            for (std::size_t i = 0; i < m_dimension; ++i)
+            {
+                std::uint64_t base = boost::math::prime(static_cast<unsigned>(i));
+                std::uint64_t k = n;
+                Real scale = 1;
+                Real r = 0;
+                while (k)
+                {
+                    scale /= base;
+                    r += (k % base) * scale;
+                    k /= base;
+                }
+                m_halton_point[i] = r;
+            }
+        }
+        ++m_index;
+    }
+
+    // The current point, randomized by shift, which must contain one random 64-bit value per dimension:
+    void randomized_point(const std::uint64_t* shift, std::vector<Real>& x) const
+    {
+        // The points are placed at the centre of cells of width 2^-bits.  One bit fewer than the precision of
+        // Real, so that the centre of the last cell, 1 - 2^-(bits+1), is representable and does not round to 1:
+        static const int bits = (std::min)(std::numeric_limits<Real>::digits, 64) - 1;
+        using std::ldexp;
+        if (m_sequence == low_discrepancy_sequence::sobol)
+        {
+            for (std::size_t i = 0; i < m_dimension; ++i)
+            {
+                // Take the leading bits, and place the point at the centre of its cell, so that it is never 0 or 1:
+                std::uint64_t v = (m_sobol_point[i] ^ shift[i]) >> (64 - bits);
+                x[i] = ldexp(Real(v) + Real(0.5), -bits);
+            }
+        }
+        else
+        {
+            const Real lower = ldexp(Real(1), -bits - 1);
+            const Real upper = 1 - lower;
+            for (std::size_t i = 0; i < m_dimension; ++i)
+            {
+                Real u = m_halton_point[i] + ldexp(Real(shift[i] >> (64 - bits)) + Real(0.5), -bits);
+                u = u < 1 ? u : u - 1;
+                // The sum may round to 1, which would wrap to 0:
+                x[i] = (std::min)((std::max)(u, lower), upper);
+            }
+        }
+    }
+
+private:
+    low_discrepancy_sequence m_sequence;
+    std::size_t m_dimension;
+    boost::random::sobol m_sobol;
+    std::uint64_t m_index;
+    std::vector<std::uint64_t> m_sobol_point;
+    std::vector<Real> m_halton_point;
+};
+
+}
+
+template<class Real, class F, class Policy = boost::math::policies::policy<>>
+class quasi_monte_carlo
+{
+public:
+    quasi_monte_carlo(const F& integrand,
+                      std::vector<std::pair<Real, Real>> const & bounds,
+                      Real error_goal,
+                      low_discrepancy_sequence sequence = low_discrepancy_sequence::sobol,
+                      uint64_t replicates = 16,
+                      uint64_t threads = std::thread::hardware_concurrency(),
+                      uint64_t seed = 0)
+      : m_integrand(integrand), m_sequence(sequence), m_replicates((std::max)(replicates, (uint64_t) 2)), m_pool(threads)
+    {
+        static const char* function = "boost::math::quadrature::quasi_monte_carlo<%1%>";
+        m_num_threads = m_pool.size();
+        uint64_t n = bounds.size();
+        if (n == 0 || n > detail::qmc_point_generator<Real>::max_dimension(sequence))
+        {
+            boost::math::policies::raise_domain_error(function, "Unsupported number of dimensions %1%.\n", static_cast<Real>(n), Policy());
+            return;
+        }
+        m_lbs.resize(n);
+        m_dxs.resize(n);
+        m_volume = 1;
+        for (uint64_t i = 0; i < n; ++i)
+        {
+            if (!(boost::math::isfinite)(bounds[i].first) || !(boost::math::isfinite)(bounds[i].second))
+            {
+                boost::math::policies::raise_domain_error(function, "Quasi-Monte Carlo integration requires finite bounds, but got %1%.\n", (boost::math::isfinite)(bounds[i].first) ? bounds[i].second : bounds[i].first, Policy());
+                return;
+            }
+            if (bounds[i].second <= bounds[i].first)
+            {
+                boost::math::policies::raise_domain_error(function, "The upper bound is <= the lower bound.\n", bounds[i].second, Policy());
+                return;
+            }
+            m_lbs[i] = bounds[i].first;
+            m_dxs[i] = bounds[i].second - bounds[i].first;
+            m_volume *= m_dxs[i];
+        }
+
+        // If the seed is zero, that tells us to choose a random seed for the user:
+        if (seed == 0)
+        {
+            std::random_device rd;
+            seed = rd();
+        }
+        std::mt19937_64 gen(seed);
+        m_shifts.resize(m_replicates*n);
+        for (auto & s : m_shifts)
+        {
+            s = gen();
+        }
+
+        m_thread_sums.assign(m_num_threads*m_replicates, Real(0));
+        m_thread_compensators.assign(m_num_threads*m_replicates, Real(0));
+        m_next_block = 0;
+        m_error_goal = error_goal;
+        m_start = std::chrono::system_clock::now();
+        m_done = false;
+        m_snapshot.store(Real(0), (std::numeric_limits<Real>::max)(), 0);
+    }
+
+    std::future<Real> integrate()
+    {
+        // Set done to false in case we wish to restart:
+        m_done.store(false); // no round in progress
+        m_start = std::chrono::system_clock::now();
+        return std::async(std::launch::async,
+                          &quasi_monte_carlo::m_integrate, this);
+    }
+
+    void cancel()
+    {
+        // Takes effect at the end of the current round:
+        m_done = true;
+    }
+
+    Real current_error_estimate() const
+    {
+        using std::sqrt;
+        return sqrt(m_snapshot.load().variance);
+    }
+
+    std::chrono::duration<Real> estimated_time_to_completion() const
+    {
+        auto now = std::chrono::system_clock::now();
+        std::chrono::duration<Real> elapsed_seconds = now - m_start;
+        // We assume the worst case of O(N^-1/2) convergence; with a low discrepancy sequence it is usually rather better.
+        Real r = this->current_error_estimate()/m_error_goal.load();
+        if (r*r <= 1) {
+            return 0*elapsed_seconds;
+        }
+        return (r*r - 1)*elapsed_seconds;
+    }
+
+    void update_target_error(Real new_target_error)
+    {
+        m_error_goal = new_target_error;
+    }
+
+    Real progress() const
+    {
+        Real r = m_error_goal.load()/this->current_error_estimate();
+        if (r*r >= 1)
+        {
+            return 1;
+        }
+        return r*r;
+    }
+
+    Real current_estimate() const
+    {
+        return m_snapshot.load().average;
+    }
+
+    // The total number of calls to the integrand, over all the replicates:
+    uint64_t calls() const
+    {
+        return m_snapshot.load().calls;
+    }
+
+    uint64_t replicates() const
+    {
+        return m_replicates;
+    }
+
+private:
+    // The number of points of the sequence evaluated at a time by each thread, for every replicate.
+    // A power of two, so that the Sobol points are evaluated in whole nets:
+    static const uint64_t block_size = 1024;
+
+    //
+    // The integration proceeds in rounds: in each, the threads evaluate the next m_num_threads blocks of the
+    // sequence, and only once they have all finished are their sums combined and the error goal checked.
+    // So the estimate is always taken over an unbroken run of the sequence, and the number of calls
+    // made does not depend on thread timing.
+    //
+    Real m_integrate()
+    {
+        std::function<void(uint64_t)> round = [this](uint64_t thread_index) { m_thread_qmc(thread_index); };
+        do
+        {
+            // Rethrows anything thrown by the integrand:
+            m_pool.run(round);
+            m_next_block += m_num_threads;
+            m_update_estimates();
+        } while (!m_done.load() && (this->calls() < 2*block_size*m_replicates || this->current_error_estimate() > m_error_goal.load()));
+        return this->current_estimate();
+    }
+
+    //
+    // Each replicate uses the same points with a different randomization, so their estimates are
+    // independent, and their spread gives the error estimate:
+    //
+    void m_update_estimates()
+    {
+        // No round is in progress, so the threads' sums are stable:
+        std::vector<Real> replicate_sums(m_replicates, Real(0));
+        for (uint64_t t = 0; t < m_num_threads; ++t)
+        {
+            for (uint64_t r = 0; r < m_replicates; ++r)
+            {
+                replicate_sums[r] += m_thread_sums[t*m_replicates + r];
+            }
+        }
+        uint64_t points = m_next_block*block_size;
+        Real avg = 0;
+        for (uint64_t r = 0; r < m_replicates; ++r)
+        {
+            replicate_sums[r] *= m_volume/points;
+            avg += replicate_sums[r];
+        }
+        avg /= m_replicates;
+        Real variance = 0;
+        for (uint64_t r = 0; r < m_replicates; ++r)
+        {
+            variance += (replicate_sums[r] - avg)*(replicate_sums[r] - avg);
+        }
+        variance /= (m_replicates - 1);
+        // Publish the variance of the mean of the replicates, whose square root is the error estimate:
+        m_snapshot.store(avg, variance/m_replicates, points*m_replicates);
+    }
+
+    void m_thread_qmc(uint64_t thread_index)
+    {
+        uint64_t n = m_lbs.size();
+        detail::qmc_point_generator<Real> generator(m_sequence, n);
+        std::vector<Real> x(n);
+        std::vector<Real> block_sums(m_replicates, Real(0));
+        generator.seek((m_next_block + thread_index)*block_size);
+        for (uint64_t j = 0; j < block_size; ++j)
+        {
+            generator.next();
+            for (uint64_t r = 0; r < m_replicates; ++r)
+            {
+                generator.randomized_point(&m_shifts[r*n], x);
+                for (uint64_t i = 0; i < n; ++i)
+                {
+                    x[i] = m_lbs[i] + x[i]*m_dxs[i];
+                }
+                Real f = m_integrand(x);
+                if (!(boost::math::isfinite)(f))
+                {
+                    std::stringstream os;
+                    os << "Your integrand was evaluated at {";
+                    for (uint64_t i = 0; i < x.size() - 1; ++i)
+                    {
+                        os << x[i] << ", ";
+                    }
+                    os << x[x.size() - 1] << "}, and returned " << f << std::endl;
+                    static const char* function = "boost::math::quadrature::quasi_monte_carlo<%1%>";
+                    boost::math::policies::raise_domain_error(function, os.str().c_str(), /*this is a dummy arg to make it compile*/ 7.2, Policy());
+                }
+                block_sums[r] += f;
+            }
+        }
+        for (uint64_t r = 0; r < m_replicates; ++r)
+        {
+            // Kahan summation, so that the running sums do not drift over long computations:
+            Real& sum = m_thread_sums[thread_index*m_replicates + r];
+            Real& compensator = m_thread_compensators[thread_index*m_replicates + r];
+            Real y = block_sums[r] - compensator;
+            Real t = sum + y;
+            compensator = (t - sum) - y;
+            sum = t;
+        }
+    }
+
+    std::function<Real(std::vector<Real> const &)> m_integrand;
+    low_discrepancy_sequence m_sequence;
+    uint64_t m_num_threads;
+    uint64_t m_replicates;
+    boost::atomic<Real> m_error_goal;
+    boost::atomic<bool> m_done;
+    std::vector<Real> m_lbs;
+    std::vector<Real> m_dxs;
+    Real m_volume;
+    std::vector<std::uint64_t> m_shifts;
+    // The number of blocks of the sequence evaluated by the completed rounds:
+    uint64_t m_next_block;
+    // Only the owning thread touches its sums while a round is in progress, and only the integrating
+    // thread between rounds, with the thread pool providing the synchronization:
+    std::vector<Real> m_thread_sums;
+    std::vector<Real> m_thread_compensators;
+    detail::monte_carlo_snapshot<Real> m_snapshot;
+    std::chrono::time_point<std::chrono::system_clock> m_start;
+    // Last, so that the threads are stopped before anything they use is destroyed:
+    detail::monte_carlo_thread_pool m_pool;
+};
+
+}}}
+#endif
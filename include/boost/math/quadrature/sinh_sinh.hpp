@@ -19,6 +19,7 @@
 #include <limits>
 #include <memory>
 #include <boost/math/quadrature/detail/sinh_sinh_detail.hpp>
+#include <boost/math/quadrature/detail/shared_tables.hpp>
 
 namespace boost{ namespace math{ namespace quadrature {
 
@@ -28,14 +29,27 @@ class sinh_sinh
 public:
     sinh_sinh(size_t max_refinements = 9)
         : m_imp(std::make_shared<detail::sinh_sinh_detail<Real, Policy> >(max_refinements)) {}
+    //
+    // Returns an integrator whose tables are fully computed and shared with every other integrator
+    // obtained from this function with the same max_refinements:
+    //
+    static sinh_sinh shared(size_t max_refinements = 9)
+    {
+        typedef detail::sinh_sinh_detail<Real, Policy> detail_type;
+        return sinh_sinh(detail::shared_tables<detail_type, size_t>::get(max_refinements,
+           [&]() { return std::make_shared<detail_type>(max_refinements); }));
+    }
 
     template<class F>
-    auto integrate(const F f, Real tol = boost::math::tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr)->decltype(std::declval<F>()(std::declval<Real>())) const
+    auto integrate(const F f, Real tol = boost::math::tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr, quadrature_statistics<Real>* stats = nullptr)->decltype(std::declval<F>()(std::declval<Real>())) const
     {
-        return m_imp->integrate(f, tol, error, L1, levels);
+        detail::quadrature_statistics_scope<Real> scope(stats);
+        return m_imp->integrate(f, tol, error, L1, levels, stats);
     }
 
 private:
+    explicit sinh_sinh(const std::shared_ptr<detail::sinh_sinh_detail<Real, Policy>>& imp) : m_imp(imp) {}
+
     std::shared_ptr<detail::sinh_sinh_detail<Real, Policy>> m_imp;
 };
 
@@ -29,195 +29,223 @@
 #ifndef BOOST_MATH_QUADRATURE_TANH_SINH_HPP
 #define BOOST_MATH_QUADRATURE_TANH_SINH_HPP
 
+#include <chrono>
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <utility>
 #include <boost/math/quadrature/detail/tanh_sinh_detail.hpp>
+#include <boost/math/quadrature/detail/mapped_integrand.hpp>
+#include <boost/math/quadrature/detail/vector_valued.hpp>
+#include <boost/math/quadrature/detail/shared_tables.hpp>
 
 namespace boost{ namespace math{ namespace quadrature {
 
+template<class Real, class F, class Policy>
+class tanh_sinh_session;
+
 template<class Real, class Policy = policies::policy<> >
 class tanh_sinh
 {
 public:
     tanh_sinh(size_t max_refinements = 15, const Real& min_complement = tools::min_value<Real>() * 4)
     : m_imp(std::make_shared<detail::tanh_sinh_detail<Real, Policy>>(max_refinements, min_complement)) {}
+    //
+    // Returns an integrator whose tables are fully computed and shared with every other integrator
+    // obtained from this function with the same arguments:
+    //
+    static tanh_sinh shared(size_t max_refinements = 15, const Real& min_complement = tools::min_value<Real>() * 4)
+    {
+       typedef detail::tanh_sinh_detail<Real, Policy> detail_type;
+       return tanh_sinh(detail::shared_tables<detail_type, std::pair<size_t, Real> >::get(std::make_pair(max_refinements, min_complement),
+          [&]() { return std::make_shared<detail_type>(max_refinements, min_complement); }));
+    }
 
     template<class F>
-    auto integrate(const F f, Real a, Real b, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) ->decltype(std::declval<F>()(std::declval<Real>())) const;
+    auto integrate(const F f, Real a, Real b, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr, quadrature_statistics<Real>* stats = nullptr) ->typename detail::enable_if_scalar_valued<decltype(std::declval<F>()(std::declval<Real>()))>::type const;
     template<class F>
-    auto integrate(const F f, Real a, Real b, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) ->decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) const;
+    auto integrate(const F f, Real a, Real b, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr, quadrature_statistics<Real>* stats = nullptr) ->decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) const;
 
     template<class F>
-    auto integrate(const F f, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) ->decltype(std::declval<F>()(std::declval<Real>())) const;
+    auto integrate(const F f, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr, quadrature_statistics<Real>* stats = nullptr) ->typename detail::enable_if_scalar_valued<decltype(std::declval<F>()(std::declval<Real>()))>::type const;
+    //
+    // Vectorized integrand: f(x, y, n) is called once per refinement level with all the abscissa values
+    // for that level in x[0..n), and must store f(x[i]) in y[i]:
+    //
+    template<class F>
+    auto integrate(const F f, Real a, Real b, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr, quadrature_statistics<Real>* stats = nullptr) ->decltype(std::declval<F>()(std::declval<const Real*>(), std::declval<Real*>(), std::declval<std::size_t>()), Real()) const;
+    template<class F>
+    auto integrate(const F f, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr, quadrature_statistics<Real>* stats = nullptr) ->decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) const;
+    //
+    // Integrands returning a std::array or std::vector: each abscissa is evaluated once for all the components,
+    // and the error estimate and L1 norm are those of the largest absolute value of any component:
+    //
+    template<class F>
+    auto integrate(const F f, Real a, Real b, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr, quadrature_statistics<Real>* stats = nullptr) ->typename detail::enable_if_vector_valued<decltype(std::declval<F>()(std::declval<Real>()))>::type const
+    {
+       detail::vector_valued_integrand<Real, F> g(f);
+       return detail::vector_valued_result(integrate(g, a, b, tolerance, error, L1, levels, stats));
+    }
+    template<class F>
+    auto integrate(const F f, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr, quadrature_statistics<Real>* stats = nullptr) ->typename detail::enable_if_vector_valued<decltype(std::declval<F>()(std::declval<Real>()))>::type const
+    {
+       detail::vector_valued_integrand<Real, F> g(f);
+       return detail::vector_valued_result(integrate(g, tolerance, error, L1, levels, stats));
+    }
+    //
+    // Returns a session which integrates f over [a, b] one refinement level at a time, at the caller's pace,
+    // sharing this integrator's tables:
+    //
     template<class F>
-    auto integrate(const F f, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) ->decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) const;
+    tanh_sinh_session<Real, F, Policy> session(const F& f, Real a, Real b) const
+    {
+       return tanh_sinh_session<Real, F, Policy>(m_imp, f, a, b);
+    }
 
 private:
+    explicit tanh_sinh(const std::shared_ptr<detail::tanh_sinh_detail<Real, Policy>>& imp) : m_imp(imp) {}
+
     std::shared_ptr<detail::tanh_sinh_detail<Real, Policy>> m_imp;
 };
 
-template<class Real, class Policy>
-template<class F>
-auto tanh_sinh<Real, Policy>::integrate(const F f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels) ->decltype(std::declval<F>()(std::declval<Real>())) const
+//
+// An integral in progress: each call to refine_one_level() evaluates one more level of abscissa values
+// (roughly doubling the work done so far), after which the current estimate and its error are available.
+// This lets the caller decide when to stop - for instance to share a time budget between many integrals -
+// without ever repeating a function evaluation.  Obtained from tanh_sinh::session.
+//
+template<class Real, class F, class Policy>
+class tanh_sinh_session
 {
-    BOOST_MATH_STD_USING
-    using boost::math::constants::half;
-    using boost::math::quadrature::detail::tanh_sinh_detail;
-
-    static const char* function = "tanh_sinh<%1%>::integrate";
+public:
+   typedef decltype(std::declval<F>()(std::declval<Real>())) result_type;
 
-    typedef decltype(std::declval<F>()(std::declval<Real>())) result_type;
+   //
+   // Evaluates the next level, and returns false if there was none to evaluate, either because the maximum
+   // number of refinements has been reached or because the error estimates have started to increase.
+   //
+   bool refine_one_level();
 
-    if (!(boost::math::isnan)(a) && !(boost::math::isnan)(b))
-    {
+   result_type estimate() const { return m_sign * m_f.scale() * m_state.I1; }
+   // The difference between the last two estimates, or the largest value of Real before there are two:
+   Real error_estimate() const
+   {
+      if (m_f.is_empty())
+         return 0;
+      return m_state.k < 2 ? tools::max_value<Real>() : Real(m_f.scale() * m_state.err);
+   }
+   Real L1() const { return m_f.scale() * m_state.L1_I1; }
+   std::size_t levels() const { return m_state.k; }
+   // True once the error estimate is no more than tolerance times the L1 norm, the test used by tanh_sinh::integrate:
+   bool converged(Real tolerance = tools::root_epsilon<Real>()) const
+   {
+      using std::abs;
+      return m_f.is_empty() || ((m_state.k >= 2) && (m_state.err <= abs(tolerance * m_state.L1_I1)));
+   }
+   // True when refine_one_level() has nothing more to do:
+   bool done() const { return m_done; }
+   // The evaluations, levels and error estimates so far, and the time spent in refine_one_level():
+   const quadrature_statistics<Real>& statistics() const { return m_stats; }
 
-       // Infinite limits:
-       if ((a <= -tools::max_value<Real>()) && (b >= tools::max_value<Real>()))
-       {
-          auto u = [&](const Real& t, const Real& tc)->result_type
-          { 
-             Real t_sq = t*t; 
-             Real inv;
-             if (t > 0.5f)
-                inv = 1 / ((2 - tc) * tc);
-             else if(t < -0.5)
-                inv = 1 / ((2 + tc) * -tc);
-             else
-                inv = 1 / (1 - t_sq);
-             return f(t*inv)*(1 + t_sq)*inv*inv; 
-          };
-          Real limit = sqrt(tools::min_value<Real>()) * 4;
-          return m_imp->integrate(u, error, L1, function, limit, limit, tolerance, levels);
-       }
+private:
+   friend class tanh_sinh<Real, Policy>;
 
-       // Right limit is infinite:
-       if ((boost::math::isfinite)(a) && (b >= tools::max_value<Real>()))
-       {
-          auto u = [&](const Real& t, const Real& tc)->result_type
-          { 
-             Real z, arg;
-             if (t > -0.5f)
-                z = 1 / (t + 1);
-             else
-                z = -1 / tc;
-             if (t < 0.5)
-                arg = 2 * z + a - 1;
-             else
-                arg = a + tc / (2 - tc);
-             return f(arg)*z*z; 
-          };
-          Real left_limit = sqrt(tools::min_value<Real>()) * 4;
-          result_type Q = Real(2) * m_imp->integrate(u, error, L1, function, left_limit, tools::min_value<Real>(), tolerance, levels);
-          if (L1)
-          {
-             *L1 *= 2;
-          }
+   tanh_sinh_session(const std::shared_ptr<detail::tanh_sinh_detail<Real, Policy>>& imp, const F& f, Real a, Real b)
+      : m_imp(imp), m_sign(b < a ? -1 : 1), m_f(f, b < a ? b : a, b < a ? a : b),
+        m_state(m_f.left_min_complement(), m_f.right_min_complement()), m_done(false)
+   {
+      static const char* function = "tanh_sinh_session<%1%>::tanh_sinh_session";
+      if (!m_f.valid())
+      {
+         m_state.I1 = static_cast<result_type>(policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy()));
+         m_done = true;
+      }
+      else if (m_f.is_empty())
+      {
+         m_done = true;
+      }
+   }
 
-          return Q;
-       }
+   std::shared_ptr<detail::tanh_sinh_detail<Real, Policy>> m_imp;
+   Real m_sign;
+   detail::tanh_sinh_mapped_integrand<Real, F> m_f;
+   detail::tanh_sinh_level_state<Real, result_type> m_state;
+   quadrature_statistics<Real> m_stats;
+   bool m_done;
+};
 
-       if ((boost::math::isfinite)(b) && (a <= -tools::max_value<Real>()))
-       {
-          auto v = [&](const Real& t, const Real& tc)->result_type
-          { 
-             Real z;
-             if (t > -0.5)
-                z = 1 / (t + 1);
-             else
-                z = -1 / tc;
-             Real arg;
-             if (t < 0.5)
-                arg = 2 * z - 1;
-             else
-                arg = tc / (2 - tc);
-             return f(b - arg) * z * z;
-          };
+template<class Real, class F, class Policy>
+bool tanh_sinh_session<Real, F, Policy>::refine_one_level()
+{
+   static const char* function = "tanh_sinh_session<%1%>::refine_one_level";
+   if (m_done)
+   {
+      return false;
+   }
+   std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+   detail::tanh_sinh_scalar_row<Real, detail::tanh_sinh_mapped_integrand<Real, F> > row(m_f);
+   if (m_state.k == 0)
+   {
+      m_imp->first_level(row, m_state, &m_stats);
+   }
+   else
+   {
+      m_imp->refine_level(row, m_state, &m_stats);
+   }
+   m_stats.levels = m_state.k;
+   m_stats.intervals = 1;
+   m_stats.elapsed += std::chrono::steady_clock::now() - start;
+   if (!(boost::math::isfinite)(m_state.I1))
+   {
+      m_done = true;
+      m_state.I1 = policies::raise_evaluation_error(function, "The tanh_sinh quadrature evaluated your function at a singular point and got %1%. Please narrow the bounds of integration or check your function for singularities.", m_state.I1, Policy());
+      return false;
+   }
+   m_done = !m_imp->can_refine(m_state);
+   // A level whose error estimate went up has been discarded:
+   return !m_state.stalled;
+}
 
-          Real left_limit = sqrt(tools::min_value<Real>()) * 4;
-          result_type Q = Real(2) * m_imp->integrate(v, error, L1, function, left_limit, tools::min_value<Real>(), tolerance, levels);
-          if (L1)
-          {
-             *L1 *= 2;
-          }
-          return Q;
-       }
+template<class Real, class Policy>
+template<class F>
+auto tanh_sinh<Real, Policy>::integrate(const F f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels, quadrature_statistics<Real>* stats) ->typename detail::enable_if_scalar_valued<decltype(std::declval<F>()(std::declval<Real>()))>::type const
+{
+    static const char* function = "tanh_sinh<%1%>::integrate";
+    detail::quadrature_statistics_scope<Real> scope(stats);
 
-       if ((boost::math::isfinite)(a) && (boost::math::isfinite)(b))
-       {
-          if (a == b)
-          {
-             return result_type(0);
-          }
-          if (b < a)
-          {
-             return -this->integrate(f, b, a, tolerance, error, L1, levels);
-          }
-          Real avg = (a + b)*half<Real>();
-          Real diff = (b - a)*half<Real>();
-          Real avg_over_diff_m1 = a / diff;
-          Real avg_over_diff_p1 = b / diff;
-          bool have_small_left = fabs(a) < 0.5f;
-          bool have_small_right = fabs(b) < 0.5f;
-          Real left_min_complement = float_next(avg_over_diff_m1) - avg_over_diff_m1;
-          Real min_complement_limit = (std::max)(tools::min_value<Real>(), Real(tools::min_value<Real>() / diff));
-          if (left_min_complement < min_complement_limit)
-             left_min_complement = min_complement_limit;
-          Real right_min_complement = avg_over_diff_p1 - float_prior(avg_over_diff_p1);
-          if (right_min_complement < min_complement_limit)
-             right_min_complement = min_complement_limit;
-          //
-          // These asserts will fail only if rounding errors on
-          // type Real have accumulated so much error that it's
-          // broken our internal logic.  Should that prove to be
-          // a persistent issue, we might need to add a bit of fudge
-          // factor to move left_min_complement and right_min_complement
-          // further from the end points of the range.
-          //
-          BOOST_ASSERT((left_min_complement * diff + a) > a);
-          BOOST_ASSERT((b - right_min_complement * diff) < b);
-          auto u = [&](Real z, Real zc)->result_type
-          { 
-             Real position;
-             if (z < -0.5)
-             {
-                if(have_small_left)
-                  return f(diff * (avg_over_diff_m1 - zc));
-                position = a - diff * zc;
-             }
-             if (z > 0.5)
-             {
-                if(have_small_right)
-                  return f(diff * (avg_over_diff_p1 - zc));
-                position = b - diff * zc;
-             }
-             else
-                position = avg + diff*z;
-             BOOST_ASSERT(position != a);
-             BOOST_ASSERT(position != b);
-             return f(position);
-          };
-          result_type Q = diff*m_imp->integrate(u, error, L1, function, left_min_complement, right_min_complement, tolerance, levels);
+    typedef decltype(std::declval<F>()(std::declval<Real>())) result_type;
 
-          if (L1)
-          {
-             *L1 *= diff;
-          }
-          return Q;
-       }
+    if ((boost::math::isfinite)(a) && (boost::math::isfinite)(b) && (b < a))
+    {
+       return -this->integrate(f, b, a, tolerance, error, L1, levels, stats);
+    }
+    detail::tanh_sinh_mapped_integrand<Real, const F&> u(f, a, b);
+    if (!u.valid())
+    {
+       return policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy());
+    }
+    if (u.is_empty())
+    {
+       return result_type(0);
     }
-    return policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy());
+    result_type Q = u.scale() * m_imp->integrate(u, error, L1, function, u.left_min_complement(), u.right_min_complement(), tolerance, levels, stats);
+    if (L1)
+    {
+       *L1 *= u.scale();
+    }
+    return Q;
 }
 
 template<class Real, class Policy>
 template<class F>
-auto tanh_sinh<Real, Policy>::integrate(const F f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels) ->decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) const
+auto tanh_sinh<Real, Policy>::integrate(const F f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels, quadrature_statistics<Real>* stats) ->decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) const
 {
    BOOST_MATH_STD_USING
       using boost::math::constants::half;
    using boost::math::quadrature::detail::tanh_sinh_detail;
 
    static const char* function = "tanh_sinh<%1%>::integrate";
+   detail::quadrature_statistics_scope<Real> scope(stats);
 
    if ((boost::math::isfinite)(a) && (boost::math::isfinite)(b))
    {
@@ -235,7 +263,7 @@ auto tanh_sinh<Real, Policy>::integrate(const F f, Real a, Real b, Real toleranc
       Real diff = (b - a)*half<Real>();
       Real left_min_complement = tools::min_value<Real>() * 4;
       Real right_min_complement = tools::min_value<Real>() * 4;
-      Real Q = diff*m_imp->integrate(u, error, L1, function, left_min_complement, right_min_complement, tolerance, levels);
+      Real Q = diff*m_imp->integrate(u, error, L1, function, left_min_complement, right_min_complement, tolerance, levels, stats);
 
       if (L1)
       {
@@ -248,22 +276,56 @@ auto tanh_sinh<Real, Policy>::integrate(const F f, Real a, Real b, Real toleranc
 
 template<class Real, class Policy>
 template<class F>
-auto tanh_sinh<Real, Policy>::integrate(const F f, Real tolerance, Real* error, Real* L1, std::size_t* levels) ->decltype(std::declval<F>()(std::declval<Real>())) const
+auto tanh_sinh<Real, Policy>::integrate(const F f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels, quadrature_statistics<Real>* stats) ->decltype(std::declval<F>()(std::declval<const Real*>(), std::declval<Real*>(), std::declval<std::size_t>()), Real()) const
+{
+   static const char* function = "tanh_sinh<%1%>::integrate";
+   detail::quadrature_statistics_scope<Real> scope(stats);
+
+   if ((boost::math::isfinite)(a) && (boost::math::isfinite)(b) && (b < a))
+   {
+      return -this->integrate(f, b, a, tolerance, error, L1, levels, stats);
+   }
+   //
+   // The same changes of variable as the scalar version above, except that the Jacobian is
+   // applied to the values f returns for a whole row, rather than to each f(x) in turn:
+   //
+   detail::tanh_sinh_mapped_integrand<Real, const F&> u(f, a, b);
+   if (!u.valid())
+   {
+      return policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy());
+   }
+   if (u.is_empty())
+   {
+      return Real(0);
+   }
+   Real Q = u.scale() * m_imp->integrate_vectorized(f, u, error, L1, function, u.left_min_complement(), u.right_min_complement(), tolerance, levels, stats);
+   if (L1)
+   {
+      *L1 *= u.scale();
+   }
+   return Q;
+}
+
+template<class Real, class Policy>
+template<class F>
+auto tanh_sinh<Real, Policy>::integrate(const F f, Real tolerance, Real* error, Real* L1, std::size_t* levels, quadrature_statistics<Real>* stats) ->typename detail::enable_if_scalar_valued<decltype(std::declval<F>()(std::declval<Real>()))>::type const
 {
    using boost::math::quadrature::detail::tanh_sinh_detail;
    static const char* function = "tanh_sinh<%1%>::integrate";
+   detail::quadrature_statistics_scope<Real> scope(stats);
    Real min_complement = tools::epsilon<Real>();
-   return m_imp->integrate([&](const Real& arg, const Real&) { return f(arg); }, error, L1, function, min_complement, min_complement, tolerance, levels);
+   return m_imp->integrate([&](const Real& arg, const Real&) { return f(arg); }, error, L1, function, min_complement, min_complement, tolerance, levels, stats);
 }
 
 template<class Real, class Policy>
 template<class F>
-auto tanh_sinh<Real, Policy>::integrate(const F f, Real tolerance, Real* error, Real* L1, std::size_t* levels) ->decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) const
+auto tanh_sinh<Real, Policy>::integrate(const F f, Real tolerance, Real* error, Real* L1, std::size_t* levels, quadrature_statistics<Real>* stats) ->decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) const
 {
    using boost::math::quadrature::detail::tanh_sinh_detail;
    static const char* function = "tanh_sinh<%1%>::integrate";
+   detail::quadrature_statistics_scope<Real> scope(stats);
    Real min_complement = tools::min_value<Real>() * 4;
-   return m_imp->integrate(f, error, L1, function, min_complement, min_complement, tolerance, levels);
+   return m_imp->integrate(f, error, L1, function, min_complement, min_complement, tolerance, levels, stats);
 }
 
 }
@@ -18,17 +18,22 @@
 #include <cmath>
 #include <limits>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>
 #include <boost/math/policies/error_handling.hpp>
+#include <boost/math/tools/precision.hpp>
 #include <boost/math/tools/cxx03_warn.hpp>
+#include <boost/math/quadrature/quadrature_statistics.hpp>
 
 namespace boost{ namespace math{ namespace quadrature {
 
 template<class F, class Real, class Policy>
-auto trapezoidal(F f, Real a, Real b, Real tol, std::size_t max_refinements, Real* error_estimate, Real* L1, const Policy& pol)->decltype(std::declval<F>()(std::declval<Real>()))
+auto trapezoidal(F f, Real a, Real b, Real tol, std::size_t max_refinements, Real* error_estimate, Real* L1, const Policy& pol, quadrature_statistics<Real>* stats = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
 {
     static const char* function = "boost::math::quadrature::trapezoidal<%1%>(F, %1%, %1%, %1%)";
+    detail::quadrature_statistics_scope<Real> scope(stats);
     using std::abs;
     using boost::math::constants::half;
     // In many math texts, K represents the field of real or complex numbers.
@@ -49,7 +54,7 @@ auto trapezoidal(F f, Real a, Real b, Real tol, std::size_t max_refinements, Rea
     }
     if(a > b)
     {
-        return -trapezoidal(f, b, a, tol, max_refinements, error_estimate, L1, pol);
+        return -trapezoidal(f, b, a, tol, max_refinements, error_estimate, L1, pol, stats);
     }
 
 
@@ -71,6 +76,11 @@ auto trapezoidal(F f, Real a, Real b, Real tol, std::size_t max_refinements, Rea
     // Otherwise, we could terminate prematurely and miss essential features.
     // This is of course possible anyway, but 20 samples seems to be a reasonable compromise.
     Real error = abs(I0 - I1);
+    if (stats)
+    {
+        stats->evaluations = 3;
+        stats->errors.push_back(error);
+    }
     // I take k < 5, rather than k < 4, or some other smaller minimum number,
     // because I hit a truly exceptional bug where the k = 2 and k =3 refinement were bitwise equal,
     // but the quadrature had not yet converged.
@@ -97,6 +107,11 @@ auto trapezoidal(F f, Real a, Real b, Real tol, std::size_t max_refinements, Rea
         IL1 += absum*h;
         ++k;
         error = abs(I0 - I1);
+        if (stats)
+        {
+            stats->evaluations += p / 2;
+            stats->errors.push_back(error);
+        }
     }
 
     if (error_estimate)
@@ -109,6 +124,12 @@ auto trapezoidal(F f, Real a, Real b, Real tol, std::size_t max_refinements, Rea
         *L1 = IL1;
     }
 
+    if (stats)
+    {
+        stats->levels = k;
+        stats->intervals = 1;
+    }
+
     return static_cast<K>(I1);
 }
 #if BOOST_WORKAROUND(BOOST_MSVC, < 1800)
@@ -130,5 +151,263 @@ auto trapezoidal(F f, Real a, Real b, Real tol = boost::math::tools::root_epsilo
    return trapezoidal(f, a, b, tol, max_refinements, error_estimate, L1, boost::math::policies::policy<>());
 }
 
+//
+// The sequence of trapezoidal estimates T_0, T_1, ... of the integral over [a, b], where T_k uses 2^k intervals.
+// Each call to refine() adds one more level, reusing every sample taken so far, so an estimate may be
+// refined further at any later time.  The Romberg tableau is updated along with the trapezoidal sums, so that
+// the Richardson extrapolated estimate is also available at no extra cost in evaluations of the integrand.
+//
+// If the integrand is periodic with period b - a, then f(b) = f(a) and the right endpoint is never evaluated.
+//
+template<class Real, class K = Real, class Policy = boost::math::policies::policy<> >
+class trapezoidal_state
+{
+public:
+    typedef Real value_type;
+    typedef K result_type;
+
+    trapezoidal_state(Real a, Real b, bool periodic = false)
+       : m_a(a), m_b(b), m_h(0), m_sign(1), m_periodic(periodic), m_levels(0), m_evaluations(0), m_I(0), m_IL(0),
+         m_error(boost::math::tools::max_value<Real>()), m_previous_error(boost::math::tools::max_value<Real>()),
+         m_romberg_error(boost::math::tools::max_value<Real>())
+    {
+        static const char* function = "boost::math::quadrature::trapezoidal_state<%1%>::trapezoidal_state";
+        if (!(boost::math::isfinite)(a))
+        {
+           m_a = boost::math::policies::raise_domain_error(function, "Left endpoint of integration must be finite for adaptive trapezoidal integration but got a = %1%.\n", a, Policy());
+        }
+        if (!(boost::math::isfinite)(b))
+        {
+           m_b = boost::math::policies::raise_domain_error(function, "Right endpoint of integration must be finite for adaptive trapezoidal integration but got b = %1%.\n", b, Policy());
+        }
+        if (m_a > m_b)
+        {
+            std::swap(m_a, m_b);
+            m_sign = -1;
+        }
+        m_h = m_b - m_a;
+    }
+
+    // Adds one more level, halving the step size, and returns the new trapezoidal estimate:
+    template<class F>
+    K refine(F f)
+    {
+        using std::abs;
+        using boost::math::constants::half;
+        K I_previous = m_I;
+        if (m_levels == 0)
+        {
+            K ya = f(m_a);
+            if (m_periodic)
+            {
+                m_I = ya*m_h;
+                m_IL = abs(ya)*m_h;
+                m_evaluations = 1;
+            }
+            else
+            {
+                K yb = f(m_b);
+                m_I = (ya + yb)*m_h*half<Real>();
+                m_IL = (abs(ya) + abs(yb))*m_h*half<Real>();
+                m_evaluations = 2;
+            }
+        }
+        else
+        {
+            // T_k = 1/2 T_{k-1} + h \sum_{j odd, j < 2^k} f(a + jh), h = (b-a)/2^k
+            std::size_t p = static_cast<std::size_t>(1u) << m_levels;
+            m_h *= half<Real>();
+            K sum(0);
+            Real absum = 0;
+            for (std::size_t j = 1; j < p; j += 2)
+            {
+                K y = f(m_a + j*m_h);
+                sum += y;
+                absum += abs(y);
+            }
+            m_I = m_I*half<Real>() + sum*m_h;
+            m_IL = m_IL*half<Real>() + absum*m_h;
+            m_evaluations += p / 2;
+            m_previous_error = m_error;
+            m_error = abs(m_I - I_previous);
+        }
+
+        // Extend the Romberg tableau by one row, overwriting the previous row in place:
+        K diagonal = m_levels ? m_romberg.back() : K(0);
+        m_romberg.push_back(K(0));
+        K previous = m_romberg[0];
+        m_romberg[0] = m_I;
+        Real factor = 4;
+        for (std::size_t j = 1; j <= m_levels; ++j)
+        {
+            K next = m_romberg[j];
+            m_romberg[j] = m_romberg[j - 1] + (m_romberg[j - 1] - previous)/(factor - 1);
+            previous = next;
+            factor *= 4;
+        }
+        if (m_levels)
+        {
+            m_romberg_error = abs(m_romberg.back() - diagonal);
+        }
+        ++m_levels;
+        return trapezoid();
+    }
+
+    // The current trapezoidal estimate, and the difference from the previous one:
+    K trapezoid() const { return m_sign*m_I; }
+    Real error_estimate() const { return m_error; }
+
+    // The current Richardson extrapolated estimate, and the difference from the previous one:
+    K romberg() const { return m_levels ? K(m_sign*m_romberg.back()) : K(0); }
+    Real romberg_error_estimate() const { return m_romberg_error; }
+
+    // An estimate of the error in the trapezoidal estimate which assumes exponential convergence, as is the case
+    // for periodic integrands: if the error in T_k is C r^(2^k), then the difference e_k between successive levels
+    // is approximately the error in T_{k-1}, and the error in T_k is approximately e_k (e_k/e_{k-1})^2:
+    Real periodic_error_estimate() const
+    {
+        if ((m_levels > 2) && (m_error < m_previous_error))
+        {
+            Real r = m_error/m_previous_error;
+            return m_error*r*r;
+        }
+        return m_error;
+    }
+
+    Real L1() const { return m_IL; }
+    std::size_t levels() const { return m_levels; }
+    std::size_t evaluations() const { return m_evaluations; }
+    bool periodic() const { return m_periodic; }
+
+private:
+    Real m_a;
+    Real m_b;
+    Real m_h;
+    Real m_sign;
+    bool m_periodic;
+    std::size_t m_levels;
+    std::size_t m_evaluations;
+    K m_I;
+    Real m_IL;
+    Real m_error;
+    Real m_previous_error;
+    Real m_romberg_error;
+    std::vector<K> m_romberg;
+};
+
+namespace detail {
+
+//
+// Refines state until the given error estimate passes below tol times the L1 norm, or max_refinements levels have been used:
+//
+template<class F, class Real, class K, class Policy, class Error>
+K refine_trapezoidal_state(F& f, trapezoidal_state<Real, K, Policy>& state, Real tol, std::size_t min_refinements, std::size_t max_refinements, Error error, quadrature_statistics<Real>* stats)
+{
+    while (state.levels() < min_refinements || (state.levels() < max_refinements && error(state) > tol*state.L1()))
+    {
+        state.refine(f);
+        if (stats && (state.levels() > 1))
+        {
+            stats->errors.push_back(error(state));
+        }
+    }
+    if (stats)
+    {
+        stats->evaluations = state.evaluations();
+        stats->levels = state.levels();
+        stats->intervals = 1;
+    }
+    return state.trapezoid();
+}
+
+}
+
+//
+// Romberg integration: Richardson extrapolation of the trapezoidal sums.  Converges rapidly for smooth
+// integrands which are not periodic, and which the plain trapezoidal rule integrates only to O(h^2).
+//
+template<class F, class Real, class Policy>
+auto romberg(F f, Real a, Real b, Real tol, std::size_t max_refinements, Real* error_estimate, Real* L1, const Policy& pol, quadrature_statistics<Real>* stats = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+{
+    static const char* function = "boost::math::quadrature::romberg<%1%>(F, %1%, %1%, %1%)";
+    detail::quadrature_statistics_scope<Real> scope(stats);
+    typedef decltype(f(a)) K;
+    if (!(boost::math::isfinite)(a))
+    {
+       return static_cast<K>(boost::math::policies::raise_domain_error(function, "Left endpoint of integration must be finite for Romberg integration but got a = %1%.\n", a, pol));
+    }
+    if (!(boost::math::isfinite)(b))
+    {
+       return static_cast<K>(boost::math::policies::raise_domain_error(function, "Right endpoint of integration must be finite for Romberg integration but got b = %1%.\n", b, pol));
+    }
+    if (a == b)
+    {
+        return static_cast<K>(0);
+    }
+
+    trapezoidal_state<Real, K, Policy> state(a, b);
+    // At least 4 levels (9 samples) are taken, for the same reason as in trapezoidal: a coincidental agreement
+    // of the first few estimates should not terminate the integration.
+    detail::refine_trapezoidal_state(f, state, tol, 4, max_refinements, [](const trapezoidal_state<Real, K, Policy>& s) { return s.romberg_error_estimate(); }, stats);
+    if (error_estimate)
+    {
+        *error_estimate = state.romberg_error_estimate();
+    }
+    if (L1)
+    {
+        *L1 = state.L1();
+    }
+    return state.romberg();
+}
+
+template<class F, class Real>
+auto romberg(F f, Real a, Real b, Real tol = boost::math::tools::root_epsilon<Real>(), std::size_t max_refinements = 12, Real* error_estimate = nullptr, Real* L1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+{
+   return romberg(f, a, b, tol, max_refinements, error_estimate, L1, boost::math::policies::policy<>());
+}
+
+//
+// The trapezoidal rule for an integrand which is periodic on [a, b].  The right endpoint is never evaluated,
+// and the error estimate assumes exponential convergence, so that the integration stops as soon as the
+// estimated error in the current level - rather than the difference from the previous level - passes below tol.
+//
+template<class F, class Real, class Policy>
+auto periodic_trapezoidal(F f, Real a, Real b, Real tol, std::size_t max_refinements, Real* error_estimate, Real* L1, const Policy& pol, quadrature_statistics<Real>* stats = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+{
+    static const char* function = "boost::math::quadrature::periodic_trapezoidal<%1%>(F, %1%, %1%, %1%)";
+    detail::quadrature_statistics_scope<Real> scope(stats);
+    typedef decltype(f(a)) K;
+    if (!(boost::math::isfinite)(a))
+    {
+       return static_cast<K>(boost::math::policies::raise_domain_error(function, "Left endpoint of integration must be finite for periodic trapezoidal integration but got a = %1%.\n", a, pol));
+    }
+    if (!(boost::math::isfinite)(b))
+    {
+       return static_cast<K>(boost::math::policies::raise_domain_error(function, "Right endpoint of integration must be finite for periodic trapezoidal integration but got b = %1%.\n", b, pol));
+    }
+    if (a == b)
+    {
+        return static_cast<K>(0);
+    }
+
+    trapezoidal_state<Real, K, Policy> state(a, b, true);
+    K I = detail::refine_trapezoidal_state(f, state, tol, 4, max_refinements, [](const trapezoidal_state<Real, K, Policy>& s) { return s.periodic_error_estimate(); }, stats);
+    if (error_estimate)
+    {
+        *error_estimate = state.periodic_error_estimate();
+    }
+    if (L1)
+    {
+        *L1 = state.L1();
+    }
+    return I;
+}
+
+template<class F, class Real>
+auto periodic_trapezoidal(F f, Real a, Real b, Real tol = 4*boost::math::tools::epsilon<Real>(), std::size_t max_refinements = 12, Real* error_estimate = nullptr, Real* L1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+{
+   return periodic_trapezoidal(f, a, b, tol, max_refinements, error_estimate, L1, boost::math::policies::policy<>());
+}
+
 }}}
 #endif
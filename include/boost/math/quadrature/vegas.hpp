@@ -0,0 +1,424 @@
+/*
+ * Copyright The Boost.Math contributors, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef BOOST_MATH_QUADRATURE_VEGAS_HPP
+#define BOOST_MATH_QUADRATURE_VEGAS_HPP
+#include <sstream>
+#include <algorithm>
+#include <vector>
+#include <boost/atomic.hpp>
+#include <functional>
+#include <future>
+#include <thread>
+#include <memory>
+#include <utility>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/quadrature/detail/monte_carlo.hpp>
+
+namespace boost { namespace math { namespace quadrature {
+
+//
+// Adaptive Monte-Carlo integration by the VEGAS algorithm:
+//
+// G. P. Lepage, "A new algorithm for adaptive multidimensional integration", J. Comput. Phys. 27 (1978), 192-203.
+//
+// The samples are drawn from a separable density: along each axis of the unit hypercube (before the mapping
+// onto the domain of integration) the density is piecewise constant on a grid of bins of equal probability.
+// Each iteration estimates the integral with the current grid, and then moves the bin edges so that the bins
+// shrink where the integrand is large, concentrating the samples where they contribute most to the variance.
+// The estimates of the iterations are combined weighted by the inverse of their variances.
+//
+template<class Real, class F, class RandomNumberGenerator = std::mt19937_64, class Policy = boost::math::policies::policy<>>
+class vegas
+{
+public:
+    vegas(const F& integrand,
+          std::vector<std::pair<Real, Real>> const & bounds,
+          Real error_goal,
+          bool singular = true,
+          uint64_t threads = std::thread::hardware_concurrency(),
+          uint64_t seed = 0,
+          uint64_t calls_per_iteration = 16384)
+      : m_domain(bounds, singular, "boost::math::quadrature::vegas<%1%>"), m_pool(threads)
+    {
+        m_num_threads = m_pool.size();
+        m_dimension = m_domain.dimension();
+        m_integrand = [this, &integrand](std::vector<Real> & x)->Real
+        {
+            Real coeff = m_domain.transform(x);
+            return coeff*integrand(x);
+        };
+
+        // If the seed is zero, that tells us to choose a random seed for the user:
+        if (seed == 0)
+        {
+            std::random_device rd;
+            seed = rd();
+        }
+        // Share the calls of each iteration between the threads as evenly as possible:
+        calls_per_iteration = (std::max)(calls_per_iteration, 2*m_num_threads);
+        m_thread_states.reset(new thread_state[m_num_threads]);
+        for (uint64_t i = 0; i < m_num_threads; ++i)
+        {
+            thread_state& state = m_thread_states[i];
+            state.gen.seed(static_cast<typename RandomNumberGenerator::result_type>(detail::monte_carlo_stream_seed(seed, i)));
+            state.calls_per_iteration = calls_per_iteration/m_num_threads + (i < calls_per_iteration % m_num_threads ? 1 : 0);
+            state.bin_sums.resize(m_dimension*bins);
+        }
+
+        // Start from a uniform grid:
+        m_grid.resize(m_dimension*(bins + 1));
+        for (uint64_t j = 0; j < m_dimension; ++j)
+        {
+            for (uint64_t i = 0; i <= bins; ++i)
+            {
+                m_grid[j*(bins + 1) + i] = Real(i)/bins;
+            }
+        }
+
+        m_error_goal = error_goal; // relaxed store
+        m_start = std::chrono::system_clock::now();
+        m_done = false; // relaxed store
+        m_iterations = 0;
+        m_chi_squared = 0;
+        m_sum_weights = 0;
+        m_sum_weighted_estimates = 0;
+        m_sum_weighted_squares = 0;
+        m_exact = false;
+        m_snapshot.store(0, (std::numeric_limits<Real>::max)(), 0);
+    }
+
+    std::future<Real> integrate()
+    {
+        // Set done to false in case we wish to restart:
+        m_done.store(false); // relaxed store, no iteration in progress
+        m_start = std::chrono::system_clock::now();
+        return std::async(std::launch::async,
+                          &vegas::m_integrate, this);
+    }
+
+    void cancel()
+    {
+        // Takes effect at the end of the current iteration:
+        m_done = true; // relaxed store
+    }
+
+    Real current_error_estimate() const
+    {
+        using std::sqrt;
+        return sqrt(m_snapshot.load().variance);
+    }
+
+    std::chrono::duration<Real> estimated_time_to_completion() const
+    {
+        auto now = std::chrono::system_clock::now();
+        std::chrono::duration<Real> elapsed_seconds = now - m_start;
+        Real r = this->current_error_estimate()/m_error_goal.load(); // relaxed load
+        if (r*r <= 1) {
+            return 0*elapsed_seconds;
+        }
+        return (r*r - 1)*elapsed_seconds;
+    }
+
+    void update_target_error(Real new_target_error)
+    {
+        m_error_goal = new_target_error;  // relaxed store
+    }
+
+    Real progress() const
+    {
+        Real r = m_error_goal.load()/this->current_error_estimate();  // relaxed load
+        if (r*r >= 1)
+        {
+            return 1;
+        }
+        return r*r;
+    }
+
+    Real current_estimate() const
+    {
+        return m_snapshot.load().average;
+    }
+
+    uint64_t calls() const
+    {
+        return m_snapshot.load().calls;
+    }
+
+    uint64_t iterations() const
+    {
+        return m_iterations.load();
+    }
+
+    //
+    // The chi-squared per degree of freedom of the estimates of the iterations which were combined.
+    // If this is much larger than one, the estimates are inconsistent with each other: the grid has
+    // not yet adapted to the integrand, and the error estimate is unreliable.
+    //
+    Real chi_squared() const
+    {
+        return m_chi_squared.load();
+    }
+
+private:
+    // The number of bins along each axis, and how strongly the grid is adapted at each iteration:
+    static const uint64_t bins = 50;
+    static Real damping() { return Real(3)/2; }
+    // The first iteration samples uniformly, and is used only to train the grid; so an error
+    // estimate requires at least two more:
+    static const uint64_t min_iterations = 3;
+
+    Real m_integrate()
+    {
+        std::function<void(uint64_t)> iteration = [this](uint64_t thread_index) { m_thread_vegas(thread_index); };
+        do
+        {
+            // Rethrows anything thrown by the integrand:
+            m_pool.run(iteration);
+            m_update_estimate();
+            m_refine_grid();
+        } while (!m_done.load() && ((!m_exact && m_iterations < min_iterations) || this->current_error_estimate() > m_error_goal.load()));
+        return this->current_estimate();
+    }
+
+    //
+    // Combines the threads' accumulators into an estimate from this iteration, and that with the
+    // estimates from previous iterations:
+    //
+    void m_update_estimate()
+    {
+        using std::sqrt;
+        uint64_t calls = 0;
+        Real avg = 0;
+        for (uint64_t i = 0; i < m_num_threads; ++i)
+        {
+            calls += m_thread_states[i].calls;
+        }
+        for (uint64_t i = 0; i < m_num_threads; ++i)
+        {
+            avg += m_thread_states[i].average*((Real)m_thread_states[i].calls / (Real)calls);
+        }
+        Real S = 0;
+        for (uint64_t i = 0; i < m_num_threads; ++i)
+        {
+            const thread_state& state = m_thread_states[i];
+            Real delta = state.average - avg;
+            S += state.S + state.calls*delta*delta;
+        }
+        // The variance of the mean of this iteration's samples:
+        Real variance = S/(calls - 1)/calls;
+        uint64_t iterations = ++m_iterations;
+        m_total_calls += calls;
+
+        // On the uniform grid of the first iteration, a constant integrand varies only by rounding error:
+        Real noise = iterations == 1 ? std::numeric_limits<Real>::epsilon()*avg : Real(0);
+        if (variance <= noise*noise)
+        {
+            // A constant integrand: this estimate is exact, and any other is worse.
+            m_exact = true;
+            m_chi_squared = 0;
+            m_snapshot.store(avg, 0, m_total_calls);
+            return;
+        }
+        if (iterations == 1)
+        {
+            // Only used to train the grid:
+            m_snapshot.store(avg, variance, m_total_calls);
+            return;
+        }
+        if (m_exact)
+        {
+            m_snapshot.store(m_snapshot.load().average, 0, m_total_calls);
+            return;
+        }
+        m_sum_weights += 1/variance;
+        m_sum_weighted_estimates += avg/variance;
+        m_sum_weighted_squares += avg*avg/variance;
+        Real estimate = m_sum_weighted_estimates/m_sum_weights;
+        uint64_t combined = iterations - 1;
+        if (combined > 1)
+        {
+            m_chi_squared = (m_sum_weighted_squares - estimate*m_sum_weighted_estimates)/(combined - 1);
+        }
+        m_snapshot.store(estimate, 1/m_sum_weights, m_total_calls);
+    }
+
+    //
+    // Moves the bin edges along each axis so that every bin has an equal share of the (damped)
+    // contributions to the variance, as measured over the last iteration:
+    //
+    void m_refine_grid()
+    {
+        using std::log;
+        using std::pow;
+        std::vector<Real> d(bins);
+        std::vector<Real> w(bins);
+        std::vector<Real> new_edges(bins + 1);
+        for (uint64_t j = 0; j < m_dimension; ++j)
+        {
+            for (uint64_t i = 0; i < bins; ++i)
+            {
+                d[i] = 0;
+                for (uint64_t t = 0; t < m_num_threads; ++t)
+                {
+                    d[i] += m_thread_states[t].bin_sums[j*bins + i];
+                }
+            }
+            // Smooth the contributions with their neighbours, so that a few unlucky samples do not pull the grid about:
+            Real total = 0;
+            for (uint64_t i = 0; i < bins; ++i)
+            {
+                Real left = i > 0 ? d[i - 1] : d[i];
+                Real right = i + 1 < bins ? d[i + 1] : d[i];
+                w[i] = (left + d[i] + right)/3;
+                total += w[i];
+            }
+            if (!(total > 0) || !(boost::math::isfinite)(total))
+            {
+                continue;
+            }
+            Real total_weight = 0;
+            for (uint64_t i = 0; i < bins; ++i)
+            {
+                Real r = w[i]/total;
+                if (r <= 0)
+                {
+                    w[i] = 0;
+                }
+                else if (r >= 1)
+                {
+                    w[i] = 1;
+                }
+                else
+                {
+                    w[i] = pow((r - 1)/log(r), damping());
+                }
+                total_weight += w[i];
+            }
+            Real* edges = &m_grid[j*(bins + 1)];
+            Real per_bin = total_weight/bins;
+            Real accumulated = 0;
+            uint64_t old_bin = 0;
+            new_edges[0] = 0;
+            new_edges[bins] = 1;
+            for (uint64_t k = 1; k < bins; ++k)
+            {
+                Real target = k*per_bin;
+                while (old_bin + 1 < bins && accumulated + w[old_bin] < target)
+                {
+                    accumulated += w[old_bin];
+                    ++old_bin;
+                }
+                Real fraction = w[old_bin] > 0 ? (target - accumulated)/w[old_bin] : Real(0);
+                fraction = (std::min)((std::max)(fraction, Real(0)), Real(1));
+                new_edges[k] = edges[old_bin] + fraction*(edges[old_bin + 1] - edges[old_bin]);
+            }
+            std::copy(new_edges.begin(), new_edges.end(), edges);
+        }
+    }
+
+    void m_thread_vegas(uint64_t thread_index)
+    {
+        thread_state& state = m_thread_states[thread_index];
+        std::vector<Real> x(m_dimension);
+        std::vector<uint64_t> bin(m_dimension);
+        std::fill(state.bin_sums.begin(), state.bin_sums.end(), Real(0));
+        Real inv_denom = (Real) 1/(Real)( (state.gen.max)() - (state.gen.min)()  );
+        Real M1 = 0;
+        Real S = 0;
+        Real compensator = 0;
+        uint64_t k = 0;
+        while (k < state.calls_per_iteration)
+        {
+            // Pick a bin along each axis uniformly at random, and a point uniformly within it:
+            Real jacobian = 1;
+            for (uint64_t j = 0; j < m_dimension; ++j)
+            {
+                Real y = (state.gen() - (state.gen.min)())*inv_denom*bins;
+                uint64_t i = (std::min)(static_cast<uint64_t>(y), bins - 1);
+                const Real* edges = &m_grid[j*(bins + 1)];
+                Real width = edges[i + 1] - edges[i];
+                x[j] = edges[i] + (y - i)*width;
+                jacobian *= bins*width;
+                bin[j] = i;
+            }
+            Real f = jacobian*m_integrand(x);
+            using std::isfinite;
+            if (!isfinite(f))
+            {
+                // The call to m_integrand transform x, so this error message states the correct node.
+                std::stringstream os;
+                os << "Your integrand was evaluated at {";
+                for (uint64_t i = 0; i < x.size() -1; ++i)
+                {
+                     os << x[i] << ", ";
+                }
+                os << x[x.size() -1] << "}, and returned " << f << std::endl;
+                static const char* function = "boost::math::quadrature::vegas<%1%>";
+                boost::math::policies::raise_domain_error(function, os.str().c_str(), /*this is a dummy arg to make it compile*/ 7.2, Policy());
+            }
+            for (uint64_t j = 0; j < m_dimension; ++j)
+            {
+                state.bin_sums[j*bins + bin[j]] += f*f;
+            }
+            ++k;
+            Real term = (f - M1)/k;
+            Real y1 = term - compensator;
+            Real M2 = M1 + y1;
+            compensator = (M2 - M1) - y1;
+            S += (f - M1)*(f - M2);
+            M1 = M2;
+        }
+        state.average = M1;
+        state.S = S;
+        state.calls = k;
+    }
+
+    //
+    // Everything a worker thread updates, padded so that no two threads' states share a cache line.
+    // The accumulators hold the current iteration only:
+    //
+    struct thread_state
+    {
+        RandomNumberGenerator gen;
+        uint64_t calls_per_iteration;
+        Real average;
+        Real S;
+        uint64_t calls;
+        // The sum of the squares of the weighted samples falling in each bin of each axis:
+        std::vector<Real> bin_sums;
+        char padding[detail::monte_carlo_cache_line_size];
+    };
+
+    std::function<Real(std::vector<Real> &)> m_integrand;
+    uint64_t m_num_threads;
+    uint64_t m_dimension;
+    boost::atomic<Real> m_error_goal;
+    boost::atomic<bool> m_done;
+    boost::atomic<uint64_t> m_iterations;
+    boost::atomic<Real> m_chi_squared;
+    uint64_t m_total_calls = 0;
+    Real m_sum_weights;
+    Real m_sum_weighted_estimates;
+    Real m_sum_weighted_squares;
+    bool m_exact;
+    detail::monte_carlo_domain<Real, Policy> m_domain;
+    // The bin edges along each axis of the unit hypercube, bins + 1 per axis:
+    std::vector<Real> m_grid;
+    std::unique_ptr<thread_state[]> m_thread_states;
+    detail::monte_carlo_snapshot<Real> m_snapshot;
+    std::chrono::time_point<std::chrono::system_clock> m_start;
+    // Last, so that the threads are stopped before anything they use is destroyed:
+    detail::monte_carlo_thread_pool m_pool;
+};
+
+}}}
+#endif
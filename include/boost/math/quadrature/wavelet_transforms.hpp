@@ -6,7 +6,15 @@
  */
 #ifndef BOOST_MATH_QUADRATURE_WAVELET_TRANSFORMS_HPP
 #define BOOST_MATH_QUADRATURE_WAVELET_TRANSFORMS_HPP
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 #include <boost/math/special_functions/daubechies_wavelet.hpp>
+#include <boost/math/special_functions/trunc.hpp>
 #include <boost/math/quadrature/trapezoidal.hpp>
 
 namespace boost::math::quadrature {
@@ -35,6 +43,106 @@ public:
         return sqrt(abs(s))*trapezoidal(g, a, b, tol_, max_refinements_);
     }
 
+    // The transform on a grid of scales and equally spaced translations: W[i][j] = Wf(scales[i], t0 + j*h).
+    // f is sampled once at each point t0 + k*h needed by any of the coefficients, and for each scale the wavelet is
+    // sampled once and shared by all the translations, so each coefficient is a sum over the samples under the
+    // support of the dilated wavelet.  Unlike operator(), this is a fixed step rule: there are about |s|(2p-1)/h terms
+    // for scale s, and the accuracy is only good when that is large.  f is called on this thread only; the scales
+    // are shared out between the given number of threads.
+    auto grid(std::vector<Real> const & scales, Real t0, Real h, std::size_t translations,
+              unsigned threads = std::thread::hardware_concurrency()) const
+        ->std::vector<std::vector<decltype(std::declval<F>()(std::declval<Real>()))>>
+    {
+        using std::abs;
+        using std::sqrt;
+        using std::floor;
+        using std::ceil;
+        using std::min;
+        using std::max;
+        using K = decltype(std::declval<F>()(std::declval<Real>()));
+        if (!(h > 0) || !(boost::math::isfinite)(h))
+        {
+            throw std::domain_error("The spacing of the translations must be positive and finite.");
+        }
+        if (!(boost::math::isfinite)(t0))
+        {
+            throw std::domain_error("The first translation must be finite.");
+        }
+        auto [a, b] = psi_.support();
+        // The coefficient at t0 + j*h needs f(t0 + (j + m)*h) for lo(s) <= m <= hi(s), where s*a and s*b bound m*h:
+        auto first = [&](Real s) { return boost::math::lltrunc(ceil(min(s*a, s*b)/h)); };
+        auto last = [&](Real s) { return boost::math::lltrunc(floor(max(s*a, s*b)/h)); };
+        long long lo = 0;
+        long long hi = 0;
+        for (Real s : scales)
+        {
+            if (!(boost::math::isfinite)(s))
+            {
+                throw std::domain_error("The scales must be finite.");
+            }
+            lo = min(lo, first(s));
+            hi = max(hi, last(s));
+        }
+
+        std::vector<std::vector<K>> W(scales.size());
+        if (translations == 0)
+        {
+            return W;
+        }
+        std::vector<K> samples(translations + static_cast<std::size_t>(hi - lo));
+        for (std::size_t k = 0; k < samples.size(); ++k)
+        {
+            samples[k] = f_(t0 + Real(static_cast<long long>(k) + lo)*h);
+        }
+
+        // Each worker claims the next scale until there are none left:
+        std::atomic<std::size_t> next(0);
+        auto worker = [&]() {
+            std::vector<Real> kernel;
+            for (std::size_t i = next++; i < scales.size(); i = next++)
+            {
+                Real s = scales[i];
+                W[i].assign(translations, K(0));
+                if (s == 0)
+                {
+                    continue;
+                }
+                // Trapezoidal rule in x = s*u + t with step h; psi vanishes at the ends of its support,
+                // so the end corrections are zero:
+                long long m0 = first(s);
+                long long m1 = last(s);
+                kernel.clear();
+                for (long long m = m0; m <= m1; ++m)
+                {
+                    kernel.push_back(psi_(Real(m)*h/s));
+                }
+                Real scale = h/sqrt(abs(s));
+                for (std::size_t j = 0; j < translations; ++j)
+                {
+                    K const * y = samples.data() + j + static_cast<std::size_t>(m0 - lo);
+                    K sum = K(0);
+                    for (std::size_t m = 0; m < kernel.size(); ++m)
+                    {
+                        sum += y[m]*kernel[m];
+                    }
+                    W[i][j] = scale*sum;
+                }
+            }
+        };
+        std::size_t workers = min(static_cast<std::size_t>(max(threads, 1u)), max(scales.size(), std::size_t(1)));
+        std::vector<std::future<void>> futures;
+        for (std::size_t w = 1; w < workers; ++w)
+        {
+            futures.push_back(std::async(std::launch::async, worker));
+        }
+        worker();
+        for (auto& fut : futures)
+        {
+            fut.get();
+        }
+        return W;
+    }
+
 private:
     F f_;
     boost::math::daubechies_wavelet<Real, p> psi_;
@@ -6,6 +6,8 @@
 
 #define BOOST_TEST_MODULE adaptive_gauss_kronrod_quadrature_test
 
+#include <array>
+#include <vector>
 #include <boost/config.hpp>
 #include <boost/detail/workaround.hpp>
 
@@ -48,6 +50,7 @@ using std::sin;
 using std::cos;
 using std::string;
 using boost::math::quadrature::gauss_kronrod;
+using boost::math::quadrature::quadrature_statistics;
 using boost::math::constants::pi;
 using boost::math::constants::half_pi;
 using boost::math::constants::two_div_pi;
@@ -236,6 +239,230 @@ void test_left_limit_infinite()
     BOOST_CHECK_CLOSE(Q, Q_expected, 300*tol);
 }
 
+template<class Real, unsigned Points>
+void test_global()
+{
+    std::cout << "Testing globally adaptive Gauss-Kronrod on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    Real tol = boost::math::tools::epsilon<Real>() * 10;
+    Real error;
+    Real L1;
+
+    auto f1 = [](const Real& x) { return atan(x)/(x*(x*x + 1)) ; };
+    Real Q = gauss_kronrod<Real, Points>::integrate_global(f1, 0, 1, 15, get_termination_condition<Real>(), &error, &L1);
+    Real Q_expected = pi<Real>()*ln_two<Real>()/8 + catalan<Real>()*half<Real>();
+    BOOST_CHECK_CLOSE_FRACTION(Q, Q_expected, tol);
+    BOOST_CHECK_CLOSE_FRACTION(L1, Q_expected, tol);
+    BOOST_CHECK_LE(fabs(error / Q), get_termination_condition<Real>());
+    BOOST_CHECK_GE(fabs(error), fabs(Q - Q_expected));
+
+    auto f5 = [](Real t)->Real { return t*t*log(t)/((t*t - 1)*(t*t*t*t + 1)); };
+    Q = gauss_kronrod<Real, Points>::integrate_global(f5, 0, 1, 25, get_termination_condition<Real>());
+    Q_expected = pi<Real>()*pi<Real>()*(2 - root_two<Real>())/32;
+    BOOST_CHECK_CLOSE_FRACTION(Q, Q_expected, 100 * tol);
+
+    //
+    // A kink away from the midpoints: the global strategy should spend its effort near the kink only,
+    // and so use no more evaluations than the recursive one:
+    //
+    std::size_t global_calls = 0;
+    std::size_t local_calls = 0;
+    auto kink = [](const Real& x)->Real { return fabs(x - third<Real>()); };
+    auto g = [&](const Real& x)->Real { ++global_calls; return kink(x); };
+    auto h = [&](const Real& x)->Real { ++local_calls; return kink(x); };
+    Q_expected = (third<Real>() * third<Real>() + 4 * third<Real>() * third<Real>()) / 2;
+    // The error estimate is not a rigorous bound at a kink, and for extended precision types
+    // max_depth is reached long before the tolerance is met, so only modest accuracy is expected:
+    Q = gauss_kronrod<Real, Points>::integrate_global(g, 0, 1, 30, get_termination_condition<Real>());
+    BOOST_CHECK_CLOSE_FRACTION(Q, Q_expected, sqrt(tol));
+    Q = gauss_kronrod<Real, Points>::integrate(h, 0, 1, 30, get_termination_condition<Real>());
+    BOOST_CHECK_LE(global_calls, local_calls);
+
+    // The number of subintervals is bounded, and the error estimate reflects an early stop:
+    global_calls = 0;
+    Q = gauss_kronrod<Real, Points>::integrate_global(g, 0, 1, 30, get_termination_condition<Real>(), &error, &L1, 4);
+    BOOST_CHECK_EQUAL(global_calls, 7 * Points);
+    BOOST_CHECK_GT(error / Q, get_termination_condition<Real>());
+
+    // Infinite limits are mapped to finite ones exactly as integrate() does:
+    auto f6 = [](const Real& t) { return 1/(1+t*t);};
+    Q = gauss_kronrod<Real, Points>::integrate_global(f6, -boost::math::tools::max_value<Real>(), boost::math::tools::max_value<Real>(), 15, get_termination_condition<Real>(), &error, &L1);
+    BOOST_CHECK_CLOSE_FRACTION(Q, pi<Real>(), tol);
+    BOOST_CHECK_CLOSE_FRACTION(L1, pi<Real>(), tol);
+    BOOST_CHECK_LE(fabs(error / Q), get_termination_condition<Real>());
+    Q = gauss_kronrod<Real, Points>::integrate_global(f6, 1, boost::math::tools::max_value<Real>(), 15, get_termination_condition<Real>(), &error, &L1);
+    BOOST_CHECK_CLOSE_FRACTION(Q, pi<Real>()/4, 100*tol);
+    Q = gauss_kronrod<Real, Points>::integrate_global(f6, -boost::math::tools::max_value<Real>(), 0);
+    BOOST_CHECK_CLOSE_FRACTION(Q, half_pi<Real>(), 300*tol);
+    // Reversed limits:
+    Q = gauss_kronrod<Real, Points>::integrate_global(f1, 1, 0);
+    BOOST_CHECK_CLOSE_FRACTION(Q, -(pi<Real>()*ln_two<Real>()/8 + catalan<Real>()*half<Real>()), tol);
+}
+
+template<class Real, unsigned Points>
+void test_vector_valued()
+{
+    std::cout << "Testing vector valued integrands with Gauss-Kronrod on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    Real tol = boost::math::tools::epsilon<Real>() * 10;
+    // Integrands of similar magnitude needing differing amounts of refinement, all on the same nodes:
+    auto f0 = [](const Real& x)->Real { return 5*x*x + 7*x + 12; };
+    auto f1 = [](const Real& x)->Real { return 20 / (1 + 25*x*x); };
+    auto f2 = [](const Real& x)->Real { return 10 * atan(x)/(x*(x*x + 1)); };
+    std::size_t vector_calls = 0;
+    auto f = [&](const Real& x)->std::array<Real, 3>
+    {
+       ++vector_calls;
+       return {{ f0(x), f1(x), f2(x) }};
+    };
+    std::array<Real, 3> Q_expected = {{ (Real) 17 + half<Real>()*third<Real>(), 4 * atan(Real(5)), 10 * (pi<Real>()*ln_two<Real>()/8 + catalan<Real>()*half<Real>()) }};
+    Real error, L1;
+    std::array<Real, 3> Q = gauss_kronrod<Real, Points>::integrate(f, Real(0), Real(1), 15, get_termination_condition<Real>(), &error, &L1);
+    for (unsigned i = 0; i < 3; ++i)
+       BOOST_CHECK_CLOSE_FRACTION(Q[i], Q_expected[i], tol);
+    // The tolerance applies relative to the largest component:
+    BOOST_CHECK_LE(error, get_termination_condition<Real>() * Q[0]);
+    // L1 is the integral of the largest absolute value of any component:
+    for (unsigned i = 0; i < 3; ++i)
+       BOOST_CHECK_GE(L1, Q[i]);
+    BOOST_CHECK_LE(L1, Q[0] + Q[1] + Q[2]);
+
+    // Each node is evaluated once for all the components, so there is less work than integrating each separately:
+    std::size_t scalar_calls = 0;
+    auto g0 = [&](const Real& x)->Real { ++scalar_calls; return f0(x); };
+    auto g1 = [&](const Real& x)->Real { ++scalar_calls; return f1(x); };
+    auto g2 = [&](const Real& x)->Real { ++scalar_calls; return f2(x); };
+    gauss_kronrod<Real, Points>::integrate(g0, Real(0), Real(1), 15, get_termination_condition<Real>());
+    gauss_kronrod<Real, Points>::integrate(g1, Real(0), Real(1), 15, get_termination_condition<Real>());
+    gauss_kronrod<Real, Points>::integrate(g2, Real(0), Real(1), 15, get_termination_condition<Real>());
+    BOOST_CHECK_LT(vector_calls, scalar_calls);
+
+    // std::vector results, globally adaptive:
+    auto h = [](const Real& x)->std::vector<Real>
+    {
+       std::vector<Real> r(2);
+       r[0] = atan(x)/(x*(x*x + 1));
+       r[1] = 2 * r[0];
+       return r;
+    };
+    std::vector<Real> V = gauss_kronrod<Real, Points>::integrate_global(h, Real(0), Real(1), 15, get_termination_condition<Real>(), &error);
+    Real expected = pi<Real>()*ln_two<Real>()/8 + catalan<Real>()*half<Real>();
+    BOOST_CHECK_EQUAL(V.size(), 2u);
+    BOOST_CHECK_CLOSE_FRACTION(V[0], expected, tol);
+    BOOST_CHECK_CLOSE_FRACTION(V[1], 2 * expected, tol);
+    V = gauss_kronrod<Real, Points>::integrate(h, Real(1), Real(0));
+    BOOST_CHECK_CLOSE_FRACTION(V[0], -expected, tol);
+    // The integrand is never called just to find the number of components, so an empty range gives an empty result:
+    std::size_t calls = 0;
+    auto counted = [&](const Real& x) { ++calls; return h(x); };
+    V = gauss_kronrod<Real, Points>::integrate(counted, Real(1), Real(1));
+    BOOST_CHECK(V.empty());
+    V = gauss_kronrod<Real, Points>::integrate_global(counted, Real(1), Real(1));
+    BOOST_CHECK(V.empty());
+    BOOST_CHECK_EQUAL(calls, 0u);
+}
+
+template<class Real, unsigned Points>
+void test_vectorized()
+{
+    std::cout << "Testing vectorized integrands with Gauss-Kronrod on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    typedef gauss_kronrod<Real, Points> rule;
+    Real tol = boost::math::tools::epsilon<Real>() * 10;
+    Real inf = boost::math::tools::max_value<Real>();
+    std::size_t calls = 0;
+    std::size_t points = 0;
+    auto f = [&](const Real* x, Real* y, std::size_t n)
+    {
+       ++calls;
+       points += n;
+       for (std::size_t i = 0; i < n; ++i)
+          y[i] = atan(x[i])/(x[i]*(x[i]*x[i] + 1));
+    };
+    std::size_t scalar_calls = 0;
+    auto g = [&](const Real& x)->Real { ++scalar_calls; return atan(x)/(x*(x*x + 1)); };
+    // The same intervals are refined as for the scalar integrand, each with one call:
+    Real error, L1, scalar_error, scalar_L1;
+    Real Q = rule::integrate(f, Real(0), Real(1), 15, get_termination_condition<Real>(), &error, &L1);
+    Real Q_scalar = rule::integrate(g, Real(0), Real(1), 15, get_termination_condition<Real>(), &scalar_error, &scalar_L1);
+    BOOST_CHECK_CLOSE_FRACTION(Q, Q_scalar, tol);
+    BOOST_CHECK_CLOSE_FRACTION(Q, pi<Real>()*ln_two<Real>()/8 + catalan<Real>()*half<Real>(), tol);
+    BOOST_CHECK_CLOSE_FRACTION(L1, scalar_L1, tol);
+    BOOST_CHECK_EQUAL(points, scalar_calls);
+    BOOST_CHECK_EQUAL(points, calls * Points);
+    Q = rule::integrate(f, Real(1), Real(0));
+    BOOST_CHECK_CLOSE_FRACTION(Q, -Q_scalar, tol);
+    BOOST_CHECK_EQUAL(rule::integrate(f, Real(1), Real(1)), 0);
+
+    // Infinite ranges:
+    auto h = [](const Real* x, Real* y, std::size_t n)
+    {
+       for (std::size_t i = 0; i < n; ++i)
+          y[i] = exp(-x[i]*x[i]/2);
+    };
+    Q = rule::integrate(h, -inf, inf, 15, get_termination_condition<Real>(), &error, &L1);
+    BOOST_CHECK_CLOSE_FRACTION(Q, root_two_pi<Real>(), tol);
+    BOOST_CHECK_CLOSE_FRACTION(L1, root_two_pi<Real>(), tol);
+    Q = rule::integrate(h, Real(0), inf);
+    BOOST_CHECK_CLOSE_FRACTION(Q, half<Real>()*root_two_pi<Real>(), tol);
+    Q = rule::integrate(h, -inf, Real(0));
+    BOOST_CHECK_CLOSE_FRACTION(Q, half<Real>()*root_two_pi<Real>(), tol);
+
+    // Most of the mass far out in the tail, which is mapped from next to -1.  The abscissas are found from their
+    // complements there, so refinement stops at the tolerance rather than chasing rounding errors to the maximum depth:
+    Real s = 1000;
+    auto e = [&](const Real* x, Real* y, std::size_t n)
+    {
+       points += n;
+       for (std::size_t i = 0; i < n; ++i)
+          y[i] = exp(-abs(x[i])/s)/s;
+    };
+    Real tail_tol = boost::math::tools::root_epsilon<Real>() / 10;
+    points = 0;
+    Q = rule::integrate(e, Real(0), inf, 30, tail_tol);
+    BOOST_CHECK_CLOSE_FRACTION(Q, Real(1), tol);
+    BOOST_CHECK_LT(points, 200u * Points);
+    points = 0;
+    Q = rule::integrate(e, -inf, Real(0), 30, tail_tol);
+    BOOST_CHECK_CLOSE_FRACTION(Q, Real(1), tol);
+    BOOST_CHECK_LT(points, 200u * Points);
+}
+
+template<class Real, unsigned Points>
+void test_statistics()
+{
+    std::cout << "Testing integration statistics with Gauss-Kronrod on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    typedef gauss_kronrod<Real, Points> rule;
+    std::size_t calls = 0;
+    auto f = [&](const Real& x)->Real { ++calls; return sqrt(x) * log(x); };
+    Real error, L1;
+    quadrature_statistics<Real> stats;
+    Real Q = rule::integrate(f, Real(0), Real(1), 15, get_termination_condition<Real>(), &error, &L1, &stats);
+    // The endpoint singularity stops refinement at the maximum depth, short of the tolerance for the wider types,
+    // so check the result against the error estimate instead:
+    BOOST_CHECK_LE(abs(Q + Real(4) / 9), error);
+    BOOST_CHECK_EQUAL(stats.evaluations, calls);
+    // The subintervals form a binary tree, each node of which is one application of the rule:
+    BOOST_CHECK_GT(stats.intervals, 1u);
+    BOOST_CHECK_EQUAL(stats.evaluations, Points * (2 * stats.intervals - 1));
+    BOOST_CHECK_GT(stats.levels, 0u);
+    BOOST_CHECK_LE(stats.levels, 15u);
+    // The errors at each depth add up to the total:
+    BOOST_REQUIRE_EQUAL(stats.errors.size(), stats.levels + 1);
+    Real total = 0;
+    for (std::size_t i = 0; i < stats.errors.size(); ++i)
+       total += stats.errors[i];
+    BOOST_CHECK_CLOSE_FRACTION(total, error, 100 * boost::math::tools::epsilon<Real>());
+    BOOST_CHECK_GE(stats.elapsed.count(), 0);
+    calls = 0;
+    BOOST_CHECK_EQUAL(rule::integrate(f, Real(0), Real(1), 15, get_termination_condition<Real>()), Q);
+    BOOST_CHECK_EQUAL(calls, stats.evaluations);
+
+    // A smooth function on an infinite range:
+    auto g = [&](const Real& x)->Real { ++calls; return exp(-x*x/2); };
+    calls = 0;
+    Q = rule::integrate(g, -boost::math::tools::max_value<Real>(), boost::math::tools::max_value<Real>(), 15, get_termination_condition<Real>(), &error, &L1, &stats);
+    BOOST_CHECK_EQUAL(stats.evaluations, calls);
+    BOOST_CHECK_EQUAL(stats.evaluations, Points * (2 * stats.intervals - 1));
+}
+
 BOOST_AUTO_TEST_CASE(gauss_quadrature_test)
 {
 #ifdef TEST1
@@ -247,6 +474,10 @@ BOOST_AUTO_TEST_CASE(gauss_quadrature_test)
     test_integration_over_real_line<double, 15>();
     test_right_limit_infinite<double, 15>();
     test_left_limit_infinite<double, 15>();
+    test_global<double, 15>();
+    test_vector_valued<double, 15>();
+    test_vectorized<double, 15>();
+    test_statistics<double, 15>();
 
     //  test one case where we do not have pre-computed constants:
     std::cout << "Testing with 17 point Gauss-Kronrod rule:\n";
@@ -257,6 +488,9 @@ BOOST_AUTO_TEST_CASE(gauss_quadrature_test)
     test_integration_over_real_line<double, 17>();
     test_right_limit_infinite<double, 17>();
     test_left_limit_infinite<double, 17>();
+    test_global<double, 17>();
+    test_vector_valued<double, 17>();
+    test_vectorized<double, 17>();
 #endif
 #ifdef TEST1A
     std::cout << "Testing with 21 point Gauss-Kronrod rule:\n";
@@ -267,6 +501,10 @@ BOOST_AUTO_TEST_CASE(gauss_quadrature_test)
     test_integration_over_real_line<cpp_bin_float_quad, 21>();
     test_right_limit_infinite<cpp_bin_float_quad, 21>();
     test_left_limit_infinite<cpp_bin_float_quad, 21>();
+    test_global<cpp_bin_float_quad, 21>();
+    test_vector_valued<cpp_bin_float_quad, 21>();
+    test_vectorized<cpp_bin_float_quad, 21>();
+    test_statistics<cpp_bin_float_quad, 21>();
 
     std::cout << "Testing with 31 point Gauss-Kronrod rule:\n";
     test_linear<cpp_bin_float_quad, 31>();
@@ -276,6 +514,8 @@ BOOST_AUTO_TEST_CASE(gauss_quadrature_test)
     test_integration_over_real_line<cpp_bin_float_quad, 31>();
     test_right_limit_infinite<cpp_bin_float_quad, 31>();
     test_left_limit_infinite<cpp_bin_float_quad, 31>();
+    test_global<cpp_bin_float_quad, 31>();
+    test_vector_valued<cpp_bin_float_quad, 31>();
 #endif
 #ifdef TEST2
     std::cout << "Testing with 41 point Gauss-Kronrod rule:\n";
@@ -286,6 +526,8 @@ BOOST_AUTO_TEST_CASE(gauss_quadrature_test)
     test_integration_over_real_line<cpp_bin_float_quad, 41>();
     test_right_limit_infinite<cpp_bin_float_quad, 41>();
     test_left_limit_infinite<cpp_bin_float_quad, 41>();
+    test_global<cpp_bin_float_quad, 41>();
+    test_vector_valued<cpp_bin_float_quad, 41>();
 
     std::cout << "Testing with 51 point Gauss-Kronrod rule:\n";
     test_linear<cpp_bin_float_quad, 51>();
@@ -295,6 +537,8 @@ BOOST_AUTO_TEST_CASE(gauss_quadrature_test)
     test_integration_over_real_line<cpp_bin_float_quad, 51>();
     test_right_limit_infinite<cpp_bin_float_quad, 51>();
     test_left_limit_infinite<cpp_bin_float_quad, 51>();
+    test_global<cpp_bin_float_quad, 51>();
+    test_vector_valued<cpp_bin_float_quad, 51>();
 #endif
 #ifdef TEST3
     std::cout << "Testing with 61 point Gauss-Kronrod rule:\n";
@@ -305,6 +549,8 @@ BOOST_AUTO_TEST_CASE(gauss_quadrature_test)
     test_integration_over_real_line<cpp_bin_float_quad, 61>();
     test_right_limit_infinite<cpp_bin_float_quad, 61>();
     test_left_limit_infinite<cpp_bin_float_quad, 61>();
+    test_global<cpp_bin_float_quad, 61>();
+    test_vector_valued<cpp_bin_float_quad, 61>();
 #endif
 }
 
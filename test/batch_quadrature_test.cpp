@@ -0,0 +1,247 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_TEST_MODULE batch_quadrature_test
+
+#include <boost/config.hpp>
+#include <boost/detail/workaround.hpp>
+
+#if !defined(BOOST_NO_CXX11_DECLTYPE) && !defined(BOOST_NO_CXX11_TRAILING_RESULT_TYPES) && !defined(BOOST_NO_SFINAE_EXPR) && !defined(BOOST_NO_CXX11_HDR_THREAD)
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+#include <boost/type_index.hpp>
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/math/quadrature/batch_quadrature.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+#if !defined(TEST1) && !defined(TEST2)
+#  define TEST1
+#  define TEST2
+#endif
+
+using std::exp;
+using std::sqrt;
+using std::abs;
+using std::vector;
+using boost::math::quadrature::batch_quadrature;
+using boost::math::quadrature::gauss_kronrod;
+using boost::math::quadrature::tanh_sinh;
+using boost::multiprecision::cpp_bin_float_quad;
+
+//
+// The family exp(-p x) over [a, b], with p and the interval varying from item to item:
+//
+template <class Real>
+struct exponential_family
+{
+   exponential_family(std::size_t n) : a(n), b(n), p(n)
+   {
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         a[i] = Real(i % 7) / 4;
+         b[i] = a[i] + 1 + Real(i % 5);
+         p[i] = 1 + Real(i % 11) / 3;
+      }
+   }
+   Real exact(std::size_t i) const
+   {
+      return (exp(-p[i] * a[i]) - exp(-p[i] * b[i])) / p[i];
+   }
+   vector<Real> a, b, p;
+};
+
+template <class Real, unsigned Points>
+void test_gauss_kronrod(unsigned threads)
+{
+   std::cout << "Testing batches of Gauss-Kronrod integrals on " << threads << " threads on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   std::size_t n = 1000;
+   exponential_family<Real> family(n);
+   auto f = [&](Real x, std::size_t i) { return exp(-family.p[i] * x); };
+   vector<Real> Q(n), error(n), L1(n);
+   batch_quadrature<Real> batch(threads);
+   Real tol = 100 * boost::math::tools::epsilon<Real>();
+   batch.integrate(gauss_kronrod<Real, Points>(), f, family.a.data(), family.b.data(), n, Q.data(), error.data(), L1.data(), 15, tol);
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      BOOST_CHECK_CLOSE_FRACTION(Q[i], family.exact(i), tol);
+      BOOST_CHECK_EQUAL(L1[i], Q[i]);
+      // Identical to integrating the item on its own:
+      Real e, l;
+      auto g = [&](Real x) { return f(x, i); };
+      BOOST_CHECK_EQUAL(Q[i], (gauss_kronrod<Real, Points>::integrate(g, family.a[i], family.b[i], 15, tol, &e, &l)));
+      BOOST_CHECK_EQUAL(error[i], e);
+   }
+}
+
+template <class Real>
+void test_tanh_sinh(unsigned threads)
+{
+   std::cout << "Testing batches of tanh-sinh integrals on " << threads << " threads on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   std::size_t n = 500;
+   exponential_family<Real> family(n);
+   // Some items have an endpoint singularity, and so take many more evaluations than others:
+   auto f = [&](Real x, std::size_t i) { return (i % 3 == 0) && (x > family.a[i]) ? exp(-family.p[i] * x) / sqrt(x - family.a[i]) : exp(-family.p[i] * x); };
+   vector<Real> Q(n);
+   batch_quadrature<Real> batch(threads);
+   tanh_sinh<Real> integrator;
+   Real tol = boost::math::tools::root_epsilon<Real>();
+   // The error estimates and L1 norms may be omitted:
+   batch.integrate(integrator, f, family.a.data(), family.b.data(), n, Q.data());
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      auto g = [&](Real x) { return f(x, i); };
+      BOOST_CHECK_EQUAL(Q[i], integrator.integrate(g, family.a[i], family.b[i], tol));
+      if (i % 3)
+         BOOST_CHECK_CLOSE_FRACTION(Q[i], family.exact(i), 100 * boost::math::tools::epsilon<Real>());
+   }
+}
+
+template <class Real>
+void test_every_item_once()
+{
+   std::cout << "Testing every item of a batch is integrated exactly once on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   std::size_t n = 10007;
+   vector<std::atomic<int> > visits(n);
+   for (std::size_t i = 0; i < n; ++i)
+      visits[i] = 0;
+   vector<Real> a(n, Real(0)), b(n, Real(1)), Q(n);
+   auto f = [&](Real x, std::size_t i)
+   {
+      // The 15 point rule integrates a quadratic exactly on the first pass, so f is called 15 times per item:
+      ++visits[i];
+      return Real(i) * x * x;
+   };
+   for (unsigned threads = 1; threads <= 4; ++threads)
+   {
+      for (std::size_t i = 0; i < n; ++i)
+         visits[i] = 0;
+      batch_quadrature<Real> batch(threads, threads == 3 ? 64 : 1);
+      batch.integrate(gauss_kronrod<Real, 15>(), f, a.data(), b.data(), n, Q.data());
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         BOOST_CHECK_EQUAL(visits[i], 15);
+         BOOST_CHECK_CLOSE_FRACTION(Q[i], Real(i) / 3, 4 * boost::math::tools::epsilon<Real>());
+      }
+   }
+   // An empty batch does nothing:
+   batch_quadrature<Real>().integrate(gauss_kronrod<Real, 15>(), f, a.data(), b.data(), 0, Q.data());
+}
+
+template <class Real>
+void test_empty_intervals()
+{
+   std::cout << "Testing empty intervals in a batch on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   std::size_t n = 100;
+   vector<Real> a(n, Real(0)), b(n, Real(1)), Q(n);
+   for (std::size_t i = 0; i < n; i += 3)
+      b[i] = a[i];
+   auto f = [](Real x, std::size_t) { return x; };
+   batch_quadrature<Real> batch(2);
+   // The integrators return early on an empty interval, so the error and L1 norm must be zeroed for them:
+   vector<Real> error(n, std::numeric_limits<Real>::quiet_NaN()), L1(n, std::numeric_limits<Real>::quiet_NaN());
+   batch.integrate(gauss_kronrod<Real, 15>(), f, a.data(), b.data(), n, Q.data(), error.data(), L1.data());
+   for (std::size_t i = 0; i < n; i += 3)
+   {
+      BOOST_CHECK_EQUAL(Q[i], 0);
+      BOOST_CHECK_EQUAL(error[i], 0);
+      BOOST_CHECK_EQUAL(L1[i], 0);
+   }
+   std::fill(error.begin(), error.end(), std::numeric_limits<Real>::quiet_NaN());
+   std::fill(L1.begin(), L1.end(), std::numeric_limits<Real>::quiet_NaN());
+   batch.integrate(tanh_sinh<Real>(), f, a.data(), b.data(), n, Q.data(), error.data(), L1.data());
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      BOOST_CHECK_EQUAL(Q[i], i % 3 ? Real(0.5) : Real(0));
+      if (i % 3 == 0)
+      {
+         BOOST_CHECK_EQUAL(error[i], 0);
+         BOOST_CHECK_EQUAL(L1[i], 0);
+      }
+   }
+}
+
+template <class Real>
+void test_parameters(unsigned threads)
+{
+   std::cout << "Testing batches with an array of parameters on " << threads << " threads on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   std::size_t n = 300;
+   exponential_family<Real> family(n);
+   // Item i integrates c * exp(-p x), with the parameters (c, p) held in a tuple:
+   vector<std::tuple<Real, Real> > params(n);
+   for (std::size_t i = 0; i < n; ++i)
+      params[i] = std::make_tuple(Real(1 + i % 4), family.p[i]);
+   auto f = [](Real x, const std::tuple<Real, Real>& q) { return std::get<0>(q) * exp(-std::get<1>(q) * x); };
+   // The same integrals, with the parameters found from the index:
+   auto g = [&](Real x, std::size_t i) { return f(x, params[i]); };
+   vector<Real> Q(n), error(n), Q_index(n), error_index(n);
+   batch_quadrature<Real> batch(threads);
+   batch.integrate(gauss_kronrod<Real, 15>(), f, family.a.data(), family.b.data(), params.data(), n, Q.data(), error.data());
+   batch.integrate(gauss_kronrod<Real, 15>(), g, family.a.data(), family.b.data(), n, Q_index.data(), error_index.data());
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      BOOST_CHECK_EQUAL(Q[i], Q_index[i]);
+      BOOST_CHECK_EQUAL(error[i], error_index[i]);
+      BOOST_CHECK_CLOSE_FRACTION(Q[i], std::get<0>(params[i]) * family.exact(i), 100 * boost::math::tools::epsilon<Real>());
+   }
+   batch.integrate(tanh_sinh<Real>(), f, family.a.data(), family.b.data(), params.data(), n, Q.data(), error.data());
+   batch.integrate(tanh_sinh<Real>(), g, family.a.data(), family.b.data(), n, Q_index.data(), error_index.data());
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      BOOST_CHECK_EQUAL(Q[i], Q_index[i]);
+      BOOST_CHECK_EQUAL(error[i], error_index[i]);
+   }
+}
+
+template <class Real>
+void test_exceptions()
+{
+   std::cout << "Testing exceptions are propagated from batch integration on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   std::size_t n = 200;
+   vector<Real> a(n, Real(0)), b(n, Real(1)), Q(n);
+   auto f = [](Real x, std::size_t i)->Real
+   {
+      if (i == 117)
+         throw std::domain_error("Bad item");
+      return x;
+   };
+   batch_quadrature<Real> batch(4);
+   BOOST_CHECK_THROW(batch.integrate(gauss_kronrod<Real, 15>(), f, a.data(), b.data(), n, Q.data()), std::domain_error);
+   // Invalid bounds are reported by the underlying integrator:
+   b[50] = std::numeric_limits<Real>::quiet_NaN();
+   auto g = [](Real x, std::size_t) { return x; };
+   BOOST_CHECK_THROW(batch.integrate(tanh_sinh<Real>(), g, a.data(), b.data(), n, Q.data()), std::domain_error);
+}
+
+BOOST_AUTO_TEST_CASE(batch_quadrature_test)
+{
+#ifdef TEST1
+   test_gauss_kronrod<double, 15>(1);
+   test_gauss_kronrod<double, 15>(4);
+   test_gauss_kronrod<float, 21>(3);
+   test_tanh_sinh<double>(1);
+   test_tanh_sinh<double>(4);
+   test_every_item_once<double>();
+   test_empty_intervals<double>();
+   test_parameters<double>(1);
+   test_parameters<double>(4);
+   test_exceptions<double>();
+#endif
+#ifdef TEST2
+   test_gauss_kronrod<cpp_bin_float_quad, 31>(4);
+   test_tanh_sinh<cpp_bin_float_quad>(4);
+#endif
+}
+
+#else
+
+int main() { return 0; }
+
+#endif
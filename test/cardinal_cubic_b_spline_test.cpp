@@ -7,6 +7,7 @@
 #define BOOST_TEST_MODULE test_cubic_b_spline
 
 #include <random>
+#include <algorithm>
 #include <functional>
 #include <boost/random/uniform_real_distribution.hpp>
 #include <boost/type_index.hpp>
@@ -314,6 +315,104 @@ void test_outside_interval()
     cnull << spline(2000);
 }
 
+template<class Real>
+void test_batch()
+{
+    std::cout << "Testing that batch evaluation agrees with scalar evaluation of cubic b splines on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using std::abs;
+    std::mt19937 gen;
+    std::vector<Real> v(300);
+    Real x0 = 1;
+    Real step = 0.125;
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] = sin(x0 + step * i);
+    }
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> spline(v.data(), v.size(), x0, step);
+
+    // Includes points near the ends and a little outside, which go through the scalar routines:
+    boost::random::uniform_real_distribution<Real> absissa(x0 - 2*step, x0 + 301 * step);
+    std::vector<Real> x(2000);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] = absissa(gen);
+    }
+    x[0] = x0;
+    x[1] = x0 + 299*step;
+    x[2] = x0 + 150*step;
+    std::vector<Real> y(x.size());
+    std::vector<Real> dydx(x.size());
+    std::vector<Real> d2ydx2(x.size());
+    spline.evaluate(x, y);
+    spline.evaluate_prime(x, dydx);
+    spline.evaluate_double_prime(x, d2ydx2);
+    Real tol = 64*std::numeric_limits<Real>::epsilon();
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        BOOST_CHECK_SMALL(Real(y[i] - spline(x[i])), tol);
+        BOOST_CHECK_SMALL(Real(dydx[i] - spline.prime(x[i])), tol/step);
+        BOOST_CHECK_SMALL(Real(d2ydx2[i] - spline.double_prime(x[i])), tol/(step*step));
+    }
+
+    std::vector<Real> too_short(x.size() - 1);
+    BOOST_CHECK_THROW(spline.evaluate(x, too_short), std::domain_error);
+}
+
+template<class Real>
+void test_update()
+{
+    std::cout << "Testing that updating a cubic b spline agrees with constructing a new one on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using std::abs;
+    std::mt19937 gen(12);
+    boost::random::uniform_real_distribution<Real> dis(-1, 1);
+    Real x0 = 1;
+    Real step = 0.125;
+    std::vector<Real> v(200);
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] = dis(gen);
+    }
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> spline(v.data(), v.size(), x0, step);
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] = sin(x0 + step*i);
+    }
+    spline.update(v.begin(), v.end());
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> fresh(v.data(), v.size(), x0, step);
+    for (size_t i = 0; i < 4*v.size(); ++i)
+    {
+        Real x = x0 + i*step/4;
+        BOOST_CHECK_EQUAL(spline(x), fresh(x));
+        BOOST_CHECK_EQUAL(spline.prime(x), fresh.prime(x));
+    }
+    Real yp = 3;
+    spline.update(v.data(), v.size(), yp, yp);
+    BOOST_CHECK_CLOSE_FRACTION(spline.prime(x0), yp, 100*std::numeric_limits<Real>::epsilon());
+
+    // A long signal, solved on several threads, agrees with the serial solve up to rounding:
+    std::vector<Real> w(100000);
+    for (size_t i = 0; i < w.size(); ++i)
+    {
+        w[i] = dis(gen);
+    }
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> serial(w.data(), w.size(), x0, step);
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> parallel(w.data(), w.size(), x0, step);
+    std::reverse(w.begin(), w.end());
+    serial.update(w.data(), w.size());
+    parallel.update(w.data(), w.size(), std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN(), 4);
+    for (size_t i = 0; i < w.size(); i += 7)
+    {
+        Real x = x0 + i*step + step/3;
+        BOOST_CHECK_SMALL(Real(serial(x) - parallel(x)), 50*std::numeric_limits<Real>::epsilon());
+    }
+
+    BOOST_CHECK_THROW(spline.update(v.data(), v.size() - 1), std::logic_error);
+    // A default constructed spline has no samples to update:
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> empty;
+    BOOST_CHECK_THROW(empty.update(v.data(), v.size()), std::logic_error);
+    BOOST_CHECK_THROW(empty.update(v.begin(), v.end()), std::logic_error);
+}
+
 BOOST_AUTO_TEST_CASE(test_cubic_b_spline)
 {
     test_b3_spline<float>();
@@ -346,6 +445,13 @@ BOOST_AUTO_TEST_CASE(test_cubic_b_spline)
     test_trig_function<long double>();
     test_trig_function<cpp_bin_float_50>();
 
+    test_batch<float>();
+    test_batch<double>();
+    test_batch<cpp_bin_float_50>();
+
+    test_update<float>();
+    test_update<double>();
+
     test_copy_move<double>();
     test_outside_interval<double>();
 }
@@ -8,6 +8,8 @@
 #include "math_unit_test.hpp"
 #include <numeric>
 #include <utility>
+#include <random>
+#include <vector>
 #include <boost/math/interpolators/cardinal_quadratic_b_spline.hpp>
 using boost::math::interpolators::cardinal_quadratic_b_spline;
 
@@ -113,6 +115,95 @@ void test_quadratic()
     }
 }
 
+template<class Real>
+void test_update()
+{
+    Real t0 = 0;
+    Real h = Real(1)/Real(16);
+    size_t n = 300;
+    std::vector<Real> v(n, 1);
+    auto qbs = cardinal_quadratic_b_spline<Real>(v, t0, h);
+    for (size_t i = 0; i < n; ++i) {
+        Real t = t0 + i*h;
+        v[i] = t*t - 3*t;
+    }
+    qbs.update(v);
+    auto fresh = cardinal_quadratic_b_spline<Real>(v, t0, h);
+    for (size_t i = 0; i < 4*(n-1); ++i) {
+        Real t = t0 + i*h/4;
+        CHECK_EQUAL(qbs(t), fresh(t));
+        CHECK_EQUAL(qbs.prime(t), fresh.prime(t));
+    }
+
+    // A long signal, solved on several threads, agrees with the serial solve up to rounding:
+    std::vector<Real> w(50000);
+    for (size_t i = 0; i < w.size(); ++i) {
+        w[i] = (i % 7) - Real(i % 11)/3;
+    }
+    auto serial = cardinal_quadratic_b_spline<Real>(w, t0, h);
+    auto parallel = cardinal_quadratic_b_spline<Real>(std::vector<Real>(w.size(), 0), t0, h);
+    parallel.update(w.data(), w.size(), std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN(), 3);
+    for (size_t i = 0; i < w.size() - 1; i += 5) {
+        Real t = t0 + i*h + h/3;
+        CHECK_ABSOLUTE_ERROR(serial(t), parallel(t), 100*std::numeric_limits<Real>::epsilon());
+    }
+
+    bool caught = false;
+    try {
+        qbs.update(v.data(), n + 1);
+    }
+    catch (std::logic_error const &) {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+}
+
+template<class Real>
+void test_batch()
+{
+    using std::sin;
+    using std::cos;
+    std::mt19937 gen(17);
+    std::uniform_real_distribution<Real> dis(-1, 1);
+    Real t0 = Real(1)/Real(3);
+    Real h = Real(1)/Real(16);
+    size_t n = 300;
+    std::vector<Real> v(n);
+    for (size_t i = 0; i < n; ++i) {
+        Real t = t0 + i*h;
+        v[i] = sin(t) + cos(3*t)/2;
+    }
+    auto qbs = cardinal_quadratic_b_spline<Real>(v, t0, h);
+    // Every knot and the points between them, including both ends, then random points:
+    std::vector<Real> t;
+    for (size_t i = 0; i <= 4*(n-1); ++i) {
+        t.push_back(t0 + i*h/4);
+    }
+    t.back() = qbs.t_max();
+    for (size_t i = 0; i < 4*n; ++i) {
+        t.push_back(t0 + (qbs.t_max() - t0)*(dis(gen) + 1)/2);
+    }
+    std::vector<Real> y(t.size());
+    std::vector<Real> dydt(t.size());
+    qbs.evaluate(t, y);
+    qbs.evaluate_prime(t, dydt);
+    for (size_t i = 0; i < t.size(); ++i) {
+        CHECK_ABSOLUTE_ERROR(qbs(t[i]), y[i], 16*std::numeric_limits<Real>::epsilon());
+        CHECK_ABSOLUTE_ERROR(qbs.prime(t[i]), dydt[i], 16*std::numeric_limits<Real>::epsilon()/h);
+    }
+
+    t.push_back(qbs.t_max() + 1);
+    y.resize(t.size());
+    bool caught = false;
+    try {
+        qbs.evaluate(t, y);
+    }
+    catch (std::domain_error const &) {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+}
+
 int main()
 {
     test_constant<float>();
@@ -126,5 +217,10 @@ int main()
     test_quadratic<double>();
     test_quadratic<long double>();
 
+    test_update<double>();
+    test_batch<double>();
+    test_update<long double>();
+    test_batch<long double>();
+
     return boost::math::test::report_errors();
 }
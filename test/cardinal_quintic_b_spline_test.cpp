@@ -8,6 +8,8 @@
 #include "math_unit_test.hpp"
 #include <numeric>
 #include <utility>
+#include <random>
+#include <vector>
 #include <boost/math/interpolators/cardinal_quintic_b_spline.hpp>
 #ifdef BOOST_HAS_FLOAT128
 #include <boost/multiprecision/float128.hpp>
@@ -264,6 +266,86 @@ void test_quadratic_estimate_derivatives()
 }
 
 
+template<class Real>
+void test_update()
+{
+    Real t0 = 0;
+    Real h = Real(1)/Real(16);
+    size_t n = 300;
+    std::vector<Real> v(n, 1);
+    auto qbs = cardinal_quintic_b_spline<Real>(v, t0, h);
+    for (size_t i = 0; i < n; ++i) {
+        Real t = t0 + i*h;
+        v[i] = t*t*t - 3*t + (i % 3);
+    }
+    qbs.update(v);
+    auto fresh = cardinal_quintic_b_spline<Real>(v, t0, h);
+    for (size_t i = 0; i < 4*(n-1); ++i) {
+        Real t = t0 + i*h/4;
+        CHECK_EQUAL(qbs(t), fresh(t));
+        CHECK_EQUAL(qbs.prime(t), fresh.prime(t));
+        CHECK_EQUAL(qbs.double_prime(t), fresh.double_prime(t));
+    }
+
+    bool caught = false;
+    try {
+        qbs.update(v.data(), n - 1);
+    }
+    catch (std::logic_error const &) {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+}
+
+template<class Real>
+void test_batch()
+{
+    using std::sin;
+    using std::cos;
+    std::mt19937 gen(17);
+    std::uniform_real_distribution<Real> dis(-1, 1);
+    Real t0 = Real(1)/Real(3);
+    Real h = Real(1)/Real(16);
+    size_t n = 300;
+    std::vector<Real> v(n);
+    for (size_t i = 0; i < n; ++i) {
+        Real t = t0 + i*h;
+        v[i] = sin(t) + cos(3*t)/2;
+    }
+    auto qbs = cardinal_quintic_b_spline<Real>(v, t0, h);
+    // Every knot and the points between them, including both ends, then random points:
+    std::vector<Real> t;
+    for (size_t i = 0; i <= 4*(n-1); ++i) {
+        t.push_back(t0 + i*h/4);
+    }
+    t.back() = qbs.t_max();
+    for (size_t i = 0; i < 4*n; ++i) {
+        t.push_back(t0 + (qbs.t_max() - t0)*(dis(gen) + 1)/2);
+    }
+    std::vector<Real> y(t.size());
+    std::vector<Real> dydt(t.size());
+    std::vector<Real> d2ydt2(t.size());
+    qbs.evaluate(t, y);
+    qbs.evaluate_prime(t, dydt);
+    qbs.evaluate_double_prime(t, d2ydt2);
+    for (size_t i = 0; i < t.size(); ++i) {
+        CHECK_ABSOLUTE_ERROR(qbs(t[i]), y[i], 16*std::numeric_limits<Real>::epsilon());
+        CHECK_ABSOLUTE_ERROR(qbs.prime(t[i]), dydt[i], 16*std::numeric_limits<Real>::epsilon()/h);
+        CHECK_ABSOLUTE_ERROR(qbs.double_prime(t[i]), d2ydt2[i], 16*std::numeric_limits<Real>::epsilon()/(h*h));
+    }
+
+    t.push_back(qbs.t_max() + 1);
+    y.resize(t.size());
+    bool caught = false;
+    try {
+        qbs.evaluate(t, y);
+    }
+    catch (std::domain_error const &) {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+}
+
 int main()
 {
     test_constant<double>();
@@ -285,6 +367,11 @@ int main()
     test_quadratic_estimate_derivatives<double>();
     test_quadratic_estimate_derivatives<long double>();
 
+    test_update<double>();
+    test_batch<double>();
+    test_update<long double>();
+    test_batch<long double>();
+
 
     #ifdef BOOST_HAS_FLOAT128
         test_constant<float128>();
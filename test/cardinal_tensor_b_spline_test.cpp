@@ -0,0 +1,305 @@
+/*
+ * Copyright The Boost.Math contributors, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <array>
+#include <random>
+#include <vector>
+#include <boost/math/interpolators/cardinal_tensor_b_spline.hpp>
+#include <boost/math/interpolators/cardinal_cubic_b_spline.hpp>
+#include <boost/math/interpolators/cardinal_quintic_b_spline.hpp>
+
+using boost::math::interpolators::cardinal_tensor_b_spline;
+using boost::math::interpolators::cardinal_cubic_b_spline;
+using boost::math::interpolators::cardinal_quintic_b_spline;
+using boost::math::interpolators::bicubic_b_spline;
+
+// The tensor product spline of separable data is the product of the one dimensional splines of its factors:
+template<class Real, unsigned degree>
+class one_dimensional_spline
+{
+public:
+    one_dimensional_spline(const std::vector<Real>& v, Real t0, Real h) : s_(v.data(), v.size(), t0, h) {}
+    Real operator()(Real t) const { return s_(t); }
+    Real prime(Real t) const { return s_.prime(t); }
+    Real double_prime(Real t) const { return s_.double_prime(t); }
+private:
+    std::conditional_t<degree == 3, cardinal_cubic_b_spline<Real>, cardinal_quintic_b_spline<Real>> s_;
+};
+
+template<class Real>
+Real factor(size_t axis, Real t)
+{
+    using std::sin;
+    return sin((axis + 1)*t) + t/2;
+}
+
+template<class Real, size_t dimension>
+std::vector<Real> separable_samples(std::array<size_t, dimension> extents, std::array<Real, dimension> origin, std::array<Real, dimension> spacing)
+{
+    size_t total = 1;
+    for (auto e : extents)
+    {
+        total *= e;
+    }
+    std::vector<Real> v(total);
+    std::array<size_t, dimension> index{};
+    for (size_t j = 0; j < total; ++j)
+    {
+        v[j] = 1;
+        for (size_t a = 0; a < dimension; ++a)
+        {
+            v[j] *= factor(a, origin[a] + index[a]*spacing[a]);
+        }
+        for (size_t a = dimension; a-- > 0;)
+        {
+            if (++index[a] < extents[a])
+            {
+                break;
+            }
+            index[a] = 0;
+        }
+    }
+    return v;
+}
+
+template<class Real, size_t dimension, unsigned degree>
+void test_separable()
+{
+    std::array<size_t, dimension> extents;
+    std::array<Real, dimension> origin;
+    std::array<Real, dimension> spacing;
+    std::vector<one_dimensional_spline<Real, degree>> factors;
+    for (size_t a = 0; a < dimension; ++a)
+    {
+        // Extents which are not multiples of the tile size, and differ along each axis:
+        extents[a] = 9 + 4*a;
+        origin[a] = Real(-1) + Real(a)/4;
+        spacing[a] = Real(1)/Real(8 + 2*a);
+        std::vector<Real> f(extents[a]);
+        for (size_t i = 0; i < f.size(); ++i)
+        {
+            f[i] = factor(a, origin[a] + i*spacing[a]);
+        }
+        factors.emplace_back(f, origin[a], spacing[a]);
+    }
+    auto v = separable_samples(extents, origin, spacing);
+    auto s = cardinal_tensor_b_spline<Real, dimension, degree>(v, extents, origin, spacing);
+
+    auto [lower, upper] = s.domain();
+    std::mt19937_64 gen(123);
+    std::uniform_real_distribution<Real> dis(0, 1);
+    Real tol = 64*std::numeric_limits<Real>::epsilon();
+    for (size_t i = 0; i < 200; ++i)
+    {
+        std::array<Real, dimension> x;
+        std::array<Real, dimension> f;
+        std::array<Real, dimension> df;
+        std::array<Real, dimension> d2f;
+        for (size_t a = 0; a < dimension; ++a)
+        {
+            x[a] = lower[a] + dis(gen)*(upper[a] - lower[a]);
+            f[a] = factors[a](x[a]);
+            df[a] = factors[a].prime(x[a]);
+            d2f[a] = factors[a].double_prime(x[a]);
+        }
+        Real expected = 1;
+        for (size_t a = 0; a < dimension; ++a)
+        {
+            expected *= f[a];
+        }
+        CHECK_ABSOLUTE_ERROR(expected, s(x), tol);
+
+        auto g = s.gradient(x);
+        auto H = s.hessian(x);
+        for (size_t a = 0; a < dimension; ++a)
+        {
+            Real dfa = 1;
+            for (size_t b = 0; b < dimension; ++b)
+            {
+                dfa *= (b == a) ? df[b] : f[b];
+            }
+            CHECK_ABSOLUTE_ERROR(dfa, g[a], 32*tol);
+            for (size_t b = 0; b < dimension; ++b)
+            {
+                Real d2fab = 1;
+                for (size_t c = 0; c < dimension; ++c)
+                {
+                    if (c == a && c == b)
+                    {
+                        d2fab *= d2f[c];
+                    }
+                    else if (c == a || c == b)
+                    {
+                        d2fab *= df[c];
+                    }
+                    else
+                    {
+                        d2fab *= f[c];
+                    }
+                }
+                CHECK_ABSOLUTE_ERROR(d2fab, H[a][b], 1024*tol);
+            }
+        }
+    }
+}
+
+template<class Real, size_t dimension, unsigned degree>
+void test_interpolation_condition()
+{
+    std::array<size_t, dimension> extents;
+    std::array<Real, dimension> origin;
+    std::array<Real, dimension> spacing;
+    size_t total = 1;
+    for (size_t a = 0; a < dimension; ++a)
+    {
+        extents[a] = 8 + 3*a;
+        origin[a] = Real(a);
+        spacing[a] = Real(1)/Real(1 + a);
+        total *= extents[a];
+    }
+    std::vector<Real> v(total);
+    std::mt19937_64 gen(5);
+    std::uniform_real_distribution<Real> dis(-1, 1);
+    for (auto& t : v)
+    {
+        t = dis(gen);
+    }
+    auto s = cardinal_tensor_b_spline<Real, dimension, degree>(v, extents, origin, spacing);
+    std::array<size_t, dimension> index{};
+    for (size_t j = 0; j < v.size(); ++j)
+    {
+        std::array<Real, dimension> x;
+        for (size_t a = 0; a < dimension; ++a)
+        {
+            x[a] = origin[a] + index[a]*spacing[a];
+        }
+        CHECK_ABSOLUTE_ERROR(v[j], s(x), 512*std::numeric_limits<Real>::epsilon());
+        for (size_t a = dimension; a-- > 0;)
+        {
+            if (++index[a] < extents[a])
+            {
+                break;
+            }
+            index[a] = 0;
+        }
+    }
+}
+
+template<class Real>
+void test_batch()
+{
+    std::array<size_t, 2> extents{30, 17};
+    std::array<Real, 2> origin{1, -2};
+    std::array<Real, 2> spacing{Real(0.1), Real(0.25)};
+    std::vector<Real> v(30*17);
+    std::mt19937_64 gen(11);
+    std::uniform_real_distribution<Real> dis(-1, 1);
+    for (auto& t : v)
+    {
+        t = dis(gen);
+    }
+    auto s = bicubic_b_spline<Real>(v, extents, origin, spacing);
+    auto [lower, upper] = s.domain();
+    CHECK_ULP_CLOSE(Real(3.9), upper[0], 4);
+    CHECK_ULP_CLOSE(Real(2), upper[1], 0);
+    std::vector<std::array<Real, 2>> x(1000);
+    std::uniform_real_distribution<Real> dis0(lower[0], upper[0]);
+    std::uniform_real_distribution<Real> dis1(lower[1], upper[1]);
+    for (auto& p : x)
+    {
+        p = {dis0(gen), dis1(gen)};
+    }
+    // The corners belong to the domain:
+    x[0] = lower;
+    x[1] = upper;
+    std::vector<Real> y(x.size());
+    s.evaluate(x, y);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_EQUAL(s(x[i][0], x[i][1]), y[i]);
+    }
+    CHECK_ABSOLUTE_ERROR(v[0], y[0], 10*std::numeric_limits<Real>::epsilon());
+    CHECK_ABSOLUTE_ERROR(v.back(), y[1], 10*std::numeric_limits<Real>::epsilon());
+}
+
+template<class Real>
+void test_errors()
+{
+    std::array<size_t, 2> extents{6, 6};
+    std::array<Real, 2> origin{0, 0};
+    std::array<Real, 2> spacing{1, 1};
+    std::vector<Real> v(36, Real(1));
+    bool caught = false;
+    try
+    {
+        auto s = bicubic_b_spline<Real>(std::vector<Real>(35), extents, origin, spacing);
+    }
+    catch (const std::domain_error&)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+
+    caught = false;
+    try
+    {
+        auto s = bicubic_b_spline<Real>(v, extents, origin, std::array<Real, 2>{1, 0});
+    }
+    catch (const std::domain_error&)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+
+    // Six points are too few for a quintic spline:
+    caught = false;
+    try
+    {
+        auto s = cardinal_tensor_b_spline<Real, 2, 5>(v, extents, origin, spacing);
+    }
+    catch (const std::domain_error&)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+
+    auto s = bicubic_b_spline<Real>(v, extents, origin, spacing);
+    CHECK_ULP_CLOSE(Real(1), s(Real(5), Real(2.5)), 2);
+    caught = false;
+    try
+    {
+        s(Real(5.01), Real(2.5));
+    }
+    catch (const std::domain_error&)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+}
+
+int main()
+{
+    test_separable<double, 2, 3>();
+    test_separable<double, 3, 3>();
+    test_separable<double, 2, 5>();
+    test_separable<double, 3, 5>();
+    test_separable<long double, 2, 3>();
+    test_separable<long double, 3, 5>();
+
+    test_interpolation_condition<double, 2, 3>();
+    test_interpolation_condition<double, 3, 3>();
+    test_interpolation_condition<double, 2, 5>();
+    test_interpolation_condition<double, 3, 5>();
+
+    test_batch<float>();
+    test_batch<double>();
+
+    test_errors<double>();
+
+    return boost::math::test::report_errors();
+}
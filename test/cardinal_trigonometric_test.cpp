@@ -197,6 +197,69 @@ void test_bump()
 
 }
 
+template<class Real>
+void test_upsample()
+{
+  using std::abs;
+  using std::max;
+  std::mt19937 gen(8765);
+  std::uniform_real_distribution<Real> dis(-1, 1);
+  for (size_t n = 1; n < 20; ++n)
+  {
+    Real t0 = dis(gen);
+    Real h = Real(1)/Real(8);
+    std::vector<Real> v(n);
+    for (auto& y : v)
+    {
+      y = dis(gen);
+    }
+    auto ct = cardinal_trigonometric<decltype(v)>(v, t0, h);
+    for (size_t factor = 1; factor < 6; ++factor)
+    {
+      auto y = ct.upsample(factor);
+      auto dydt = ct.upsample_prime(factor);
+      auto d2ydt2 = ct.upsample_double_prime(factor);
+      CHECK_EQUAL(factor*n, y.size());
+      CHECK_EQUAL(factor*n, dydt.size());
+      CHECK_EQUAL(factor*n, d2ydt2.size());
+      // The derivatives scale as 1/h and 1/h^2:
+      Real scale = 0;
+      for (size_t j = 0; j < y.size(); ++j)
+      {
+        scale = (max)(scale, abs(ct.double_prime(t0 + j*h/factor)));
+      }
+      for (size_t j = 0; j < y.size(); ++j)
+      {
+        Real t = t0 + j*h/factor;
+        Real tol = 8*n*std::numeric_limits<Real>::epsilon();
+        CHECK_ABSOLUTE_ERROR(ct(t), y[j], tol);
+        CHECK_ABSOLUTE_ERROR(ct.prime(t), dydt[j], tol/h);
+        CHECK_ABSOLUTE_ERROR(ct.double_prime(t), d2ydt2[j], tol*(max)(scale, 1/(h*h)));
+      }
+      if (factor == 1)
+      {
+        for (size_t j = 0; j < n; ++j)
+        {
+          CHECK_ABSOLUTE_ERROR(v[j], y[j], 8*n*std::numeric_limits<Real>::epsilon());
+        }
+      }
+    }
+  }
+
+  std::vector<Real> v(10, Real(1));
+  auto ct = cardinal_trigonometric<decltype(v)>(v, Real(0), Real(1));
+  bool caught = false;
+  try
+  {
+    auto y = ct.upsample(0);
+  }
+  catch (const std::logic_error&)
+  {
+    caught = true;
+  }
+  CHECK_EQUAL(true, caught);
+}
+
 
 int main()
 {
@@ -206,6 +269,7 @@ int main()
     test_sampled_sine<float>();
     test_bump<float>();
     test_interpolation_condition<float>();
+    test_upsample<float>();
 #endif
 
 
@@ -214,6 +278,7 @@ int main()
     test_sampled_sine<double>();
     test_bump<double>();
     test_interpolation_condition<double>();
+    test_upsample<double>();
 #endif
 
 #ifdef TEST3
@@ -221,6 +286,7 @@ int main()
     test_sampled_sine<long double>();
     test_bump<long double>();
     test_interpolation_condition<long double>();
+    test_upsample<long double>();
 #endif
 
 #ifdef TEST4
@@ -340,6 +340,106 @@ BOOST_CONSTEXPR std::size_t size(const mypoint3d<Real>& c)
     return 3;
 }
 
+template<class Real>
+void test_cursor()
+{
+    using boost::math::constants::pi;
+    std::cout << "Testing that a cursor does not change the values of a Catmull-Rom spline on type "
+              << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+
+    std::vector<std::array<Real, 3>> v(300);
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        Real theta = ((Real) i/ (Real) v.size())*2*pi<Real>();
+        v[i] = {cos(theta), sin(theta), theta};
+    }
+    catmull_rom<std::array<Real, 3>> helix(std::move(v));
+    Real max_s = helix.max_parameter();
+
+    // Forwards, backwards, and at random:
+    std::vector<Real> queries;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        queries.push_back(max_s*i/1000);
+    }
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        queries.push_back(max_s*(1000 - i)/1000);
+    }
+    std::mt19937 gen(17);
+    std::uniform_real_distribution<Real> dis(0, max_s);
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        queries.push_back(dis(gen));
+    }
+
+    boost::math::interpolators::interval_cursor cursor;
+    for (Real s : queries)
+    {
+        auto p = helix(s);
+        auto q = helix(s, cursor);
+        auto dp = helix.prime(s);
+        auto dq = helix.prime(s, cursor);
+        for (size_t j = 0; j < 3; ++j)
+        {
+            BOOST_CHECK_EQUAL(p[j], q[j]);
+            BOOST_CHECK_EQUAL(dp[j], dq[j]);
+        }
+    }
+    BOOST_CHECK_THROW(helix(max_s + 1, cursor), std::domain_error);
+}
+
+template<class Real>
+void test_batch()
+{
+    using boost::math::constants::pi;
+    std::cout << "Testing that batch evaluation of a Catmull-Rom spline agrees with the scalar routines on type "
+              << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+
+    std::vector<std::array<Real, 3>> v(300);
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        Real theta = ((Real) i/ (Real) v.size())*2*pi<Real>();
+        v[i] = {cos(theta), sin(theta), theta};
+    }
+    catmull_rom<std::array<Real, 3>> helix(std::move(v));
+    Real max_s = helix.max_parameter();
+
+    // More than one block, increasing, then at random, with both ends:
+    std::vector<Real> queries;
+    for (size_t i = 0; i <= 500; ++i)
+    {
+        queries.push_back(max_s*i/500);
+    }
+    std::mt19937 gen(17);
+    std::uniform_real_distribution<Real> dis(0, max_s);
+    for (size_t i = 0; i < 500; ++i)
+    {
+        queries.push_back(dis(gen));
+    }
+    queries.push_back(0);
+
+    std::vector<std::array<Real, 3>> p(queries.size());
+    std::vector<std::array<Real, 3>> dp(queries.size());
+    helix.evaluate(queries, p);
+    helix.evaluate_prime(queries, dp);
+    for (size_t i = 0; i < queries.size(); ++i)
+    {
+        auto q = helix(queries[i]);
+        auto dq = helix.prime(queries[i]);
+        for (size_t j = 0; j < 3; ++j)
+        {
+            BOOST_CHECK_EQUAL(p[i][j], q[j]);
+            BOOST_CHECK_EQUAL(dp[i][j], dq[j]);
+        }
+    }
+
+    queries.back() = max_s + 1;
+    BOOST_CHECK_THROW(helix.evaluate(queries, p), std::domain_error);
+    p.pop_back();
+    BOOST_CHECK_THROW(helix.evaluate_prime(queries, p), std::domain_error);
+}
+
 template<class Real>
 void test_data_representations()
 {
@@ -420,6 +520,9 @@ BOOST_AUTO_TEST_CASE(catmull_rom_test)
     test_affine_invariance<double, 4>();
 
     test_random_access_container<double>();
+    test_cursor<double>();
+    test_batch<float>();
+    test_batch<double>();
 #endif
 #if !defined(TEST) || (TEST == 3)
     test_affine_invariance<cpp_bin_float_50, 4>();
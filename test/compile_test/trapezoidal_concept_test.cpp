@@ -17,4 +17,6 @@ void compile_and_link_test()
    boost::math::concepts::std_real_concept a = 0;
    boost::math::concepts::std_real_concept b = 1;
    boost::math::quadrature::trapezoidal(func, a, b);
+   boost::math::quadrature::romberg(func, a, b);
+   boost::math::quadrature::periodic_trapezoidal(func, a, b);
 }
@@ -420,6 +420,147 @@ void test_cardinal_interpolation_condition()
 
 
 
+template<typename Real>
+void test_cursor()
+{
+    std::default_random_engine rd;
+    std::uniform_real_distribution<Real> dis(0,1);
+    size_t n = 500;
+    std::vector<Real> x(n);
+    std::vector<Real> y(n);
+    std::vector<Real> dydx(n);
+    x[0] = dis(rd);
+    for (size_t i = 1; i < n; ++i) {
+        x[i] = x[i-1] + dis(rd) + Real(1)/128;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        y[i] = dis(rd);
+        dydx[i] = dis(rd);
+    }
+    // Queries: every knot, sorted points between knots, the same in reverse, and random points:
+    std::vector<Real> queries(x.begin(), x.end());
+    for (size_t i = 0; i < 4*n; ++i) {
+        queries.push_back(x[0] + (x[n-1] - x[0])*Real(i)/Real(4*n));
+    }
+    for (size_t i = 0; i < 4*n; ++i) {
+        queries.push_back(queries[queries.size() - 1 - 2*i]);
+    }
+    for (size_t i = 0; i < 4*n; ++i) {
+        queries.push_back(x[0] + (x[n-1] - x[0])*dis(rd));
+    }
+
+    auto x_copy = x;
+    auto y_copy = y;
+    auto dydx_copy = dydx;
+    auto s = cubic_hermite(std::move(x_copy), std::move(y_copy), std::move(dydx_copy));
+    std::vector<Real> expected(queries.size());
+    std::vector<Real> expected_prime(queries.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+        expected[i] = s(queries[i]);
+        expected_prime[i] = s.prime(queries[i]);
+    }
+    // The same interval is found, so the results are identical:
+    boost::math::interpolators::interval_cursor cursor;
+    for (size_t i = 0; i < queries.size(); ++i) {
+        CHECK_EQUAL(s(queries[i], cursor), expected[i]);
+        CHECK_EQUAL(s.prime(queries[i], cursor), expected_prime[i]);
+    }
+    s.build_search_index();
+    for (size_t i = 0; i < queries.size(); ++i) {
+        CHECK_EQUAL(s(queries[i]), expected[i]);
+        CHECK_EQUAL(s.prime(queries[i]), expected_prime[i]);
+    }
+    // push_back discards the index, and the cursor follows the new data:
+    Real xn = x[n-1] + 1;
+    s.push_back(xn, Real(2), Real(0));
+    CHECK_EQUAL(s(xn), Real(2));
+    CHECK_EQUAL(s(xn, cursor), Real(2));
+    CHECK_EQUAL(s(x[0], cursor), y[0]);
+    bool caught = false;
+    try {
+        s(xn + 1, cursor);
+    }
+    catch (std::domain_error const &) {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+}
+
+template<typename Real>
+void test_batch()
+{
+    std::default_random_engine rd;
+    std::uniform_real_distribution<Real> dis(0,1);
+    size_t n = 300;
+    std::vector<Real> x(n);
+    std::vector<Real> y(n);
+    std::vector<Real> dydx(n);
+    x[0] = dis(rd);
+    for (size_t i = 1; i < n; ++i) {
+        x[i] = x[i-1] + dis(rd) + Real(1)/128;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        y[i] = dis(rd);
+        dydx[i] = dis(rd);
+    }
+    Real a = x[0];
+    Real b = x[n-1];
+    // Sorted, including both endpoints, followed by random points:
+    std::vector<Real> queries;
+    for (size_t i = 0; i <= 1000; ++i) {
+        queries.push_back(a + (b - a)*Real(i)/Real(1000));
+    }
+    queries.back() = b;
+    for (size_t i = 0; i < 1000; ++i) {
+        queries.push_back(a + (b - a)*dis(rd));
+    }
+    queries.push_back(b);
+
+    auto s = cubic_hermite(std::move(x), std::move(y), std::move(dydx));
+    std::vector<Real> values(queries.size());
+    std::vector<Real> derivatives(queries.size());
+    s.evaluate(queries, values);
+    s.evaluate_prime(queries, derivatives);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        CHECK_ULP_CLOSE(s(queries[i]), values[i], 2);
+        CHECK_ULP_CLOSE(s.prime(queries[i]), derivatives[i], 2);
+    }
+
+    std::vector<Real> y2(128);
+    std::vector<Real> dydx2(128);
+    for (size_t i = 0; i < y2.size(); ++i) {
+        y2[i] = dis(rd);
+        dydx2[i] = dis(rd);
+    }
+    Real x0 = dis(rd);
+    Real dx = Real(1)/8;
+    auto cs = cardinal_cubic_hermite(std::move(y2), std::move(dydx2), x0, dx);
+    queries.clear();
+    for (size_t i = 0; i < 500; ++i) {
+        queries.push_back(x0 + 127*dx*dis(rd));
+    }
+    queries.push_back(cs.domain().second);
+    values.resize(queries.size());
+    derivatives.resize(queries.size());
+    cs.evaluate(queries, values);
+    cs.evaluate_prime(queries, derivatives);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        CHECK_ULP_CLOSE(cs(queries[i]), values[i], 2);
+        CHECK_ULP_CLOSE(cs.prime(queries[i]), derivatives[i], 2);
+    }
+
+    queries.push_back(cs.domain().second + 1);
+    values.resize(queries.size());
+    bool caught = false;
+    try {
+        cs.evaluate(queries, values);
+    }
+    catch (std::domain_error const &) {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+}
+
 int main()
 {
     test_constant<float>();
@@ -430,6 +571,8 @@ int main()
     test_cardinal_linear<float>();
     test_cardinal_quadratic<float>();
     test_cardinal_interpolation_condition<float>();
+    test_cursor<float>();
+    test_batch<float>();
 
     test_constant<double>();
     test_linear<double>();
@@ -439,6 +582,8 @@ int main()
     test_cardinal_linear<double>();
     test_cardinal_quadratic<double>();
     test_cardinal_interpolation_condition<double>();
+    test_cursor<double>();
+    test_batch<double>();
 
     test_constant<long double>();
     test_linear<long double>();
@@ -448,6 +593,8 @@ int main()
     test_cardinal_linear<long double>();
     test_cardinal_quadratic<long double>();
     test_cardinal_interpolation_condition<long double>();
+    test_cursor<long double>();
+    test_batch<long double>();
 
 
 #ifdef BOOST_HAS_FLOAT128
@@ -7,6 +7,7 @@
 #define BOOST_TEST_MODULE exp_sinh_quadrature_test
 
 #include <complex>
+#include <thread>
 #include <boost/multiprecision/cpp_complex.hpp>
 #include <boost/math/concepts/real_concept.hpp>
 #include <boost/test/included/unit_test.hpp>
@@ -51,6 +52,7 @@ using boost::math::constants::root_two;
 using boost::math::constants::root_two_pi;
 using boost::math::constants::root_pi;
 using boost::math::quadrature::exp_sinh;
+using boost::math::quadrature::quadrature_statistics;
 
 #if !defined(TEST1) && !defined(TEST2) && !defined(TEST3) && !defined(TEST4) && !defined(TEST5) && !defined(TEST6) && !defined(TEST7) && !defined(TEST8) && !defined(TEST9)
 #  define TEST1
@@ -548,6 +550,84 @@ void test_complex_exponential_integral_E1(){
 }
 
 
+template<class Real>
+void test_shared_tables()
+{
+    std::cout << "Testing shared tables on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    const auto f = [](const Real& t)->Real { return exp(-t)/sqrt(t); };
+    exp_sinh<Real> integrator(14);
+    Real error, L1;
+    std::size_t levels;
+    Real Q = integrator.integrate(f, get_convergence_tolerance<Real>(), &error, &L1, &levels);
+    exp_sinh<Real> shared1 = exp_sinh<Real>::shared(14);
+    exp_sinh<Real> shared2 = exp_sinh<Real>::shared(14);
+    for (exp_sinh<Real>* p : { &shared1, &shared2 })
+    {
+        Real error_shared, L1_shared;
+        std::size_t levels_shared;
+        Real Q_shared = p->integrate(f, get_convergence_tolerance<Real>(), &error_shared, &L1_shared, &levels_shared);
+        BOOST_CHECK_EQUAL(Q_shared, Q);
+        BOOST_CHECK_EQUAL(error_shared, error);
+        BOOST_CHECK_EQUAL(L1_shared, L1);
+        BOOST_CHECK_EQUAL(levels_shared, levels);
+    }
+    // The half infinite range mapping works as before:
+    Q = shared1.integrate(f, Real(0), boost::math::tools::max_value<Real>(), get_convergence_tolerance<Real>());
+    BOOST_CHECK_CLOSE_FRACTION(Q, root_pi<Real>(), 100 * boost::math::tools::epsilon<Real>());
+}
+
+template<class Real>
+void test_concurrent_refinement()
+{
+    std::cout << "Testing concurrent refinement on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    // No precomputed tables for Real, so the threads race to build the rows past the first few:
+    const auto f = [](const Real& t)->Real { return exp(-t)/sqrt(t); };
+    exp_sinh<Real> reference;
+    Real Q = reference.integrate(f);
+    for (unsigned trial = 0; trial < 4; ++trial)
+    {
+        exp_sinh<Real> integrator;
+        std::vector<Real> results(4);
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < results.size(); ++i)
+            threads.emplace_back([&, i]() { results[i] = integrator.integrate(f); });
+        for (std::thread& t : threads)
+            t.join();
+        for (const Real& r : results)
+            BOOST_CHECK_EQUAL(r, Q);
+    }
+}
+
+template<class Real>
+void test_statistics()
+{
+    std::cout << "Testing integration statistics on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    std::size_t calls = 0;
+    const auto f = [&](const Real& t)->Real { ++calls; return exp(-t)/sqrt(t); };
+    exp_sinh<Real> integrator(14);
+    Real error, L1;
+    std::size_t levels;
+    quadrature_statistics<Real> stats;
+    Real Q = integrator.integrate(f, get_convergence_tolerance<Real>(), &error, &L1, &levels, &stats);
+    BOOST_CHECK_EQUAL(stats.evaluations, calls);
+    BOOST_CHECK_EQUAL(stats.levels, levels);
+    BOOST_CHECK_EQUAL(stats.intervals, 1u);
+    BOOST_REQUIRE(!stats.errors.empty());
+    BOOST_CHECK_LE(stats.errors.size(), levels);
+    BOOST_CHECK_EQUAL(stats.errors.back(), error);
+    BOOST_CHECK_GE(stats.elapsed.count(), 0);
+    calls = 0;
+    BOOST_CHECK_EQUAL(integrator.integrate(f, get_convergence_tolerance<Real>()), Q);
+    BOOST_CHECK_EQUAL(calls, stats.evaluations);
+    // Mapped ranges:
+    const auto g = [&](const Real& t)->Real { ++calls; return exp(t)/sqrt(-t); };
+    calls = 0;
+    Q = integrator.integrate(g, -boost::math::tools::max_value<Real>(), Real(0), get_convergence_tolerance<Real>(), &error, &L1, &levels, &stats);
+    BOOST_CHECK_CLOSE_FRACTION(Q, root_pi<Real>(), 100 * boost::math::tools::epsilon<Real>());
+    BOOST_CHECK_EQUAL(stats.evaluations, calls);
+    BOOST_CHECK_EQUAL(stats.errors.back(), error);
+}
+
 BOOST_AUTO_TEST_CASE(exp_sinh_quadrature_test)
 {
    //
@@ -568,12 +648,16 @@ BOOST_AUTO_TEST_CASE(exp_sinh_quadrature_test)
     test_right_limit_infinite<float>();
     test_nr_examples<float>();
     test_crc<float>();
+    test_shared_tables<float>();
+    test_statistics<float>();
 #endif
 #ifdef TEST2
     test_left_limit_infinite<double>();
     test_right_limit_infinite<double>();
     test_nr_examples<double>();
     test_crc<double>();
+    test_shared_tables<double>();
+    test_statistics<double>();
 #endif
 #ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
 #ifdef TEST3
@@ -581,6 +665,7 @@ BOOST_AUTO_TEST_CASE(exp_sinh_quadrature_test)
     test_right_limit_infinite<long double>();
     test_nr_examples<long double>();
     test_crc<long double>();
+    test_shared_tables<long double>();
 #endif
 #endif
 #ifdef TEST4
@@ -588,6 +673,11 @@ BOOST_AUTO_TEST_CASE(exp_sinh_quadrature_test)
     test_right_limit_infinite<cpp_bin_float_quad>();
     test_nr_examples<cpp_bin_float_quad>();
     test_crc<cpp_bin_float_quad>();
+    test_shared_tables<cpp_bin_float_quad>();
+    test_statistics<cpp_bin_float_quad>();
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+    test_concurrent_refinement<cpp_bin_float_50>();
+#endif
 #endif
 
 #ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
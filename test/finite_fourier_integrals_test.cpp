@@ -0,0 +1,182 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+#define BOOST_TEST_MODULE finite_fourier_integrals_test
+
+#include <cmath>
+#include <complex>
+#include <iostream>
+#include <boost/type_index.hpp>
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/math/quadrature/finite_fourier_integrals.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::quadrature::finite_fourier_integrals;
+using boost::multiprecision::cpp_bin_float_quad;
+using std::vector;
+using std::complex;
+
+template<class Real>
+vector<Real> frequencies(std::size_t n, Real max_omega)
+{
+    vector<Real> omegas(n);
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        // Include zero and negative frequencies:
+        omegas[k] = max_omega*(2*Real(k)/(n - 1) - 1);
+    }
+    return omegas;
+}
+
+template<class Real>
+void test_exponential()
+{
+    std::cout << "Testing Fourier integrals of exp(-t) on [0, 2] on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using std::exp;
+    using std::abs;
+    Real a = 0;
+    Real b = 2;
+    auto f = [](Real t) { return exp(-t); };
+    vector<Real> omegas = frequencies<Real>(101, 50);
+    finite_fourier_integrals<Real> integrator;
+    Real tol = 100*std::numeric_limits<Real>::epsilon();
+    Real error;
+    Real L1;
+    auto I = integrator.integrate(f, a, b, omegas, tol, &error, &L1);
+    BOOST_REQUIRE_EQUAL(I.size(), omegas.size());
+    BOOST_CHECK_CLOSE_FRACTION(L1, 1 - exp(-b), tol);
+    for (std::size_t k = 0; k < omegas.size(); ++k)
+    {
+        complex<Real> z(-1, omegas[k]);
+        complex<Real> expected = (exp(z*b) - exp(z*a))/z;
+        BOOST_CHECK_SMALL(abs(I[k] - expected), 10*tol);
+    }
+}
+
+template<class Real>
+void test_characteristic_function()
+{
+    std::cout << "Testing the characteristic function of the uniform distribution on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using std::sin;
+    using std::cos;
+    using std::abs;
+    Real a = -1;
+    Real b = 3;
+    auto f = [&](Real) { return 1/(b - a); };
+    vector<Real> omegas = frequencies<Real>(64, 20);
+    finite_fourier_integrals<Real> integrator;
+    Real tol = 100*std::numeric_limits<Real>::epsilon();
+    auto I = integrator.integrate(f, a, b, omegas, tol);
+    for (std::size_t k = 0; k < omegas.size(); ++k)
+    {
+        Real w = omegas[k];
+        complex<Real> expected = (complex<Real>(cos(w*b), sin(w*b)) - complex<Real>(cos(w*a), sin(w*a)))/(complex<Real>(0, w)*(b - a));
+        BOOST_CHECK_SMALL(abs(I[k] - expected), 10*tol);
+    }
+}
+
+template<class Real>
+void test_single_evaluation_per_node()
+{
+    std::cout << "Testing that the integrand is evaluated once per node for all frequencies on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using std::sqrt;
+    using std::abs;
+    std::size_t calls = 0;
+    auto f = [&](Real t) { ++calls; return 1/(1 + t*t); };
+    vector<Real> omegas = frequencies<Real>(200, 10);
+    finite_fourier_integrals<Real> integrator;
+    Real tol = sqrt(std::numeric_limits<Real>::epsilon());
+    Real error;
+    auto I = integrator.integrate(f, Real(0), Real(4), omegas, tol, &error);
+    std::size_t batch_calls = calls;
+
+    // The calls needed for the highest frequency alone:
+    calls = 0;
+    vector<Real> highest(1, omegas.back());
+    auto J = integrator.integrate(f, Real(0), Real(4), highest, tol);
+    BOOST_CHECK_LE(batch_calls, 2*calls);
+    BOOST_CHECK_SMALL(abs(I.back() - J[0]), 10*tol);
+    // Even and odd in omega:
+    BOOST_CHECK_SMALL(abs(I.front() - std::conj(I.back())), 10*tol);
+}
+
+template<class Real>
+void test_high_frequency()
+{
+    std::cout << "Testing highly oscillatory finite Fourier integrals on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using std::sin;
+    using std::cos;
+    using std::abs;
+    using std::sqrt;
+    Real a = Real(1)/2;
+    Real b = Real(7)/2;
+    auto f = [](Real t) { return t; };
+    // int t exp(i w t) dt = exp(i w t)(1/w^2 - i t/w):
+    auto F = [](Real w, Real t) { return complex<Real>(cos(w*t), sin(w*t))*complex<Real>(1/(w*w), -t/w); };
+    Real tol = sqrt(std::numeric_limits<Real>::epsilon());
+    // max|omega|*(b - a) = 1e3 and 1e4, the second needing more levels than the default allows:
+    for (unsigned max_refinements : {15u, 20u})
+    {
+        Real max_omega = max_refinements == 15 ? Real(1000)/3 : Real(10000)/3;
+        vector<Real> omegas = frequencies<Real>(50, max_omega);
+        // No zero frequency, which the closed form above does not cover:
+        omegas.push_back(max_omega/7);
+        omegas.erase(omegas.begin(), omegas.begin() + 25);
+        finite_fourier_integrals<Real> integrator(max_refinements);
+        Real error;
+        Real L1;
+        std::size_t levels;
+        auto I = integrator.integrate(f, a, b, omegas, tol, &error, &L1, &levels);
+        BOOST_CHECK_CLOSE_FRACTION(L1, Real(6), tol);
+        BOOST_CHECK_LE(error, tol*L1);
+        BOOST_CHECK_LT(levels, max_refinements + 1);
+        for (std::size_t k = 0; k < omegas.size(); ++k)
+        {
+            complex<Real> expected = F(omegas[k], b) - F(omegas[k], a);
+            BOOST_CHECK_SMALL(abs(I[k] - expected), 10*tol);
+        }
+        // Reversing the bounds negates the integrals:
+        auto J = integrator.integrate(f, b, a, omegas, tol);
+        BOOST_CHECK_SMALL(abs(I.back() + J.back()), 10*tol);
+    }
+}
+
+template<class Real>
+void test_errors()
+{
+    std::cout << "Testing error handling of finite Fourier integrals on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    auto f = [](Real t) { return t; };
+    finite_fourier_integrals<Real> integrator;
+    vector<Real> omegas(3, Real(1));
+    BOOST_CHECK_THROW(integrator.integrate(f, Real(0), std::numeric_limits<Real>::infinity(), omegas), std::domain_error);
+    BOOST_CHECK(integrator.integrate(f, Real(0), Real(1), vector<Real>()).empty());
+    // An empty interval gives zeros without evaluating f:
+    std::size_t calls = 0;
+    auto g = [&](Real t) { ++calls; return t; };
+    auto I = integrator.integrate(g, Real(1), Real(1), omegas);
+    BOOST_REQUIRE_EQUAL(I.size(), omegas.size());
+    BOOST_CHECK_EQUAL(I[0], complex<Real>(0));
+    BOOST_CHECK_EQUAL(calls, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(finite_fourier_integrals_test)
+{
+#ifdef TEST1
+    test_exponential<float>();
+    test_exponential<double>();
+    test_exponential<long double>();
+    test_characteristic_function<double>();
+    test_single_evaluation_per_node<double>();
+    test_high_frequency<double>();
+    test_high_frequency<long double>();
+    test_errors<double>();
+#endif
+#ifdef TEST2
+    test_exponential<cpp_bin_float_quad>();
+    test_characteristic_function<cpp_bin_float_quad>();
+    test_high_frequency<cpp_bin_float_quad>();
+#endif
+}
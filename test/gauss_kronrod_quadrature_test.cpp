@@ -396,6 +396,11 @@ void test_right_limit_infinite()
     Q = gauss_kronrod<Real, Points>::integrate(f1, 0, boost::math::tools::max_value<Real>(), 0, 0, &error, &L1);
     Q_expected = half_pi<Real>();
     BOOST_CHECK_CLOSE(Q, Q_expected, 100*tol);
+    // The error estimate is that of the mapped integral over (-1, 1), which is half the result:
+    auto u = [&](const Real& t)->Real { Real z = 1 / (t + 1); return f1(2 * z - 1) * z * z; };
+    Real error_mapped;
+    gauss_kronrod<Real, Points>::integrate(u, Real(-1), Real(1), 0, 0, &error_mapped);
+    BOOST_CHECK_EQUAL(error, error_mapped);
 
     auto f4 = [](const Real& t)->Real { return 1/(1+t*t); };
     Q = gauss_kronrod<Real, Points>::integrate(f4, 1, boost::math::tools::max_value<Real>(), 0, 0, &error, &L1);
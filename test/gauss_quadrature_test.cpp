@@ -6,7 +6,9 @@
 
 #define BOOST_TEST_MODULE tanh_sinh_quadrature_test
 
+#include <array>
 #include <complex>
+#include <vector>
 //#include <boost/multiprecision/mpc.hpp>
 #include <boost/config.hpp>
 #include <boost/detail/workaround.hpp>
@@ -406,6 +408,147 @@ void test_left_limit_infinite()
     BOOST_CHECK_CLOSE(Q, Q_expected, 100*tol);
 }
 
+template<class Real, unsigned Points>
+void test_vector_valued()
+{
+    std::cout << "Testing vector valued integrands are integrated properly by Gaussian quadrature on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    // Moments of exp(-x) on [0,1], each abscissa should be evaluated once only, and each component
+    // must agree exactly with the scalar result:
+    auto moment = [](unsigned k, const Real& x)->Real
+    {
+       Real r = exp(-x);
+       for (unsigned i = 0; i < k; ++i)
+          r *= x;
+       return r;
+    };
+    std::size_t calls = 0;
+    auto f = [&](const Real& x)->std::array<Real, 4>
+    {
+       ++calls;
+       return {{ moment(0, x), moment(1, x), moment(2, x), moment(3, x) }};
+    };
+    Real L1;
+    std::array<Real, 4> Q = gauss<Real, Points>::integrate(f, Real(0), Real(1), &L1);
+    BOOST_CHECK_EQUAL(calls, Points);
+    for (unsigned k = 0; k < 4; ++k)
+    {
+       auto g = [&](const Real& x)->Real { return moment(k, x); };
+       Real Q_scalar = gauss<Real, Points>::integrate(g, Real(0), Real(1));
+       BOOST_CHECK_EQUAL(Q[k], Q_scalar);
+    }
+    // The L1 norm is that of the largest component:
+    BOOST_CHECK_EQUAL(L1, Q[0]);
+
+    // std::vector, and infinite ranges:
+    auto h = [](const Real& x)->std::vector<Real>
+    {
+       std::vector<Real> r(2);
+       r[0] = 1 / (1 + x*x);
+       r[1] = -r[0];
+       return r;
+    };
+    std::vector<Real> V = gauss<Real, Points>::integrate(h, -boost::math::tools::max_value<Real>(), boost::math::tools::max_value<Real>());
+    BOOST_CHECK_EQUAL(V.size(), 2u);
+    Real Q_scalar = gauss<Real, Points>::integrate([](const Real& x) { return 1 / (1 + x*x); }, -boost::math::tools::max_value<Real>(), boost::math::tools::max_value<Real>());
+    BOOST_CHECK_EQUAL(V[0], Q_scalar);
+    BOOST_CHECK_EQUAL(V[1], -V[0]);
+    // The integrand is never called just to find the number of components, so an empty range gives an empty result:
+    calls = 0;
+    auto counted = [&](const Real& x) { ++calls; return h(x); };
+    V = gauss<Real, Points>::integrate(counted, Real(1), Real(1));
+    BOOST_CHECK(V.empty());
+    BOOST_CHECK_EQUAL(calls, 0u);
+    // Whereas a std::array has its shape regardless:
+    auto k = [&](const Real& x)->std::array<Real, 2> { ++calls; return {{ 1 / (1 + x*x), -1 / (1 + x*x) }}; };
+    std::array<Real, 2> A = gauss<Real, Points>::integrate(k, Real(1), Real(1));
+    BOOST_CHECK_EQUAL(A[0], 0);
+    BOOST_CHECK_EQUAL(A[1], 0);
+    BOOST_CHECK_EQUAL(calls, 0u);
+}
+
+template<class Real, unsigned Points>
+void test_arbitrary_order()
+{
+    std::cout << "Testing the " << Points << " point Gauss rule not in the tables on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using std::abs;
+    using std::pow;
+    // Agrees with the rule computed at run time to within rounding error
+    // (computed in higher precision, since rounding errors accumulate in the root finding)
+    typedef boost::math::quadrature::detail::gauss_detail<cpp_bin_float_quad, Points, 999> runtime_rule;
+    typedef gauss<Real, Points> rule;
+    BOOST_REQUIRE_EQUAL(rule::abscissa().size(), runtime_rule::abscissa().size());
+    for (unsigned i = 0; i < runtime_rule::abscissa().size(); ++i)
+    {
+       BOOST_CHECK_SMALL(Real(rule::abscissa()[i] - static_cast<Real>(runtime_rule::abscissa()[i])), 4 * boost::math::tools::epsilon<Real>());
+       BOOST_CHECK_CLOSE_FRACTION(rule::weights()[i], static_cast<Real>(runtime_rule::weights()[i]), 4 * boost::math::tools::epsilon<Real>());
+    }
+    // Exact for polynomials of degree 2N - 1:
+    Real tol = boost::math::tools::epsilon<Real>() * 4 * Points;
+    auto f = [](const Real& x) { return pow(x, Real(2 * Points - 2)) + pow(x, Real(2 * Points - 1)); };
+    Real Q = rule::integrate(f, (Real) 0, (Real) 1);
+    BOOST_CHECK_CLOSE_FRACTION(Q, Real(1) / (2 * Points - 1) + Real(1) / (2 * Points), tol);
+#ifdef BOOST_MATH_HAS_CONSTEXPR_GAUSS_NODES
+    // The nodes are available at compile time, up to the limit above which they are computed on demand:
+    static_assert((Points > BOOST_MATH_GAUSS_CONSTEXPR_MAX_POINTS) || (boost::math::quadrature::detail::make_gauss_constexpr_table<(Points > BOOST_MATH_GAUSS_CONSTEXPR_MAX_POINTS ? 1 : Points)>().abscissa[(Points - 1) / 2] < 1), "Gauss nodes are not constexpr");
+#endif
+}
+
+template<class Real, unsigned Points>
+void test_large_order()
+{
+    std::cout << "Testing " << Points << " point Gauss-Legendre quadrature on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using std::cos;
+    using std::sin;
+    // Too large to be computed at compile time, so computed on demand instead:
+    typedef gauss<Real, Points> rule;
+    BOOST_CHECK_EQUAL(rule::abscissa().size(), (Points + 1) / 2);
+    Real Q = rule::integrate([](const Real& x) { return cos(x); }, (Real) 0, (Real) 1);
+    BOOST_CHECK_CLOSE_FRACTION(Q, sin(Real(1)), 16 * boost::math::tools::epsilon<Real>());
+}
+
+template<class Real, unsigned Points>
+void test_vectorized()
+{
+    std::cout << "Testing vectorized integrands are integrated properly by Gaussian quadrature on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using std::abs;
+    typedef gauss<Real, Points> rule;
+    Real tol = 8 * boost::math::tools::epsilon<Real>();
+    Real inf = boost::math::tools::max_value<Real>();
+    std::size_t calls = 0;
+    std::size_t points = 0;
+    auto f = [&](const Real* x, Real* y, std::size_t n)
+    {
+       ++calls;
+       points += n;
+       for (std::size_t i = 0; i < n; ++i)
+          y[i] = 1 / (1 + x[i] * x[i]);
+    };
+    auto g = [](const Real& x) { return 1 / (1 + x*x); };
+    // Every abscissa is passed in a single call, and the results agree with the scalar version:
+    Real L1;
+    Real Q = rule::integrate(f, Real(0), Real(1), &L1);
+    BOOST_CHECK_EQUAL(calls, 1u);
+    BOOST_CHECK_EQUAL(points, Points);
+    BOOST_CHECK_CLOSE_FRACTION(Q, rule::integrate(g, Real(0), Real(1)), tol);
+    BOOST_CHECK_CLOSE_FRACTION(L1, Q, tol);
+    Q = rule::integrate(f);
+    BOOST_CHECK_CLOSE_FRACTION(Q, rule::integrate(g), tol);
+    Q = rule::integrate(f, Real(1), inf, &L1);
+    BOOST_CHECK_CLOSE_FRACTION(Q, rule::integrate(g, Real(1), inf), tol);
+    BOOST_CHECK_CLOSE_FRACTION(L1, Q, tol);
+    Q = rule::integrate(f, -inf, Real(0));
+    BOOST_CHECK_CLOSE_FRACTION(Q, rule::integrate(g, -inf, Real(0)), tol);
+    Q = rule::integrate(f, -inf, inf);
+    BOOST_CHECK_CLOSE_FRACTION(Q, rule::integrate(g, -inf, inf), tol);
+    // Reversed and empty ranges:
+    Q = rule::integrate(f, Real(1), Real(0));
+    BOOST_CHECK_CLOSE_FRACTION(Q, -rule::integrate(g, Real(0), Real(1)), tol);
+    calls = 0;
+    Q = rule::integrate(f, Real(1), Real(1));
+    BOOST_CHECK_EQUAL(Q, 0);
+    BOOST_CHECK_EQUAL(calls, 0u);
+}
+
 template<class Complex>
 void test_complex_lambert_w()
 {
@@ -448,6 +591,7 @@ BOOST_AUTO_TEST_CASE(gauss_quadrature_test)
     test_integration_over_real_line<double, 7>();
     test_right_limit_infinite<double, 7>();
     test_left_limit_infinite<double, 7>();
+    test_vector_valued<double, 7>();
 
     test_linear<double, 9>();
     test_quadratic<double, 9>();
@@ -456,6 +600,7 @@ BOOST_AUTO_TEST_CASE(gauss_quadrature_test)
     test_integration_over_real_line<double, 9>();
     test_right_limit_infinite<double, 9>();
     test_left_limit_infinite<double, 9>();
+    test_vector_valued<double, 9>();
 
     test_linear<cpp_bin_float_quad, 10>();
     test_quadratic<cpp_bin_float_quad, 10>();
@@ -464,6 +609,18 @@ BOOST_AUTO_TEST_CASE(gauss_quadrature_test)
     test_integration_over_real_line<cpp_bin_float_quad, 10>();
     test_right_limit_infinite<cpp_bin_float_quad, 10>();
     test_left_limit_infinite<cpp_bin_float_quad, 10>();
+    test_vector_valued<cpp_bin_float_quad, 10>();
+
+    test_arbitrary_order<double, 1>();
+    test_arbitrary_order<double, 12>();
+    test_arbitrary_order<double, 64>();
+    test_large_order<double, 1000>();
+    test_arbitrary_order<float, 5>();
+    test_arbitrary_order<float, 40>();
+
+    test_vectorized<double, 7>();
+    test_vectorized<double, 12>();
+    test_vectorized<cpp_bin_float_quad, 10>();
 #endif
 #ifdef TEST2
     test_linear<cpp_bin_float_quad, 15>();
@@ -473,6 +630,7 @@ BOOST_AUTO_TEST_CASE(gauss_quadrature_test)
     test_integration_over_real_line<cpp_bin_float_quad, 15>();
     test_right_limit_infinite<cpp_bin_float_quad, 15>();
     test_left_limit_infinite<cpp_bin_float_quad, 15>();
+    test_vector_valued<cpp_bin_float_quad, 15>();
 
     test_linear<cpp_bin_float_quad, 20>();
     test_quadratic<cpp_bin_float_quad, 20>();
@@ -481,6 +639,7 @@ BOOST_AUTO_TEST_CASE(gauss_quadrature_test)
     test_integration_over_real_line<cpp_bin_float_quad, 20>();
     test_right_limit_infinite<cpp_bin_float_quad, 20>();
     test_left_limit_infinite<cpp_bin_float_quad, 20>();
+    test_vector_valued<cpp_bin_float_quad, 20>();
 
     test_linear<cpp_bin_float_quad, 25>();
     test_quadratic<cpp_bin_float_quad, 25>();
@@ -489,6 +648,7 @@ BOOST_AUTO_TEST_CASE(gauss_quadrature_test)
     test_integration_over_real_line<cpp_bin_float_quad, 25>();
     test_right_limit_infinite<cpp_bin_float_quad, 25>();
     test_left_limit_infinite<cpp_bin_float_quad, 25>();
+    test_vector_valued<cpp_bin_float_quad, 25>();
 
     test_linear<cpp_bin_float_quad, 30>();
     test_quadratic<cpp_bin_float_quad, 30>();
@@ -497,6 +657,7 @@ BOOST_AUTO_TEST_CASE(gauss_quadrature_test)
     test_integration_over_real_line<cpp_bin_float_quad, 30>();
     test_right_limit_infinite<cpp_bin_float_quad, 30>();
     test_left_limit_infinite<cpp_bin_float_quad, 30>();
+    test_vector_valued<cpp_bin_float_quad, 30>();
 
 
 #endif
@@ -506,6 +667,7 @@ BOOST_AUTO_TEST_CASE(gauss_quadrature_test)
     test_complex_lambert_w<std::complex<long double>>();
 #ifdef BOOST_HAS_FLOAT128
     test_left_limit_infinite<boost::multiprecision::float128, 30>();
+    test_vector_valued<boost::multiprecision::float128, 30>();
     test_complex_lambert_w<boost::multiprecision::complex128>();
 #endif
     test_complex_lambert_w<boost::multiprecision::cpp_complex_quad>();
@@ -0,0 +1,258 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_TEST_MODULE gauss_weighted_quadrature_test
+
+#include <complex>
+#include <stdexcept>
+#include <boost/config.hpp>
+#include <boost/detail/workaround.hpp>
+
+#if !defined(BOOST_NO_CXX11_DECLTYPE) && !defined(BOOST_NO_CXX11_TRAILING_RESULT_TYPES) && !defined(BOOST_NO_SFINAE_EXPR)
+
+#include <boost/type_index.hpp>
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/math/quadrature/gauss_jacobi.hpp>
+#include <boost/math/quadrature/gauss_laguerre.hpp>
+#include <boost/math/quadrature/gauss_hermite.hpp>
+#include <boost/math/quadrature/gauss.hpp>
+#include <boost/math/special_functions/jacobi.hpp>
+#include <boost/math/special_functions/laguerre.hpp>
+#include <boost/math/special_functions/hermite.hpp>
+#include <boost/math/special_functions/bessel.hpp>
+#include <boost/math/special_functions/expint.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+#if !defined(TEST1) && !defined(TEST2) && !defined(TEST3)
+#  define TEST1
+#  define TEST2
+#  define TEST3
+#endif
+
+using std::abs;
+using std::exp;
+using std::cos;
+using std::pow;
+using std::sqrt;
+using boost::math::quadrature::gauss_jacobi;
+using boost::math::quadrature::gauss_laguerre;
+using boost::math::quadrature::gauss_hermite;
+using boost::math::quadrature::gauss;
+using boost::multiprecision::cpp_bin_float_quad;
+
+template<class Real>
+void test_gauss_hermite()
+{
+   std::cout << "Testing Gauss-Hermite quadrature on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   Real tol = 20 * boost::math::tools::epsilon<Real>();
+   for (unsigned n = 1; n <= 30; ++n)
+   {
+      gauss_hermite<Real> rule(n);
+      BOOST_CHECK_EQUAL(rule.order(), n);
+      for (unsigned i = 0; i < n; ++i)
+      {
+         // Increasing, symmetric, and the zeros of H_n:
+         Real x = rule.abscissa()[i];
+         BOOST_CHECK_EQUAL(x, -rule.abscissa()[n - 1 - i]);
+         BOOST_CHECK_EQUAL(rule.weights()[i], rule.weights()[n - 1 - i]);
+         if (i)
+            BOOST_CHECK_LT(rule.abscissa()[i - 1], x);
+         BOOST_CHECK_SMALL(boost::math::hermite(n, x) / (2 * n * boost::math::hermite(n - 1, x)), tol * (1 + abs(x)));
+      }
+      // Exact for the even moments \int x^{2k} e^{-x^2} dx = \Gamma(k + 1/2), k < n (but not so large as to overflow a float):
+      for (unsigned k = 0; k < (std::min)(n, 12u); ++k)
+      {
+         Real Q = rule.integrate([k](Real x) { return pow(x, Real(2 * k)); });
+         BOOST_CHECK_CLOSE_FRACTION(Q, boost::math::tgamma(Real(k) + boost::math::constants::half<Real>()), (2 + k) * tol);
+      }
+   }
+
+   // Expectations under a normal distribution:
+   gauss_hermite<Real> rule(30);
+   Real mu = Real(3) / 4;
+   Real sigma = Real(1) / 2;
+   BOOST_CHECK_CLOSE_FRACTION(rule.expectation([](Real x) { return x*x; }, mu, sigma), mu*mu + sigma*sigma, tol);
+   // E[e^X] = e^{mu + sigma^2/2}:
+   BOOST_CHECK_CLOSE_FRACTION(rule.expectation([](Real x) { using std::exp; return exp(x); }, mu, sigma), exp(mu + sigma*sigma/2), tol);
+   // E[cos X] = e^{-sigma^2/2} cos(mu):
+   BOOST_CHECK_CLOSE_FRACTION(rule.expectation([](Real x) { using std::cos; return cos(x); }, mu, sigma), exp(-sigma*sigma/2) * cos(mu), tol);
+   BOOST_CHECK_CLOSE_FRACTION(rule.expectation([](Real x) { using std::cos; return cos(x); }), exp(-Real(1)/2), tol);
+   // Complex valued integrands, E[e^{iX}] = e^{i mu - sigma^2/2}:
+   std::complex<Real> phi = rule.expectation([](Real x) { using std::cos; using std::sin; return std::complex<Real>(cos(x), sin(x)); }, mu, sigma);
+   BOOST_CHECK_CLOSE_FRACTION(phi.real(), exp(-sigma*sigma/2) * cos(mu), tol);
+   BOOST_CHECK_CLOSE_FRACTION(phi.imag(), exp(-sigma*sigma/2) * sin(mu), tol);
+
+   // High orders neither overflow nor lose the normalization:
+   gauss_hermite<Real> big(200);
+   Real L1;
+   BOOST_CHECK_CLOSE_FRACTION(big.integrate([](Real) { return Real(1); }, &L1), boost::math::constants::root_pi<Real>(), 10 * tol);
+   BOOST_CHECK_CLOSE_FRACTION(L1, boost::math::constants::root_pi<Real>(), 10 * tol);
+
+   // Rules are cached:
+   BOOST_CHECK_EQUAL(&gauss_hermite<Real>(30).abscissa(), &rule.abscissa());
+
+   BOOST_CHECK_THROW(gauss_hermite<Real>(0), std::domain_error);
+   BOOST_CHECK_THROW(rule.expectation([](Real x) { return x; }, mu, -sigma), std::domain_error);
+}
+
+template<class Real>
+void test_gauss_laguerre()
+{
+   std::cout << "Testing Gauss-Laguerre quadrature on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   Real tol = 50 * boost::math::tools::epsilon<Real>();
+   for (unsigned n = 1; n <= 20; ++n)
+   {
+      gauss_laguerre<Real> rule(n);
+      for (unsigned i = 0; i < n; ++i)
+      {
+         Real x = rule.abscissa()[i];
+         BOOST_CHECK_GT(x, 0);
+         BOOST_CHECK_GT(rule.weights()[i], 0);
+         if (i)
+            BOOST_CHECK_LT(rule.abscissa()[i - 1], x);
+         // The zeros of L_n, whose derivative is n (L_n - L_{n-1})/x:
+         Real dL = n * (boost::math::laguerre(n, x) - boost::math::laguerre(n - 1, x)) / x;
+         BOOST_CHECK_SMALL(boost::math::laguerre(n, x) / dL, tol * x);
+      }
+      // Exact for the moments \int x^{alpha + k} e^{-x} dx = \Gamma(alpha + k + 1), k < 2n (but not so large as to overflow a float):
+      for (Real alpha : { Real(0), Real(-1) / 2, Real(3) / 2 })
+      {
+         gauss_laguerre<Real> r(n, alpha);
+         BOOST_CHECK_EQUAL(r.alpha(), alpha);
+         for (unsigned k = 0; k < (std::min)(2 * n, 16u); ++k)
+         {
+            Real Q = r.integrate([k](Real x) { return pow(x, Real(k)); });
+            BOOST_CHECK_CLOSE_FRACTION(Q, boost::math::tgamma(alpha + k + 1), (2 + 2 * k) * tol);
+         }
+      }
+   }
+   // A smooth integrand: \int_0^\infty e^{-x} / (1 + x) dx = e E_1(1):
+   gauss_laguerre<Real> rule(40);
+   Real Q = rule.integrate([](Real x) { return 1 / (1 + x); });
+   BOOST_CHECK_CLOSE_FRACTION(Q, boost::math::constants::e<Real>() * boost::math::expint(1, Real(1)), Real(1e-5));
+   // \int_0^\infty x^{-1/2} e^{-x} cos(x) dx = \Gamma(1/2) cos(\pi/8) / 2^{1/4}, where 40 points reach about 28 digits:
+   gauss_laguerre<Real> singular(40, -Real(1) / 2);
+   Q = singular.integrate([](Real x) { using std::cos; return cos(x); });
+   BOOST_CHECK_CLOSE_FRACTION(Q, boost::math::constants::root_pi<Real>() * cos(boost::math::constants::pi<Real>() / 8) / pow(Real(2), Real(1) / 4), (std::max)(10 * tol, Real(1e-27)));
+
+   BOOST_CHECK_EQUAL(&gauss_laguerre<Real>(40, -Real(1) / 2).weights(), &singular.weights());
+   BOOST_CHECK_THROW(gauss_laguerre<Real>(0), std::domain_error);
+   BOOST_CHECK_THROW(gauss_laguerre<Real>(5, Real(-1)), std::domain_error);
+
+   // Rules are generated at the precision of the policy, so are not shared between policies:
+   typedef boost::math::policies::policy<boost::math::policies::promote_float<false>, boost::math::policies::promote_double<false> > no_promotion;
+   gauss_laguerre<Real, no_promotion> unpromoted(40, -Real(1) / 2);
+   BOOST_CHECK_NE(&unpromoted.weights(), &singular.weights());
+   // A rule with invalid parameters is empty when errors don't throw:
+   typedef boost::math::policies::policy<boost::math::policies::domain_error<boost::math::policies::ignore_error> > ignore_domain;
+   gauss_laguerre<Real, ignore_domain> invalid(5, Real(-1));
+   BOOST_CHECK_EQUAL(invalid.order(), 0u);
+   BOOST_CHECK(invalid.abscissa().empty());
+   BOOST_CHECK(invalid.weights().empty());
+   BOOST_CHECK((boost::math::isnan)(invalid.integrate([](Real x) { return x; })));
+}
+
+template<class Real>
+void test_gauss_jacobi()
+{
+   std::cout << "Testing Gauss-Jacobi quadrature on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   Real tol = 50 * boost::math::tools::epsilon<Real>();
+   Real parameters[] = { Real(0), Real(-1) / 2, Real(1) / 2, Real(3), Real(-9) / 10 };
+   for (unsigned n = 1; n <= 20; ++n)
+   {
+      for (Real alpha : parameters)
+      {
+         for (Real beta : parameters)
+         {
+            gauss_jacobi<Real> rule(n, alpha, beta);
+            Real sum = 0;
+            for (unsigned i = 0; i < n; ++i)
+            {
+               Real x = rule.abscissa()[i];
+               BOOST_CHECK_GT(x, -1);
+               BOOST_CHECK_LT(x, 1);
+               BOOST_CHECK_GT(rule.weights()[i], 0);
+               if (i)
+                  BOOST_CHECK_LT(rule.abscissa()[i - 1], x);
+               // The zeros of P_n^{(alpha, beta)}:
+               BOOST_CHECK_SMALL(boost::math::jacobi(n, alpha, beta, x) / boost::math::jacobi_prime(n, alpha, beta, x), tol);
+               sum += rule.weights()[i];
+            }
+            // The weights sum to the integral of the weight function:
+            Real mu0 = pow(Real(2), alpha + beta + 1) * boost::math::beta(alpha + 1, beta + 1);
+            BOOST_CHECK_CLOSE_FRACTION(sum, mu0, 10 * tol);
+         }
+      }
+   }
+
+   // alpha = beta = 0 is Gauss-Legendre:
+   gauss_jacobi<Real> legendre(10, Real(0), Real(0));
+   typedef gauss<Real, 10> rule10;
+   for (unsigned i = 0; i < 5; ++i)
+   {
+      BOOST_CHECK_CLOSE_FRACTION(legendre.abscissa()[5 + i], rule10::abscissa()[i], tol);
+      BOOST_CHECK_CLOSE_FRACTION(legendre.weights()[5 + i], rule10::weights()[i], tol);
+   }
+
+   // Exact for polynomials of degree 2n - 1, here against \int_{-1}^{1} (1-x)^{1/2} (1+x)^{3} x^2 dx, computed by the Legendre rule after
+   // the substitution x = 1 - 2u^2 which removes the singularity:
+   gauss_jacobi<Real> rule(4, Real(1) / 2, Real(3));
+   auto g = [](Real u) { Real x = 1 - 2 * u * u; return 4 * u * u * pow(1 + x, 3) * x * x * sqrt(Real(2)); };
+   BOOST_CHECK_CLOSE_FRACTION(rule.integrate([](Real x) { return x * x; }), (gauss<Real, 30>::integrate(g, Real(0), Real(1))), tol);
+
+   // Endpoint singularities on a general interval: \int_0^1 cos(x) / \sqrt{x(1-x)} dx = \pi J_0(1/2) cos(1/2):
+   gauss_jacobi<Real> chebyshev(20, -Real(1) / 2, -Real(1) / 2);
+   Real L1;
+   Real Q = chebyshev.integrate([](Real x) { using std::cos; return cos(x); }, Real(0), Real(1), &L1);
+   Real expected = boost::math::constants::pi<Real>() * boost::math::cyl_bessel_j(0, Real(1) / 2) * cos(Real(1) / 2);
+   BOOST_CHECK_CLOSE_FRACTION(Q, expected, tol);
+   BOOST_CHECK_CLOSE_FRACTION(L1, expected, tol);
+   // The weight is (b-x)^alpha (x-a)^beta, so that the interval's length appears as (b-a)^{alpha+beta+1}: \int_0^2 \sqrt{x} dx:
+   gauss_jacobi<Real> root(3, Real(0), Real(1) / 2);
+   BOOST_CHECK_CLOSE_FRACTION(root.integrate([](Real) { return Real(1); }, Real(0), Real(2)), 2 * sqrt(Real(8)) / 3, tol);
+   BOOST_CHECK_EQUAL(root.integrate([](Real) { return Real(1); }, Real(1), Real(1)), Real(0));
+
+   BOOST_CHECK_EQUAL(&gauss_jacobi<Real>(20, -Real(1) / 2, -Real(1) / 2).abscissa(), &chebyshev.abscissa());
+   BOOST_CHECK_THROW(gauss_jacobi<Real>(0, Real(0), Real(0)), std::domain_error);
+   BOOST_CHECK_THROW(gauss_jacobi<Real>(5, Real(0), Real(-2)), std::domain_error);
+   BOOST_CHECK_THROW(root.integrate([](Real x) { return x; }, Real(1), Real(0)), std::domain_error);
+
+   typedef boost::math::policies::policy<boost::math::policies::domain_error<boost::math::policies::ignore_error> > ignore_domain;
+   gauss_jacobi<Real, ignore_domain> invalid(5, Real(0), Real(-2));
+   BOOST_CHECK_EQUAL(invalid.order(), 0u);
+   BOOST_CHECK(invalid.abscissa().empty());
+   BOOST_CHECK(invalid.weights().empty());
+   BOOST_CHECK((boost::math::isnan)(invalid.integrate([](Real x) { return x; })));
+}
+
+BOOST_AUTO_TEST_CASE(gauss_weighted_quadrature_test)
+{
+#ifdef TEST1
+   test_gauss_hermite<float>();
+   test_gauss_hermite<double>();
+   test_gauss_hermite<long double>();
+   test_gauss_hermite<cpp_bin_float_quad>();
+#endif
+#ifdef TEST2
+   test_gauss_laguerre<float>();
+   test_gauss_laguerre<double>();
+   test_gauss_laguerre<long double>();
+   test_gauss_laguerre<cpp_bin_float_quad>();
+#endif
+#ifdef TEST3
+   test_gauss_jacobi<float>();
+   test_gauss_jacobi<double>();
+   test_gauss_jacobi<long double>();
+   test_gauss_jacobi<cpp_bin_float_quad>();
+#endif
+}
+
+#else
+
+int main() { return 0; }
+
+#endif
@@ -0,0 +1,189 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_TEST_MODULE genz_malik_test
+
+#include <boost/config.hpp>
+#include <boost/detail/workaround.hpp>
+
+#if !defined(BOOST_NO_CXX11_DECLTYPE) && !defined(BOOST_NO_CXX11_TRAILING_RESULT_TYPES) && !defined(BOOST_NO_SFINAE_EXPR) && !defined(BOOST_NO_CXX11_HDR_THREAD)
+
+#include <array>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/math/quadrature/genz_malik.hpp>
+#include <boost/math/special_functions/erf.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+#if !defined(TEST1) && !defined(TEST2)
+#  define TEST1
+#  define TEST2
+#endif
+
+using std::abs;
+using std::cos;
+using std::exp;
+using std::pow;
+using std::sin;
+using std::sqrt;
+using boost::math::quadrature::genz_malik;
+using boost::math::constants::pi;
+using boost::multiprecision::cpp_bin_float_quad;
+
+template<class Real>
+void test_polynomials()
+{
+    std::cout << "Testing polynomial exactness of genz_malik on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    Real tol = boost::math::tools::epsilon<Real>() * 100;
+    genz_malik<Real> integrator;
+    for (std::size_t n = 2; n <= 6; ++n)
+    {
+        // Every monomial of degree 7 or less is integrated exactly by a single application of the rule:
+        std::size_t calls = 0;
+        auto f = [&](const std::vector<Real>& x)->Real
+        {
+            ++calls;
+            return 1 + 3 * x[0] - x[1] * x[1] + pow(x[0], 7) + x[0] * x[0] * x[1] * x[1] * x[n - 1] * x[n - 1] * x[n - 1] - pow(x[n - 1], 6) * x[0];
+        };
+        std::vector<Real> a(n, Real(0)), b(n, Real(2));
+        // The mean value of each monomial over [0,2]^n, times the volume:
+        Real mixed = n == 2 ? Real(64) / 9 : Real(32) / 9;
+        Real expected = pow(Real(2), Real(n)) * (1 + 3 - Real(4) / 3 + 16 + mixed - Real(64) / 7);
+        Real error, L1;
+        Real Q = integrator.integrate(f, a, b, Real(1), &error, &L1);
+        BOOST_CHECK_CLOSE_FRACTION(Q, expected, tol);
+        BOOST_CHECK_EQUAL(calls, (std::size_t(1) << n) + 2 * n * n + 2 * n + 1);
+        // Reversing one axis reverses the sign:
+        std::swap(a[1], b[1]);
+        Q = integrator.integrate(f, a, b, Real(1));
+        BOOST_CHECK_CLOSE_FRACTION(Q, -expected, tol);
+    }
+}
+
+template<class Real>
+void test_smooth(const genz_malik<Real>& integrator, Real tol)
+{
+    std::cout << "Testing smooth integrands with genz_malik on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    Real error, L1;
+    // A Gaussian in three dimensions, with the point type a std::array:
+    auto g = [](const std::array<Real, 3>& x)->Real { return exp(-x[0] * x[0] - x[1] * x[1] - x[2] * x[2]); };
+    std::array<Real, 3> a3 = { { 0, 0, 0 } }, b3 = { { 1, 1, 1 } };
+    Real Q = integrator.integrate(g, a3, b3, tol, &error, &L1);
+    Real expected = pow(sqrt(pi<Real>()) * boost::math::erf(Real(1)) / 2, 3);
+    BOOST_CHECK_CLOSE_FRACTION(Q, expected, 10 * tol);
+    BOOST_CHECK_LE(error, tol * abs(Q));
+    BOOST_CHECK_CLOSE_FRACTION(L1, expected, 10 * tol);
+
+    // An oscillatory integrand in four dimensions, whose integral over the unit cube is 16 sin(1/2)^4 cos(2):
+    auto h = [](const std::vector<Real>& x)->Real { return cos(x[0] + x[1] + x[2] + x[3]); };
+    std::vector<Real> a4(4, Real(0)), b4(4, Real(1));
+    Q = integrator.integrate(h, a4, b4, tol, &error, &L1);
+    expected = 16 * pow(sin(Real(1) / 2), 4) * cos(Real(2));
+    BOOST_CHECK_CLOSE_FRACTION(Q, expected, 10 * tol);
+    BOOST_CHECK_LE(error, tol * abs(Q));
+    BOOST_CHECK_GE(L1, abs(Q));
+}
+
+template<class Real>
+void test_anisotropic()
+{
+    std::cout << "Testing an integrand with a kink along one axis with genz_malik on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    Real tol = sqrt(boost::math::tools::epsilon<Real>());
+    // Only the first coordinate is hard, so every box should be split along it:
+    auto f = [](const std::vector<Real>& x)->Real { return abs(x[0] - Real(1) / 3) * (1 + x[1] * x[2]); };
+    std::vector<Real> a(3, Real(0)), b(3, Real(1));
+    Real error;
+    std::size_t max_evaluations = 100000;
+    Real Q = genz_malik<Real>(1, 1).integrate(f, a, b, tol, &error, nullptr, max_evaluations);
+    Real expected = Real(5) / 18 * Real(5) / 4;
+    BOOST_CHECK_CLOSE_FRACTION(Q, expected, 10 * tol);
+    BOOST_CHECK_LE(error, tol * abs(Q));
+    // Now with too few evaluations permitted to converge: we must stop, with an honest error estimate:
+    std::size_t calls = 0;
+    auto g = [&](const std::vector<Real>& x)->Real { ++calls; return f(x); };
+    Q = genz_malik<Real>().integrate(g, a, b, tol, &error, nullptr, 200);
+    BOOST_CHECK_LE(calls, 200u);
+    BOOST_CHECK_GT(error, tol * abs(Q));
+    BOOST_CHECK_LE(abs(Q - expected), 10 * error);
+}
+
+template<class Real>
+void test_determinism()
+{
+    std::cout << "Testing that genz_malik does not depend on the thread count on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    // A peak near one corner, so that we refine a good many boxes:
+    auto f = [](const std::vector<Real>& x)->Real
+    {
+        Real r = 1;
+        for (std::size_t i = 0; i < x.size(); ++i)
+           r += 25 * (x[i] - Real(0.2)) * (x[i] - Real(0.2));
+        return 1 / (r * r);
+    };
+    std::vector<Real> a(3, Real(0)), b(3, Real(1));
+    Real tol = Real(1e-7);
+    Real error1, L1_1;
+    Real Q1 = genz_malik<Real>(1, 8).integrate(f, a, b, tol, &error1, &L1_1);
+    BOOST_CHECK_LE(error1, tol * abs(Q1));
+    for (unsigned threads = 2; threads <= 8; threads *= 2)
+    {
+        Real error, L1;
+        Real Q = genz_malik<Real>(threads, 8).integrate(f, a, b, tol, &error, &L1);
+        BOOST_CHECK_EQUAL(Q, Q1);
+        BOOST_CHECK_EQUAL(error, error1);
+        BOOST_CHECK_EQUAL(L1, L1_1);
+    }
+    // Refining one box at a time gets the same answer to within the error estimate:
+    Real Q = genz_malik<Real>(1, 1).integrate(f, a, b, tol);
+    BOOST_CHECK_LE(abs(Q - Q1), 2 * error1);
+}
+
+template<class Real>
+void test_errors()
+{
+    std::cout << "Testing error handling in genz_malik on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    auto f = [](const std::vector<Real>& x)->Real
+    {
+        if (x[0] > Real(0.75))
+           throw std::domain_error("Test");
+        return 1 / sqrt(x[0] + x[1]);
+    };
+    std::vector<Real> a(2, Real(0)), b(2, Real(1));
+    BOOST_CHECK_THROW(genz_malik<Real>().integrate(f, a, b), std::domain_error);
+    BOOST_CHECK_THROW(genz_malik<Real>(4, 16).integrate(f, a, b), std::domain_error);
+
+    auto g = [](const std::vector<Real>& x)->Real { return x[0]; };
+    std::vector<Real> c(1, Real(1)), d(3, Real(1));
+    BOOST_CHECK_THROW(genz_malik<Real>().integrate(g, a, d), std::domain_error);
+    BOOST_CHECK_THROW(genz_malik<Real>().integrate(g, std::vector<Real>(1, Real(0)), c), std::domain_error);
+    b[1] = std::numeric_limits<Real>::infinity();
+    BOOST_CHECK_THROW(genz_malik<Real>().integrate(g, a, b), std::domain_error);
+}
+
+BOOST_AUTO_TEST_CASE(genz_malik_test)
+{
+#ifdef TEST1
+    test_polynomials<double>();
+    test_smooth(genz_malik<double>(), 1e-8);
+    test_smooth(genz_malik<double>(4, 16), 1e-8);
+    test_anisotropic<double>();
+    test_determinism<double>();
+    test_errors<double>();
+#endif
+#ifdef TEST2
+    test_polynomials<cpp_bin_float_quad>();
+    test_smooth(genz_malik<cpp_bin_float_quad>(2), cpp_bin_float_quad(1e-8));
+    test_determinism<cpp_bin_float_quad>();
+#endif
+}
+
+#else
+
+int main() { return 0; }
+
+#endif
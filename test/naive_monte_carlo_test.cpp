@@ -110,7 +110,8 @@ void test_exception_from_integrand()
         {
             throw std::domain_error("You have done something wrong.\n");
         }
-        return (Real) 1;
+        // Not constant, or the error goal could be met before we ever hit the bad region:
+        return x[1];
     };
 
     std::vector<std::pair<Real, Real>> bounds{{ Real(0), Real(1)}, { Real(0), Real(1)}};
@@ -447,6 +448,39 @@ void test_radovic()
     }
 }
 
+template<class Real>
+void test_reproducibility()
+{
+    std::cout << "Testing that naive Monte-Carlo integration is reproducible for a given seed and thread count on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    auto g = [](std::vector<Real> const & x)->Real
+    {
+        return x[0]*x[1] + x[2];
+    };
+    vector<pair<Real, Real>> bounds{{ Real(0), Real(1)}, { Real(0), Real(2)}, { Real(0), Real(1)}};
+    naive_monte_carlo<Real, decltype(g)> mc1(g, bounds, (Real) 0.001, false, 3, 4357);
+    naive_monte_carlo<Real, decltype(g)> mc2(g, bounds, (Real) 0.001, false, 3, 4357);
+    Real y1 = mc1.integrate().get();
+    Real y2 = mc2.integrate().get();
+    BOOST_CHECK_EQUAL(y1, y2);
+    BOOST_CHECK_EQUAL(mc1.calls(), mc2.calls());
+    BOOST_CHECK_EQUAL(mc1.variance(), mc2.variance());
+    BOOST_CHECK_CLOSE_FRACTION(y1, 2, 0.01);
+    BOOST_CHECK_LE(mc1.current_error_estimate(), 0.001);
+
+    // Restarting with a tighter goal reuses the same threads, and continues the same random number streams:
+    mc1.update_target_error((Real) 0.0005);
+    mc2.update_target_error((Real) 0.0005);
+    y1 = mc1.integrate().get();
+    y2 = mc2.integrate().get();
+    BOOST_CHECK_EQUAL(y1, y2);
+    BOOST_CHECK_EQUAL(mc1.calls(), mc2.calls());
+    BOOST_CHECK_LE(mc1.current_error_estimate(), 0.0005);
+
+    // A different seed gives a different stream:
+    naive_monte_carlo<Real, decltype(g)> mc3(g, bounds, (Real) 0.001, false, 3, 4358);
+    Real y3 = mc3.integrate().get();
+    BOOST_CHECK_NE(y3, mc2.current_estimate());
+}
 
 BOOST_AUTO_TEST_CASE(naive_monte_carlo_test)
 {
@@ -540,5 +574,9 @@ BOOST_AUTO_TEST_CASE(naive_monte_carlo_test)
 #if !defined(TEST) || TEST == 23
     test_alternative_rng_2<double, 3>();
 #endif
+#if !defined(TEST) || TEST == 24
+    test_reproducibility<double>();
+    test_reproducibility<float>();
+#endif
 
 }
@@ -0,0 +1,224 @@
+// Copyright The Boost.Math contributors, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_TEST_MODULE parallel_gauss_kronrod_test
+
+#include <boost/config.hpp>
+#include <boost/detail/workaround.hpp>
+
+#if !defined(BOOST_NO_CXX11_DECLTYPE) && !defined(BOOST_NO_CXX11_TRAILING_RESULT_TYPES) && !defined(BOOST_NO_SFINAE_EXPR) && !defined(BOOST_NO_CXX11_HDR_THREAD)
+
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/math/quadrature/parallel_gauss_kronrod.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+#if !defined(TEST1) && !defined(TEST2)
+#  define TEST1
+#  define TEST2
+#endif
+
+using std::atan;
+using std::log;
+using std::sqrt;
+using std::abs;
+using std::exp;
+using std::cosh;
+using boost::math::quadrature::gauss_kronrod;
+using boost::math::quadrature::parallel_gauss_kronrod;
+using boost::math::constants::pi;
+using boost::math::constants::half_pi;
+using boost::math::constants::half;
+using boost::math::constants::third;
+using boost::math::constants::catalan;
+using boost::math::constants::ln_two;
+using boost::math::constants::root_two;
+using boost::multiprecision::cpp_bin_float_quad;
+
+template <class Real>
+Real get_termination_condition()
+{
+   return boost::math::tools::epsilon<Real>() * 1000;
+}
+
+template<class Real, unsigned Points>
+void test_linear_and_quadratic(const parallel_gauss_kronrod<Real, Points>& integrator)
+{
+    std::cout << "Testing polynomials with parallel_gauss_kronrod on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    Real tol = boost::math::tools::epsilon<Real>() * 10;
+    Real error, L1;
+    auto f = [](const Real& x) { return 5*x + 7; };
+    Real Q = integrator.integrate(f, (Real) 0, (Real) 1, 15, get_termination_condition<Real>(), &error, &L1);
+    BOOST_CHECK_CLOSE_FRACTION(Q, 9.5, tol);
+    BOOST_CHECK_CLOSE_FRACTION(L1, 9.5, tol);
+    BOOST_CHECK_LE(fabs(error / Q), get_termination_condition<Real>());
+    Q = integrator.integrate(f, (Real) 1, (Real) 0);
+    BOOST_CHECK_CLOSE_FRACTION(Q, -9.5, tol);
+
+    auto g = [](const Real& x) { return 5*x*x + 7*x + 12; };
+    Q = integrator.integrate(g, (Real) 0, (Real) 1, 15, get_termination_condition<Real>(), &error, &L1);
+    BOOST_CHECK_CLOSE_FRACTION(Q, (Real) 17 + half<Real>()*third<Real>(), tol);
+    BOOST_CHECK_CLOSE_FRACTION(L1, (Real) 17 + half<Real>()*third<Real>(), tol);
+}
+
+template<class Real, unsigned Points>
+void test_ca(const parallel_gauss_kronrod<Real, Points>& integrator)
+{
+    std::cout << "Testing integration of C(a) with parallel_gauss_kronrod on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    Real tol = boost::math::tools::epsilon<Real>() * 10;
+    Real L1;
+    Real error;
+
+    auto f1 = [](const Real& x) { return atan(x)/(x*(x*x + 1)) ; };
+    Real Q = integrator.integrate(f1, (Real) 0, (Real) 1, 15, get_termination_condition<Real>(), &error, &L1);
+    Real Q_expected = pi<Real>()*ln_two<Real>()/8 + catalan<Real>()*half<Real>();
+    BOOST_CHECK_CLOSE_FRACTION(Q, Q_expected, tol);
+    BOOST_CHECK_CLOSE_FRACTION(L1, Q_expected, tol);
+    BOOST_CHECK_LE(fabs(error / Q), get_termination_condition<Real>());
+    BOOST_CHECK_GE(fabs(error), fabs(Q - Q_expected));
+
+    // Endpoint singularity, needs lots of refinement near the origin:
+    auto f5 = [](Real t)->Real { return t*t*log(t)/((t*t - 1)*(t*t*t*t + 1)); };
+    Q = integrator.integrate(f5, (Real) 0, (Real) 1, 25, get_termination_condition<Real>(), &error);
+    Q_expected = pi<Real>()*pi<Real>()*(2 - root_two<Real>())/32;
+    BOOST_CHECK_CLOSE_FRACTION(Q, Q_expected, 100 * tol);
+}
+
+template<class Real, unsigned Points>
+void test_infinite_limits(const parallel_gauss_kronrod<Real, Points>& integrator)
+{
+    std::cout << "Testing infinite limits with parallel_gauss_kronrod on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    Real tol = boost::math::tools::epsilon<Real>() * 10;
+    Real Q;
+    Real L1;
+    Real error;
+
+    auto f1 = [](const Real& t) { return 1/(1+t*t);};
+    Q = integrator.integrate(f1, -boost::math::tools::max_value<Real>(), boost::math::tools::max_value<Real>(), 15, get_termination_condition<Real>(), &error, &L1);
+    BOOST_CHECK_CLOSE_FRACTION(Q, pi<Real>(), tol);
+    BOOST_CHECK_CLOSE_FRACTION(L1, pi<Real>(), tol);
+    BOOST_CHECK_LE(fabs(error / Q), get_termination_condition<Real>());
+
+    auto f4 = [](const Real& t) { return 1/cosh(t);};
+    Q = integrator.integrate(f4, -boost::math::tools::max_value<Real>(), boost::math::tools::max_value<Real>(), 15, get_termination_condition<Real>(), &error, &L1);
+    BOOST_CHECK_CLOSE_FRACTION(Q, pi<Real>(), tol);
+
+    Q = integrator.integrate(f1, (Real) 1, boost::math::tools::max_value<Real>(), 15, get_termination_condition<Real>(), &error, &L1);
+    BOOST_CHECK_CLOSE(Q, pi<Real>()/4, 100*tol);
+    BOOST_CHECK_LE(fabs(error / Q), get_termination_condition<Real>());
+
+    Q = integrator.integrate(f1, -boost::math::tools::max_value<Real>(), (Real) 0);
+    BOOST_CHECK_CLOSE(Q, half_pi<Real>(), 300*tol);
+}
+
+template<class Real, unsigned Points>
+void test_all(const parallel_gauss_kronrod<Real, Points>& integrator)
+{
+    test_linear_and_quadratic(integrator);
+    test_ca(integrator);
+    test_infinite_limits(integrator);
+}
+
+template<class Real, unsigned Points>
+void test_determinism()
+{
+    std::cout << "Testing that deterministic parallel_gauss_kronrod does not depend on the thread count on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    // Lots of kinks, so we refine a good many intervals:
+    auto f = [](const Real& x)->Real
+    {
+       Real r = 0;
+       for (int i = 1; i < 20; ++i)
+          r += abs(x - Real(i) / 20) * i;
+       return sqrt(r);
+    };
+    Real error1, L1_1;
+    Real Q1 = parallel_gauss_kronrod<Real, Points>(1, true, 8).integrate(f, (Real) 0, (Real) 1, 20, get_termination_condition<Real>(), &error1, &L1_1);
+    for (unsigned threads = 2; threads <= 8; threads *= 2)
+    {
+       Real error, L1;
+       Real Q = parallel_gauss_kronrod<Real, Points>(threads, true, 8).integrate(f, (Real) 0, (Real) 1, 20, get_termination_condition<Real>(), &error, &L1);
+       BOOST_CHECK_EQUAL(Q, Q1);
+       BOOST_CHECK_EQUAL(error, error1);
+       BOOST_CHECK_EQUAL(L1, L1_1);
+    }
+    // The asynchronous version gets the same answer to within the error estimate:
+    Real Q = parallel_gauss_kronrod<Real, Points>(4, false).integrate(f, (Real) 0, (Real) 1, 20, get_termination_condition<Real>());
+    BOOST_CHECK_LE(abs(Q - Q1), 2 * error1);
+    // With a batch size of one we refine in exactly the same order as the serial global driver:
+    Real error_serial, L1_serial;
+    Real Q_serial = gauss_kronrod<Real, Points>::integrate_global(f, (Real) 0, (Real) 1, 20, get_termination_condition<Real>(), &error_serial, &L1_serial, 100000);
+    Q = parallel_gauss_kronrod<Real, Points>(4, true, 1).integrate(f, (Real) 0, (Real) 1, 20, get_termination_condition<Real>(), &error1, &L1_1);
+    BOOST_CHECK_EQUAL(Q, Q_serial);
+    BOOST_CHECK_EQUAL(error1, error_serial);
+    BOOST_CHECK_EQUAL(L1_1, L1_serial);
+}
+
+template<class Real, unsigned Points>
+void test_exceptions()
+{
+    std::cout << "Testing exceptions are propagated from parallel_gauss_kronrod workers on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    //
+    // The integrand has a singularity at 1/3, so the refinement homes in on it, but none of the nodes
+    // come within 10^-3 of it until the interval around it has been bisected several times.  Only
+    // the helper threads throw there, so the exception caught below must have come from one of them.
+    // The calling thread is slowed down there instead, so that the helpers get a share of that work:
+    //
+    const std::thread::id caller = std::this_thread::get_id();
+    auto f = [caller](const Real& x)->Real
+    {
+       Real d = abs(x - third<Real>());
+       if (d < Real(1e-3))
+       {
+          if (std::this_thread::get_id() != caller)
+             throw std::domain_error("Thrown from a worker");
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+       }
+       return 1 / sqrt(d);
+    };
+    for (bool deterministic : { true, false })
+    {
+       parallel_gauss_kronrod<Real, Points> integrator(4, deterministic);
+       bool caught = false;
+       try
+       {
+          integrator.integrate(f, (Real) 0, (Real) 1);
+       }
+       catch (const std::domain_error& e)
+       {
+          caught = true;
+          BOOST_CHECK_EQUAL(std::string(e.what()), std::string("Thrown from a worker"));
+       }
+       BOOST_CHECK(caught);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parallel_gauss_kronrod_test)
+{
+#ifdef TEST1
+    test_all(parallel_gauss_kronrod<double, 15>(1));
+    test_all(parallel_gauss_kronrod<double, 15>(4));
+    test_all(parallel_gauss_kronrod<double, 15>(4, false));
+    test_all(parallel_gauss_kronrod<double, 31>(3, true, 5));
+    test_determinism<double, 15>();
+    test_determinism<double, 21>();
+    test_exceptions<double, 15>();
+#endif
+#ifdef TEST2
+    test_all(parallel_gauss_kronrod<cpp_bin_float_quad, 31>(4));
+    test_all(parallel_gauss_kronrod<cpp_bin_float_quad, 31>(4, false));
+    test_determinism<cpp_bin_float_quad, 31>();
+#endif
+}
+
+#else
+
+int main() { return 0; }
+
+#endif
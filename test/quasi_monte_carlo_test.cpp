@@ -0,0 +1,183 @@
+/*
+ * Copyright The Boost.Math contributors, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#define BOOST_TEST_MODULE quasi_monte_carlo_test
+#include <cmath>
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+#include <boost/lexical_cast.hpp>
+#include <boost/type_index.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/quasi_monte_carlo.hpp>
+
+using std::abs;
+using std::vector;
+using std::pair;
+using boost::math::constants::pi;
+using boost::math::constants::half_pi;
+using boost::math::quadrature::quasi_monte_carlo;
+using boost::math::quadrature::low_discrepancy_sequence;
+
+template<class Real>
+void test_product(low_discrepancy_sequence sequence, uint64_t dimension, uint64_t threads)
+{
+    std::cout << "Testing that a product of sines in " << dimension << " dimensions is integrated correctly by quasi-Monte Carlo on "
+              << threads << " threads on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using std::sin;
+    auto g = [](std::vector<Real> const & x)->Real
+    {
+        Real y = 1;
+        for (uint64_t i = 0; i < x.size(); ++i)
+        {
+            y *= half_pi<Real>()*sin(pi<Real>()*x[i]);
+        }
+        return y;
+    };
+    vector<pair<Real, Real>> bounds(dimension, pair<Real, Real>(Real(0), Real(1)));
+    Real error_goal = (Real) 0.0001;
+    quasi_monte_carlo<Real, decltype(g)> qmc(g, bounds, error_goal, sequence, 16, threads, 8923);
+    auto task = qmc.integrate();
+    Real y = task.get();
+    BOOST_CHECK_LE(qmc.current_error_estimate(), error_goal);
+    // The error estimate is statistical, so allow a generous margin:
+    BOOST_CHECK_LE(abs(y - 1), 10*error_goal);
+    BOOST_CHECK_EQUAL(qmc.calls() % (16*1024), 0u);
+    //
+    // The variance of the integrand is (pi^2/8)^d - 1, so Monte Carlo would need that over the
+    // error goal squared evaluations, which is several times more than we should need:
+    //
+    using std::pow;
+    Real monte_carlo_calls = (pow(pi<Real>()*pi<Real>()/8, Real(dimension)) - 1)/(error_goal*error_goal);
+    BOOST_CHECK_LE(Real(qmc.calls()), monte_carlo_calls/4);
+}
+
+template<class Real>
+void test_constant()
+{
+    std::cout << "Testing constants are integrated correctly using quasi-Monte Carlo on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    auto g = [](std::vector<Real> const &)->Real
+    {
+      return 1;
+    };
+
+    std::vector<std::pair<Real, Real>> bounds{{Real(0), Real(1)}, { Real(0), Real(2)}};
+    quasi_monte_carlo<Real, decltype(g)> qmc(g, bounds, (Real) 0.0001, low_discrepancy_sequence::halton, 8, 1, 87);
+
+    auto task = qmc.integrate();
+    Real two = task.get();
+    BOOST_CHECK_CLOSE_FRACTION(two, 2, 2*std::numeric_limits<Real>::epsilon());
+    BOOST_CHECK_SMALL(qmc.current_error_estimate(), 4*std::numeric_limits<Real>::epsilon());
+    BOOST_CHECK_EQUAL(qmc.replicates(), 8u);
+}
+
+template<class Real>
+void test_randomized_points_are_interior(low_discrepancy_sequence sequence)
+{
+    std::cout << "Testing that randomized quasi-Monte Carlo points lie strictly inside the unit cube on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using boost::math::quadrature::detail::qmc_point_generator;
+    qmc_point_generator<Real> generator(sequence, 2);
+    std::vector<Real> x(2);
+    // The first Sobol point is 1/2 in every dimension, the bit pattern 100...0, so these shifts take
+    // it to the last and the first cells of the cube.  They are the extremes for the Halton points too:
+    const std::uint64_t top = std::uint64_t(1) << 63;
+    const std::uint64_t shifts[] = { ~top, ~top, top, top, ~std::uint64_t(0), ~std::uint64_t(0), 0, 0 };
+    for (uint64_t index = 0; index < 64; ++index)
+    {
+        generator.seek(index);
+        generator.next();
+        for (std::size_t k = 0; k < 4; ++k)
+        {
+            generator.randomized_point(&shifts[2*k], x);
+            for (std::size_t i = 0; i < x.size(); ++i)
+            {
+                BOOST_CHECK_GT(x[i], Real(0));
+                BOOST_CHECK_LT(x[i], Real(1));
+            }
+        }
+    }
+}
+
+template<class Real>
+void test_exception_from_integrand()
+{
+    std::cout << "Testing that exceptions are propagated from the quasi-Monte Carlo integrator on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    auto g = [](std::vector<Real> const & x)->Real
+    {
+        if (x[0] > 0.5 && x[0] < 0.5001)
+        {
+            throw std::domain_error("You have done something wrong.\n");
+        }
+        return (Real) 1;
+    };
+
+    std::vector<std::pair<Real, Real>> bounds{{ Real(0), Real(1)}, { Real(0), Real(1)}};
+    quasi_monte_carlo<Real, decltype(g)> qmc(g, bounds, (Real) 0.0001);
+    auto task = qmc.integrate();
+    BOOST_CHECK_THROW(task.get(), std::domain_error);
+
+    // Infinite bounds are not supported:
+    bounds[1].second = std::numeric_limits<Real>::infinity();
+    typedef quasi_monte_carlo<Real, decltype(g)> qmc_type;
+    BOOST_CHECK_THROW(qmc_type(g, bounds, (Real) 0.0001), std::domain_error);
+}
+
+template<class Real>
+void test_cancel_and_restart(low_discrepancy_sequence sequence)
+{
+    std::cout << "Testing that cancellation and restarting works on quasi-Monte Carlo integration on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using std::exp;
+    // exp(-x.x) over [0,1]^3:
+    Real exact = boost::lexical_cast<Real>("0.41653838588663326581353965522362");
+    auto g = [&](std::vector<Real> const & x)->Real
+    {
+        return exp(-x[0]*x[0] - x[1]*x[1] - x[2]*x[2]);
+    };
+    vector<pair<Real, Real>> bounds{{ Real(0), Real(1)}, { Real(0), Real(1)}, { Real(0), Real(1)}};
+    quasi_monte_carlo<Real, decltype(g)> qmc(g, bounds, (Real) 1e-7, sequence, 16, 2, 888889);
+
+    auto task = qmc.integrate();
+    qmc.cancel();
+    Real y = task.get();
+    BOOST_CHECK_CLOSE_FRACTION(y, exact, 0.01);
+
+    qmc.update_target_error((Real) 1e-6);
+    task = qmc.integrate();
+    y = task.get();
+    BOOST_CHECK_LE(qmc.current_error_estimate(), 1e-6);
+    BOOST_CHECK_LE(abs(y - exact), 1e-5);
+}
+
+BOOST_AUTO_TEST_CASE(quasi_monte_carlo_test)
+{
+#if !defined(TEST) || TEST == 1
+    test_product<double>(low_discrepancy_sequence::sobol, 2, 1);
+    test_product<double>(low_discrepancy_sequence::sobol, 5, 2);
+    test_product<double>(low_discrepancy_sequence::halton, 3, 2);
+#endif
+#if !defined(TEST) || TEST == 2
+    test_product<float>(low_discrepancy_sequence::sobol, 3, 2);
+    test_product<long double>(low_discrepancy_sequence::halton, 2, 1);
+    test_product<double>(low_discrepancy_sequence::sobol, 8, 4);
+#endif
+#if !defined(TEST) || TEST == 3
+    test_constant<double>();
+    test_constant<float>();
+    test_exception_from_integrand<double>();
+    test_randomized_points_are_interior<float>(low_discrepancy_sequence::sobol);
+    test_randomized_points_are_interior<double>(low_discrepancy_sequence::sobol);
+    test_randomized_points_are_interior<long double>(low_discrepancy_sequence::sobol);
+    test_randomized_points_are_interior<double>(low_discrepancy_sequence::halton);
+    test_randomized_points_are_interior<long double>(low_discrepancy_sequence::halton);
+#endif
+#if !defined(TEST) || TEST == 4
+    test_cancel_and_restart<double>(low_discrepancy_sequence::sobol);
+    test_cancel_and_restart<double>(low_discrepancy_sequence::halton);
+#endif
+}
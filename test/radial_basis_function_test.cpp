@@ -0,0 +1,263 @@
+/*
+ * Copyright The Boost.Math contributors, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <array>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <boost/math/interpolators/radial_basis_function.hpp>
+
+using boost::math::interpolators::radial_basis_function;
+using boost::math::interpolators::thin_plate_spline;
+using boost::math::interpolators::multiquadric;
+using boost::math::interpolators::wendland_c2;
+
+template<class Real, size_t dimension>
+std::vector<std::array<Real, dimension>> random_points(size_t n, unsigned seed)
+{
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<Real> dis(0, 1);
+    std::vector<std::array<Real, dimension>> points(n);
+    for (auto& p : points)
+    {
+        for (auto& t : p)
+        {
+            t = dis(gen);
+        }
+    }
+    return points;
+}
+
+template<class Real>
+void test_kd_tree()
+{
+    auto points = random_points<Real, 3>(2000, 3);
+    auto tree = boost::math::interpolators::detail::kd_tree<Real>(points);
+    CHECK_EQUAL(size_t(2000), tree.size());
+    auto queries = random_points<Real, 3>(50, 4);
+    for (auto const & x : queries)
+    {
+        Real radius = Real(0.15);
+        std::vector<size_t> found;
+        tree.for_each_within(x, radius, [&](size_t i, Real r2) {
+            found.push_back(tree.original_index(i));
+            Real s = 0;
+            for (size_t a = 0; a < 3; ++a)
+            {
+                s += (x[a] - tree.point(i)[a])*(x[a] - tree.point(i)[a]);
+            }
+            CHECK_ULP_CLOSE(s, r2, 0);
+        });
+        std::vector<size_t> expected;
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            Real s = 0;
+            for (size_t a = 0; a < 3; ++a)
+            {
+                s += (x[a] - points[i][a])*(x[a] - points[i][a]);
+            }
+            if (s <= radius*radius)
+            {
+                expected.push_back(i);
+            }
+        }
+        std::sort(found.begin(), found.end());
+        CHECK_EQUAL(expected.size(), found.size());
+        CHECK_EQUAL(true, expected == found);
+    }
+}
+
+// More axes than fit in a byte, with the points spread out along the last:
+template<class Real>
+void test_kd_tree_high_dimension()
+{
+    size_t d = 300;
+    std::mt19937_64 gen(5);
+    std::uniform_real_distribution<Real> dis(0, 1);
+    std::vector<std::vector<Real>> points(200, std::vector<Real>(d));
+    for (auto& p : points)
+    {
+        for (size_t a = 0; a < d; ++a)
+        {
+            p[a] = (a == d - 1 ? 100 : Real(1)/100)*dis(gen);
+        }
+    }
+    auto tree = boost::math::interpolators::detail::kd_tree<Real>(points);
+    for (size_t i = 0; i < points.size(); i += 7)
+    {
+        std::vector<size_t> found;
+        tree.for_each_within(points[i], Real(1), [&](size_t j, Real) { found.push_back(tree.original_index(j)); });
+        std::vector<size_t> expected;
+        for (size_t j = 0; j < points.size(); ++j)
+        {
+            Real s = 0;
+            for (size_t a = 0; a < d; ++a)
+            {
+                s += (points[i][a] - points[j][a])*(points[i][a] - points[j][a]);
+            }
+            if (s <= 1)
+            {
+                expected.push_back(j);
+            }
+        }
+        std::sort(found.begin(), found.end());
+        CHECK_EQUAL(true, expected == found);
+    }
+}
+
+template<class Real, class Kernel>
+void test_interpolation_condition(Kernel kernel, Real tol)
+{
+    auto points = random_points<Real, 2>(300, 7);
+    std::vector<Real> values(points.size());
+    std::mt19937_64 gen(8);
+    std::uniform_real_distribution<Real> dis(-1, 1);
+    for (auto& v : values)
+    {
+        v = dis(gen);
+    }
+    auto s = radial_basis_function(points, values, kernel);
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        CHECK_ABSOLUTE_ERROR(values[i], s(points[i]), tol);
+    }
+}
+
+template<class Real>
+void test_polynomial_reproduction()
+{
+    using std::abs;
+    auto points = random_points<Real, 2>(100, 9);
+    std::vector<Real> values(points.size());
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        values[i] = 1 + 2*points[i][0] - 3*points[i][1];
+    }
+    // The thin plate spline reproduces linear functions:
+    auto s = radial_basis_function(points, values);
+    auto queries = random_points<Real, 2>(100, 10);
+    for (auto const & x : queries)
+    {
+        Real expected = 1 + 2*x[0] - 3*x[1];
+        CHECK_ABSOLUTE_ERROR(expected, s(x), 1e5*std::numeric_limits<Real>::epsilon());
+    }
+
+    // The multiquadric reproduces constants:
+    std::fill(values.begin(), values.end(), Real(7));
+    auto mq = radial_basis_function(points, values, multiquadric<Real>(Real(0.25)));
+    for (auto const & x : queries)
+    {
+        CHECK_ABSOLUTE_ERROR(Real(7), mq(x), 1e5*std::numeric_limits<Real>::epsilon());
+    }
+}
+
+template<class Real>
+void test_compact_support()
+{
+    using std::cbrt;
+    size_t n = 20000;
+    auto points = random_points<Real, 3>(n, 11);
+    std::vector<Real> values(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        values[i] = points[i][0]*points[i][1] + points[i][2];
+    }
+    // About 30 points within the support of each:
+    Real radius = cbrt(Real(30)/(4*n));
+    auto s = radial_basis_function(points, values, wendland_c2<Real>(radius));
+    for (size_t i = 0; i < n; i += 97)
+    {
+        CHECK_ABSOLUTE_ERROR(values[i], s(points[i]), 1e-10);
+    }
+
+    // Far from every point, the interpolant vanishes:
+    std::array<Real, 3> far{5, 5, 5};
+    CHECK_EQUAL(Real(0), s(far));
+
+    auto queries = random_points<Real, 3>(500, 12);
+    std::vector<Real> y(queries.size());
+    s.evaluate(queries, y);
+    for (size_t i = 0; i < queries.size(); ++i)
+    {
+        CHECK_EQUAL(s(queries[i]), y[i]);
+    }
+}
+
+template<class Real>
+void test_errors()
+{
+    auto points = random_points<Real, 2>(10, 13);
+    bool caught = false;
+    try
+    {
+        auto s = radial_basis_function(points, std::vector<Real>(9));
+    }
+    catch (const std::domain_error&)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+
+    // A repeated point makes the interpolation problem singular:
+    points[3] = points[4];
+    caught = false;
+    try
+    {
+        auto s = radial_basis_function(points, std::vector<Real>(10, Real(1)));
+    }
+    catch (const std::domain_error&)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+
+    caught = false;
+    try
+    {
+        auto k = wendland_c2<Real>(Real(-1));
+        CHECK_EQUAL(Real(0), k(Real(2)));
+    }
+    catch (const std::domain_error&)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+
+    // Wendland's function is not positive definite in four dimensions:
+    caught = false;
+    try
+    {
+        auto p4 = random_points<Real, 4>(50, 14);
+        auto s = radial_basis_function(p4, std::vector<Real>(50, Real(1)), wendland_c2<Real>(Real(0.5)));
+    }
+    catch (const std::domain_error&)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+}
+
+int main()
+{
+    test_kd_tree<double>();
+    test_kd_tree_high_dimension<double>();
+
+    test_interpolation_condition<double>(thin_plate_spline<double>(), 1e-10);
+    // The multiquadric interpolation matrix is notoriously ill-conditioned, and the weights are large and of both signs:
+    test_interpolation_condition<double>(multiquadric<double>(0.1), 1e-6);
+    test_interpolation_condition<double>(wendland_c2<double>(0.2), 1e-10);
+    test_interpolation_condition<long double>(thin_plate_spline<long double>(), 1e-12L);
+
+    test_polynomial_reproduction<double>();
+
+    test_compact_support<double>();
+
+    test_errors<double>();
+
+    return boost::math::test::report_errors();
+}
@@ -8,6 +8,7 @@
 #include "math_unit_test.hpp"
 #include <numeric>
 #include <utility>
+#include <vector>
 #include <array>
 #include <boost/random/uniform_real.hpp>
 #include <boost/random/mersenne_twister.hpp>
@@ -494,6 +495,157 @@ void test_interpolation_condition()
 }
 
 
+template<typename Real>
+void test_cursor()
+{
+    boost::random::mt19937 rd;
+    boost::random::uniform_real_distribution<Real> dis(0,1);
+    size_t n = 200;
+    std::vector<Real> x(n);
+    std::vector<Real> y(n);
+    std::vector<Real> dydx(n);
+    std::vector<Real> d2ydx2(n);
+    std::vector<Real> d3ydx3(n);
+    x[0] = dis(rd);
+    for (size_t i = 1; i < n; ++i) {
+        x[i] = x[i-1] + dis(rd) + Real(1)/128;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        y[i] = dis(rd);
+        dydx[i] = dis(rd);
+        d2ydx2[i] = dis(rd);
+        d3ydx3[i] = dis(rd);
+    }
+    // The knots, then sorted points, then the same points in reverse, then random points:
+    std::vector<Real> queries(x.begin(), x.end());
+    for (size_t i = 0; i < 4*n; ++i) {
+        queries.push_back(x[0] + (x[n-1] - x[0])*Real(i)/Real(4*n));
+    }
+    for (size_t i = 0; i < 4*n; ++i) {
+        queries.push_back(queries[queries.size() - 1 - 2*i]);
+    }
+    for (size_t i = 0; i < 4*n; ++i) {
+        queries.push_back(x[0] + (x[n-1] - x[0])*dis(rd));
+    }
+
+    auto s = septic_hermite(std::move(x), std::move(y), std::move(dydx), std::move(d2ydx2), std::move(d3ydx3));
+    boost::math::interpolators::interval_cursor cursor;
+    for (auto t : queries) {
+        CHECK_EQUAL(s(t, cursor), s(t));
+        CHECK_EQUAL(s.prime(t, cursor), s.prime(t));
+    }
+    std::vector<Real> expected(queries.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+        expected[i] = s(queries[i]);
+    }
+    s.build_search_index();
+    for (size_t i = 0; i < queries.size(); ++i) {
+        CHECK_EQUAL(s(queries[i]), expected[i]);
+    }
+}
+
+template<typename Real>
+void test_batch()
+{
+    boost::random::mt19937 rd;
+    boost::random::uniform_real_distribution<Real> dis(0,1);
+    size_t n = 200;
+    std::vector<Real> x(n);
+    std::vector<Real> y(n);
+    std::vector<Real> dydx(n);
+    std::vector<Real> d2ydx2(n);
+    std::vector<Real> d3ydx3(n);
+    x[0] = dis(rd);
+    for (size_t i = 1; i < n; ++i) {
+        x[i] = x[i-1] + dis(rd) + Real(1)/128;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        y[i] = dis(rd);
+        dydx[i] = dis(rd);
+        d2ydx2[i] = dis(rd);
+        d3ydx3[i] = dis(rd);
+    }
+    // Sorted points including both endpoints, then random points, then the right endpoint again:
+    Real a = x[0];
+    Real b = x[n-1];
+    std::vector<Real> queries;
+    for (size_t i = 0; i <= 4*n; ++i) {
+        queries.push_back(a + (b - a)*Real(i)/Real(4*n));
+    }
+    queries.back() = b;
+    for (size_t i = 0; i < 4*n; ++i) {
+        queries.push_back(a + (b - a)*dis(rd));
+    }
+    queries.push_back(b);
+
+    std::vector<Real> cy(y), cdydx(dydx), cd2ydx2(d2ydx2), cd3ydx3(d3ydx3);
+    std::vector<std::array<Real, 4>> data(n);
+    for (size_t i = 0; i < n; ++i) {
+        data[i] = {y[i], dydx[i], d2ydx2[i], d3ydx3[i]};
+    }
+
+    auto s = septic_hermite(std::move(x), std::move(y), std::move(dydx), std::move(d2ydx2), std::move(d3ydx3));
+    std::vector<Real> values(queries.size());
+    std::vector<Real> derivatives(queries.size());
+    std::vector<Real> second_derivatives(queries.size());
+    s.evaluate(queries, values);
+    s.evaluate_prime(queries, derivatives);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        CHECK_EQUAL(values[i], s(queries[i]));
+        CHECK_EQUAL(derivatives[i], s.prime(queries[i]));
+    }
+
+    Real x0 = dis(rd);
+    Real dx = Real(1)/8;
+    auto cs = cardinal_septic_hermite(std::move(cy), std::move(cdydx), std::move(cd2ydx2), std::move(cd3ydx3), x0, dx);
+    auto cs_aos = cardinal_septic_hermite_aos(std::move(data), x0, dx);
+    queries.clear();
+    for (size_t i = 0; i < 4*n; ++i) {
+        queries.push_back(x0 + (n-1)*dx*dis(rd));
+    }
+    queries.push_back(x0);
+    queries.push_back(cs.domain().second);
+    values.resize(queries.size());
+    derivatives.resize(queries.size());
+    second_derivatives.resize(queries.size());
+    cs.evaluate(queries, values);
+    cs.evaluate_prime(queries, derivatives);
+    cs.evaluate_double_prime(queries, second_derivatives);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        CHECK_EQUAL(values[i], cs(queries[i]));
+        CHECK_EQUAL(derivatives[i], cs.prime(queries[i]));
+        CHECK_EQUAL(second_derivatives[i], cs.double_prime(queries[i]));
+    }
+    cs_aos.evaluate(queries, values);
+    cs_aos.evaluate_prime(queries, derivatives);
+    cs_aos.evaluate_double_prime(queries, second_derivatives);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        CHECK_EQUAL(values[i], cs_aos(queries[i]));
+        CHECK_EQUAL(derivatives[i], cs_aos.prime(queries[i]));
+        CHECK_EQUAL(second_derivatives[i], cs_aos.double_prime(queries[i]));
+    }
+
+    queries.push_back(cs.domain().second + 1);
+    values.resize(queries.size());
+    bool caught = false;
+    try {
+        cs.evaluate(queries, values);
+    }
+    catch (std::domain_error const &) {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+    queries.back() = s.domain().second + 1;
+    caught = false;
+    try {
+        s.evaluate(queries, values);
+    }
+    catch (std::domain_error const &) {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+}
+
 int main()
 {
     test_constant<float>();
@@ -502,6 +654,8 @@ int main()
     test_cubic<float>();
     test_quartic<float>();
     test_interpolation_condition<float>();
+    test_cursor<float>();
+    test_batch<float>();
 
     test_constant<double>();
     test_linear<double>();
@@ -509,6 +663,8 @@ int main()
     test_cubic<double>();
     test_quartic<double>();
     test_interpolation_condition<double>();
+    test_cursor<double>();
+    test_batch<double>();
 
     test_constant<long double>();
     test_linear<long double>();
@@ -516,6 +672,8 @@ int main()
     test_cubic<long double>();
     test_quartic<long double>();
     test_interpolation_condition<long double>();
+    test_cursor<long double>();
+    test_batch<long double>();
 
 #ifdef BOOST_HAS_FLOAT128
     test_constant<float128>();
@@ -6,6 +6,7 @@
 
 #define BOOST_TEST_MODULE sinh_sinh_quadrature_test
 #include <complex>
+#include <thread>
 #include <boost/multiprecision/cpp_complex.hpp>
 #include <boost/math/concepts/real_concept.hpp>
 #include <boost/test/included/unit_test.hpp>
@@ -40,6 +41,7 @@ using std::pow;
 using std::string;
 using boost::multiprecision::cpp_bin_float_quad;
 using boost::math::quadrature::sinh_sinh;
+using boost::math::quadrature::quadrature_statistics;
 using boost::math::constants::pi;
 using boost::math::constants::pi_sqr;
 using boost::math::constants::half_pi;
@@ -261,6 +263,74 @@ void test_dirichlet_eta()
 }
 
 
+template<class Real>
+void test_shared_tables()
+{
+    std::cout << "Testing shared tables on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    Real integration_limit = sqrt(boost::math::tools::epsilon<Real>());
+    auto f = [](const Real& t)->Real { return 1/(1+t*t); };
+    sinh_sinh<Real> integrator(10);
+    Real error, L1;
+    std::size_t levels;
+    Real Q = integrator.integrate(f, integration_limit, &error, &L1, &levels);
+    sinh_sinh<Real> shared1 = sinh_sinh<Real>::shared(10);
+    sinh_sinh<Real> shared2 = sinh_sinh<Real>::shared(10);
+    for (sinh_sinh<Real>* p : { &shared1, &shared2 })
+    {
+        Real error_shared, L1_shared;
+        std::size_t levels_shared;
+        Real Q_shared = p->integrate(f, integration_limit, &error_shared, &L1_shared, &levels_shared);
+        BOOST_CHECK_EQUAL(Q_shared, Q);
+        BOOST_CHECK_EQUAL(error_shared, error);
+        BOOST_CHECK_EQUAL(L1_shared, L1);
+        BOOST_CHECK_EQUAL(levels_shared, levels);
+    }
+}
+
+template<class Real>
+void test_concurrent_refinement()
+{
+    std::cout << "Testing concurrent refinement on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    // No precomputed tables for Real, so the threads race to build the rows past the first few:
+    const auto f = [](const Real& t)->Real { return exp(-t*t); };
+    sinh_sinh<Real> reference;
+    Real Q = reference.integrate(f);
+    for (unsigned trial = 0; trial < 4; ++trial)
+    {
+        sinh_sinh<Real> integrator;
+        std::vector<Real> results(4);
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < results.size(); ++i)
+            threads.emplace_back([&, i]() { results[i] = integrator.integrate(f); });
+        for (std::thread& t : threads)
+            t.join();
+        for (const Real& r : results)
+            BOOST_CHECK_EQUAL(r, Q);
+    }
+}
+
+template<class Real>
+void test_statistics()
+{
+    std::cout << "Testing integration statistics on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    Real integration_limit = sqrt(boost::math::tools::epsilon<Real>());
+    std::size_t calls = 0;
+    auto f = [&](const Real& t)->Real { ++calls; return 1/(1+t*t); };
+    sinh_sinh<Real> integrator(10);
+    Real error, L1;
+    std::size_t levels;
+    quadrature_statistics<Real> stats;
+    Real Q = integrator.integrate(f, integration_limit, &error, &L1, &levels, &stats);
+    BOOST_CHECK_CLOSE_FRACTION(Q, boost::math::constants::pi<Real>(), integration_limit);
+    BOOST_CHECK_EQUAL(stats.evaluations, calls);
+    BOOST_CHECK_EQUAL(stats.levels, levels);
+    BOOST_CHECK_EQUAL(stats.intervals, 1u);
+    BOOST_REQUIRE(!stats.errors.empty());
+    BOOST_CHECK_LE(stats.errors.size(), levels);
+    BOOST_CHECK_EQUAL(stats.errors.back(), error);
+    BOOST_CHECK_GE(stats.elapsed.count(), 0);
+}
+
 BOOST_AUTO_TEST_CASE(sinh_sinh_quadrature_test)
 {
     //
@@ -289,6 +359,15 @@ BOOST_AUTO_TEST_CASE(sinh_sinh_quadrature_test)
 
     test_crc<float>();
     test_crc<double>();
+    test_shared_tables<float>();
+    test_statistics<float>();
+    test_shared_tables<double>();
+    test_statistics<double>();
+    test_shared_tables<cpp_bin_float_quad>();
+    test_statistics<cpp_bin_float_quad>();
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+    test_concurrent_refinement<boost::multiprecision::cpp_bin_float_50>();
+#endif
     test_dirichlet_eta<std::complex<double>>();
 #ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
     test_crc<long double>();
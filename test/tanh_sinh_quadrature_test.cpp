@@ -6,6 +6,9 @@
 
 #define BOOST_TEST_MODULE tanh_sinh_quadrature_test
 
+#include <array>
+#include <vector>
+#include <thread>
 #include <boost/config.hpp>
 #include <boost/detail/workaround.hpp>
 
@@ -21,6 +24,7 @@
 #include <boost/math/special_functions/next.hpp>
 #include <boost/math/special_functions/gamma.hpp>
 #include <boost/math/special_functions/beta.hpp>
+#include <boost/math/special_functions/erf.hpp>
 #include <boost/math/special_functions/ellint_rc.hpp>
 #include <boost/math/special_functions/ellint_rj.hpp>
 
@@ -75,6 +79,7 @@ using boost::multiprecision::cpp_dec_float_100;
 using boost::multiprecision::cpp_bin_float_quad;
 using boost::math::sinc_pi;
 using boost::math::quadrature::tanh_sinh;
+using boost::math::quadrature::quadrature_statistics;
 using boost::math::quadrature::detail::tanh_sinh_detail;
 using boost::math::constants::pi;
 using boost::math::constants::half_pi;
@@ -795,6 +800,292 @@ void test_2_arg()
    BOOST_CHECK_CLOSE_FRACTION(L1, -Q_expected, tol);
 }
 
+template <class Real>
+void test_vectorized()
+{
+   std::cout << "Testing vectorized functors on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   Real tol = 10 * boost::math::tools::epsilon<Real>();
+   auto integrator = get_integrator<Real>();
+   std::size_t calls = 0;
+
+   auto f = [&](const Real* x, Real* y, std::size_t n)
+   {
+      ++calls;
+      for (std::size_t i = 0; i < n; ++i)
+         y[i] = log(x[i])*log(1 - x[i]);
+   };
+   Real error, L1;
+   std::size_t levels;
+   Real Q = integrator.integrate(f, (Real)0, (Real)1, get_convergence_tolerance<Real>(), &error, &L1, &levels);
+   Real Q_expected = 2 - pi<Real>()*pi<Real>()*half<Real>()*third<Real>();
+   BOOST_CHECK_CLOSE_FRACTION(Q, Q_expected, tol);
+   BOOST_CHECK_CLOSE_FRACTION(L1, Q_expected, tol);
+   // One call for the initial row, plus one for each refinement:
+   BOOST_CHECK_EQUAL(calls, levels);
+
+   // Must agree with the scalar version:
+   Real error_scalar, L1_scalar;
+   std::size_t levels_scalar;
+   Real Q_scalar = integrator.integrate([](const Real& x) { return log(x)*log(1 - x); }, (Real)0, (Real)1, get_convergence_tolerance<Real>(), &error_scalar, &L1_scalar, &levels_scalar);
+   BOOST_CHECK_CLOSE_FRACTION(Q, Q_scalar, tol);
+   BOOST_CHECK_EQUAL(levels, levels_scalar);
+
+   // The statistics count the abscissa values, not the calls, and so agree with the scalar version too:
+   std::size_t points = 0;
+   auto counted = [&](const Real* x, Real* y, std::size_t n) { points += n; f(x, y, n); };
+   quadrature_statistics<Real> stats, stats_scalar;
+   integrator.integrate(counted, (Real)0, (Real)1, get_convergence_tolerance<Real>(), &error, &L1, &levels, &stats);
+   integrator.integrate([](const Real& x) { return log(x)*log(1 - x); }, (Real)0, (Real)1, get_convergence_tolerance<Real>(), &error_scalar, &L1_scalar, &levels_scalar, &stats_scalar);
+   BOOST_CHECK_EQUAL(stats.evaluations, points);
+   BOOST_CHECK_EQUAL(stats.evaluations, stats_scalar.evaluations);
+   BOOST_CHECK_EQUAL(stats.levels, levels);
+   BOOST_CHECK_EQUAL(stats.errors.back(), error);
+
+   Q = integrator.integrate(f, (Real)1, (Real)0);
+   BOOST_CHECK_CLOSE_FRACTION(Q, -Q_expected, tol);
+
+   auto g = [](const Real* x, Real* y, std::size_t n)
+   {
+      for (std::size_t i = 0; i < n; ++i)
+         y[i] = exp(-x[i] * x[i]);
+   };
+   Real inf = std::numeric_limits<Real>::has_infinity ? std::numeric_limits<Real>::infinity() : boost::math::tools::max_value<Real>();
+   Q = integrator.integrate(g, -inf, inf);
+   BOOST_CHECK_CLOSE_FRACTION(Q, root_pi<Real>(), tol);
+   Q = integrator.integrate(g, Real(0), inf);
+   BOOST_CHECK_CLOSE_FRACTION(Q, root_pi<Real>() / 2, tol);
+   Q = integrator.integrate(g, -inf, Real(0));
+   BOOST_CHECK_CLOSE_FRACTION(Q, root_pi<Real>() / 2, tol);
+}
+
+template<class Real>
+void test_vector_valued()
+{
+   std::cout << "Testing vector valued functors on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   Real tol = 10 * boost::math::tools::epsilon<Real>();
+   auto integrator = get_integrator<Real>();
+   auto f0 = [](const Real& x)->Real { return log(x)*log(1 - x); };
+   auto f1 = [](const Real& x)->Real { return 1 / sqrt(x); };
+   std::size_t vector_calls = 0;
+   auto f = [&](const Real& x)->std::array<Real, 2>
+   {
+      ++vector_calls;
+      return {{ f0(x), f1(x) }};
+   };
+   Real error, L1;
+   std::array<Real, 2> Q = integrator.integrate(f, (Real)0, (Real)1, get_convergence_tolerance<Real>(), &error, &L1);
+   BOOST_CHECK_CLOSE_FRACTION(Q[0], 2 - pi<Real>()*pi<Real>()*half<Real>()*third<Real>(), tol);
+   BOOST_CHECK_CLOSE_FRACTION(Q[1], Real(2), tol);
+   BOOST_CHECK_GE(L1, Q[0]);
+   BOOST_CHECK_GE(L1, Q[1]);
+
+   // Each abscissa is evaluated once for both components:
+   std::size_t scalar_calls = 0;
+   auto g0 = [&](const Real& x)->Real { ++scalar_calls; return f0(x); };
+   auto g1 = [&](const Real& x)->Real { ++scalar_calls; return f1(x); };
+   integrator.integrate(g0, (Real)0, (Real)1, get_convergence_tolerance<Real>());
+   integrator.integrate(g1, (Real)0, (Real)1, get_convergence_tolerance<Real>());
+   BOOST_CHECK_LT(vector_calls, scalar_calls);
+
+   // std::vector results and infinite ranges:
+   auto h = [](const Real& x)->std::vector<Real>
+   {
+      std::vector<Real> r(2);
+      r[0] = 1 / (1 + x*x);
+      r[1] = exp(-x*x);
+      return r;
+   };
+   std::vector<Real> V = integrator.integrate(h, (Real)0, boost::math::tools::max_value<Real>(), get_convergence_tolerance<Real>());
+   BOOST_CHECK_EQUAL(V.size(), 2u);
+   BOOST_CHECK_CLOSE_FRACTION(V[0], half_pi<Real>(), 100 * tol);
+   BOOST_CHECK_CLOSE_FRACTION(V[1], root_pi<Real>() / 2, 100 * tol);
+   // The integrand is never called just to find the number of components, so an empty range gives an empty result:
+   std::size_t calls = 0;
+   auto counted = [&](const Real& x) { ++calls; return h(x); };
+   V = integrator.integrate(counted, (Real)1, (Real)1);
+   BOOST_CHECK(V.empty());
+   BOOST_CHECK_EQUAL(calls, 0u);
+}
+
+template<class Real>
+void test_shared_tables()
+{
+   std::cout << "Testing shared tables on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   auto f = [](const Real& x)->Real { return log(x)*log(1 - x); };
+   tanh_sinh<Real> integrator(15);
+   Real error, L1;
+   std::size_t levels;
+   Real Q = integrator.integrate(f, (Real)0, (Real)1, get_convergence_tolerance<Real>(), &error, &L1, &levels);
+   //
+   // Shared tables are computed eagerly, but hold exactly the same values as those computed on demand,
+   // so the results must be identical:
+   //
+   tanh_sinh<Real> shared1 = tanh_sinh<Real>::shared(15);
+   tanh_sinh<Real> shared2 = tanh_sinh<Real>::shared(15);
+   for (tanh_sinh<Real>* p : { &shared1, &shared2 })
+   {
+      Real error_shared, L1_shared;
+      std::size_t levels_shared;
+      Real Q_shared = p->integrate(f, (Real)0, (Real)1, get_convergence_tolerance<Real>(), &error_shared, &L1_shared, &levels_shared);
+      BOOST_CHECK_EQUAL(Q_shared, Q);
+      BOOST_CHECK_EQUAL(error_shared, error);
+      BOOST_CHECK_EQUAL(L1_shared, L1);
+      BOOST_CHECK_EQUAL(levels_shared, levels);
+   }
+   // A different min_complement gets a different set of tables:
+   tanh_sinh<Real> shared3 = tanh_sinh<Real>::shared(15, boost::math::tools::epsilon<Real>());
+   Q = shared3.integrate(f, (Real)0, (Real)1);
+   BOOST_CHECK_CLOSE_FRACTION(Q, 2 - pi<Real>()*pi<Real>()*half<Real>()*third<Real>(), sqrt(boost::math::tools::epsilon<Real>()));
+}
+
+template<class Real>
+void test_statistics()
+{
+   std::cout << "Testing integration statistics on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   std::size_t calls = 0;
+   auto f = [&](const Real& x)->Real { ++calls; return log(x)*log(1 - x); };
+   tanh_sinh<Real> integrator(15);
+   Real error, L1;
+   std::size_t levels;
+   quadrature_statistics<Real> stats;
+   Real Q = integrator.integrate(f, (Real)0, (Real)1, get_convergence_tolerance<Real>(), &error, &L1, &levels, &stats);
+   BOOST_CHECK_EQUAL(stats.evaluations, calls);
+   BOOST_CHECK_EQUAL(stats.levels, levels);
+   BOOST_CHECK_EQUAL(stats.intervals, 1u);
+   // One error estimate per level after the first, the last of which is the one returned
+   // (or the one before it, if the estimates started to increase):
+   BOOST_REQUIRE_GE(stats.errors.size(), levels - 1);
+   BOOST_CHECK_EQUAL(stats.errors[levels - 2], error);
+   BOOST_CHECK_GE(stats.elapsed.count(), 0);
+   // The statistics don't change the result:
+   calls = 0;
+   BOOST_CHECK_EQUAL(integrator.integrate(f, (Real)0, (Real)1, get_convergence_tolerance<Real>()), Q);
+   BOOST_CHECK_EQUAL(calls, stats.evaluations);
+
+   // The same structure may be reused, here for an infinite range:
+   auto g = [&](const Real& x)->Real { ++calls; return exp(-x*x); };
+   calls = 0;
+   Q = integrator.integrate(g, -boost::math::tools::max_value<Real>(), boost::math::tools::max_value<Real>(), get_convergence_tolerance<Real>(), &error, &L1, &levels, &stats);
+   BOOST_CHECK_CLOSE_FRACTION(Q, root_pi<Real>(), get_convergence_tolerance<Real>());
+   BOOST_CHECK_EQUAL(stats.evaluations, calls);
+   BOOST_CHECK_EQUAL(stats.levels, levels);
+   BOOST_CHECK_EQUAL(stats.errors[levels - 2], error);
+
+   // Integrands taking the distance to the nearest endpoint:
+   auto h = [&](const Real& t, const Real& tc)->Real { ++calls; return tc < 0 ? 1 / sqrt(t * (1 - t)) : 1 / sqrt(t * tc); };
+   calls = 0;
+   Q = integrator.integrate(h, (Real)0, (Real)1, get_convergence_tolerance<Real>(), &error, &L1, &levels, &stats);
+   BOOST_CHECK_EQUAL(stats.evaluations, calls);
+   BOOST_CHECK_EQUAL(stats.levels, levels);
+}
+
+template<class Real>
+void test_concurrent_refinement()
+{
+   std::cout << "Testing concurrent refinement on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   //
+   // Real has no precomputed tables, so the threads below race to build the rows past the first
+   // few, while reading the rows that another thread has already published:
+   //
+   auto f = [](const Real& x)->Real { return log(x)*log(1 - x); };
+   tanh_sinh<Real> reference;
+   Real Q = reference.integrate(f, (Real)0, (Real)1);
+   for (unsigned trial = 0; trial < 4; ++trial)
+   {
+      tanh_sinh<Real> integrator;
+      std::vector<Real> results(4);
+      std::vector<std::thread> threads;
+      for (std::size_t i = 0; i < results.size(); ++i)
+         threads.emplace_back([&, i]() { results[i] = integrator.integrate(f, (Real)0, (Real)1); });
+      for (std::thread& t : threads)
+         t.join();
+      for (const Real& r : results)
+         BOOST_CHECK_EQUAL(r, Q);
+   }
+}
+
+template<class Real>
+void test_session()
+{
+   std::cout << "Testing level by level integration on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+   std::size_t calls = 0;
+   auto f = [&](const Real& x)->Real { ++calls; return log(x)*log(1 - x); };
+   Real tol = get_convergence_tolerance<Real>();
+   tanh_sinh<Real> integrator(15);
+   Real error, L1;
+   std::size_t levels;
+   Real Q = integrator.integrate(f, (Real)0, (Real)1, tol, &error, &L1, &levels);
+   std::size_t integrate_calls = calls;
+   //
+   // Refining until converged gives exactly what integrate does, for exactly the same work:
+   //
+   calls = 0;
+   auto s = integrator.session(f, (Real)0, (Real)1);
+   BOOST_CHECK_EQUAL(s.levels(), 0u);
+   BOOST_CHECK(!s.converged(tol));
+   BOOST_CHECK(!s.done());
+   while (!s.converged(tol) && s.refine_one_level())
+   {
+      BOOST_CHECK_EQUAL(s.statistics().evaluations, calls);
+      BOOST_CHECK_EQUAL(s.statistics().levels, s.levels());
+   }
+   BOOST_CHECK_EQUAL(s.estimate(), Q);
+   // integrate reports the error estimate on (-1, 1), the session scales it to [0, 1] like the L1 norm:
+   BOOST_CHECK_EQUAL(s.error_estimate(), error / 2);
+   BOOST_CHECK_EQUAL(s.L1(), L1);
+   BOOST_CHECK_EQUAL(s.levels(), levels);
+   BOOST_CHECK_EQUAL(calls, integrate_calls);
+   BOOST_CHECK_EQUAL(s.statistics().errors.size(), levels - 1);
+   BOOST_CHECK_GE(s.statistics().elapsed.count(), 0);
+   //
+   // Several integrals refined in turn, each stopping once converged, as a scheduler might:
+   //
+   auto g = [](const Real& x)->Real { return exp(-x*x); };
+   auto h = [](const Real& x)->Real { return 1 / (1 + x*x); };
+   tanh_sinh<Real> shared = tanh_sinh<Real>::shared(15);
+   auto s1 = shared.session(g, -boost::math::tools::max_value<Real>(), boost::math::tools::max_value<Real>());
+   auto s2 = shared.session(h, (Real)0, boost::math::tools::max_value<Real>());
+   auto s3 = shared.session(h, -boost::math::tools::max_value<Real>(), (Real)0);
+   auto s4 = shared.session(h, (Real)1, (Real)0);
+   bool busy = true;
+   while (busy)
+   {
+      busy = false;
+      if (!s1.converged(tol) && s1.refine_one_level())
+         busy = true;
+      if (!s2.converged(tol) && s2.refine_one_level())
+         busy = true;
+      if (!s3.converged(tol) && s3.refine_one_level())
+         busy = true;
+      if (!s4.converged(tol) && s4.refine_one_level())
+         busy = true;
+   }
+   BOOST_CHECK_CLOSE_FRACTION(s1.estimate(), root_pi<Real>(), tol);
+   BOOST_CHECK_CLOSE_FRACTION(s2.estimate(), half_pi<Real>(), tol);
+   BOOST_CHECK_CLOSE_FRACTION(s3.estimate(), half_pi<Real>(), tol);
+   // Reversed bounds negate the integral but not its L1 norm:
+   BOOST_CHECK_CLOSE_FRACTION(s4.estimate(), -pi<Real>() / 4, tol);
+   BOOST_CHECK_CLOSE_FRACTION(s4.L1(), pi<Real>() / 4, tol);
+   BOOST_CHECK(s1.converged(tol) && s2.converged(tol) && s3.converged(tol) && s4.converged(tol));
+   //
+   // Refinement stops by itself at the maximum level:
+   //
+   auto s5 = tanh_sinh<Real>(5).session(g, (Real)0, (Real)1);
+   std::size_t n = 0;
+   while (s5.refine_one_level())
+      ++n;
+   BOOST_CHECK(s5.done());
+   BOOST_CHECK_EQUAL(n, s5.levels());
+   BOOST_CHECK_CLOSE_FRACTION(s5.estimate(), root_pi<Real>() * boost::math::erf(Real(1)) / 2, tol);
+   BOOST_CHECK(!s5.refine_one_level());
+   // An empty range is converged from the start:
+   auto s6 = integrator.session(g, (Real)2, (Real)2);
+   BOOST_CHECK(s6.converged(tol));
+   BOOST_CHECK(s6.done());
+   BOOST_CHECK_EQUAL(s6.estimate(), Real(0));
+   BOOST_CHECK_EQUAL(s6.error_estimate(), Real(0));
+}
+
 template <class Complex>
 void test_complex()
 {
@@ -866,6 +1157,10 @@ BOOST_AUTO_TEST_CASE(tanh_sinh_quadrature_test)
 #ifdef TEST1A
     test_early_termination<float>();
     test_2_arg<float>();
+    test_vectorized<float>();
+    test_vector_valued<float>();
+    test_shared_tables<float>();
+    test_session<float>();
 #endif
 #ifdef TEST1B
     test_crc<float>();
@@ -884,6 +1179,11 @@ BOOST_AUTO_TEST_CASE(tanh_sinh_quadrature_test)
     test_early_termination<double>();
     test_sf<double>();
     test_2_arg<double>();
+    test_vectorized<double>();
+    test_vector_valued<double>();
+    test_shared_tables<double>();
+    test_statistics<double>();
+    test_session<double>();
 #endif
 #ifdef TEST2A
     test_crc<double>();
@@ -905,6 +1205,9 @@ BOOST_AUTO_TEST_CASE(tanh_sinh_quadrature_test)
     test_early_termination<long double>();
     test_sf<long double>();
     test_2_arg<long double>();
+    test_vectorized<long double>();
+    test_vector_valued<long double>();
+    test_shared_tables<long double>();
 #endif
 #ifdef TEST3A
     test_crc<long double>();
@@ -926,6 +1229,14 @@ BOOST_AUTO_TEST_CASE(tanh_sinh_quadrature_test)
     test_crc<cpp_bin_float_quad>();
     test_sf<cpp_bin_float_quad>();
     test_2_arg<cpp_bin_float_quad>();
+    test_vectorized<cpp_bin_float_quad>();
+    test_vector_valued<cpp_bin_float_quad>();
+    test_shared_tables<cpp_bin_float_quad>();
+    test_statistics<cpp_bin_float_quad>();
+    test_session<cpp_bin_float_quad>();
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+    test_concurrent_refinement<cpp_bin_float_50>();
+#endif
 
 #endif
 #ifdef TEST5
@@ -252,6 +252,63 @@ void test_weights()
 
 }
 
+template<class Real>
+void test_batch()
+{
+    std::cout << "Testing batch evaluation of barycentric interpolants on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+
+    std::mt19937 gen(10);
+    boost::random::uniform_real_distribution<Real> dis(0.005, 0.01);
+    std::vector<Real> x(500);
+    std::vector<Real> y(500);
+    x[0] = -2;
+    y[0] = 1/(1+25*x[0]*x[0]);
+    for (size_t i = 1; i < x.size(); ++i)
+    {
+        x[i] = x[i-1] + dis(gen);
+        y[i] = 1/(1+25*x[i]*x[i]);
+    }
+    std::vector<Real> nodes = x;
+    boost::math::barycentric_rational<Real> interpolator(std::move(x), std::move(y), 4);
+
+    // Queries between the nodes, at the nodes, and outside the data, in no particular order:
+    std::vector<Real> t;
+    for (size_t i = 0; i + 1 < nodes.size(); i += 3)
+    {
+        t.push_back((nodes[i] + nodes[i+1])/2);
+        t.push_back(nodes[i]);
+        t.push_back(nodes[i] + (nodes[i+1] - nodes[i])/1000000);
+    }
+    t.push_back(nodes.back());
+    t.push_back(nodes.front() - 1);
+    t.push_back(nodes.back() + Real(0.5));
+    std::shuffle(t.begin(), t.end(), gen);
+
+    std::vector<Real> z(t.size());
+    std::vector<Real> dz(t.size());
+    for (unsigned threads = 1; threads <= 3; ++threads)
+    {
+        interpolator.evaluate(t, z, threads);
+        for (size_t i = 0; i < t.size(); ++i)
+        {
+            BOOST_CHECK_CLOSE_FRACTION(z[i], interpolator(t[i]), 4*std::numeric_limits<Real>::epsilon());
+        }
+        interpolator.evaluate_with_prime(t, z, dz, threads);
+        for (size_t i = 0; i < t.size(); ++i)
+        {
+            BOOST_CHECK_CLOSE_FRACTION(z[i], interpolator(t[i]), 4*std::numeric_limits<Real>::epsilon());
+            // Away from the data the sums cancel so heavily that neither formula for the derivative is accurate:
+            if (t[i] >= nodes.front() && t[i] <= nodes.back())
+            {
+                Real expected = interpolator.prime(t[i]);
+                BOOST_CHECK_SMALL(dz[i] - expected, 1000*std::numeric_limits<Real>::epsilon()*(1 + abs(expected)));
+            }
+            auto p = interpolator.eval_with_prime(t[i]);
+            BOOST_CHECK_EQUAL(p.first, z[i]);
+            BOOST_CHECK_EQUAL(p.second, dz[i]);
+        }
+    }
+}
 
 BOOST_AUTO_TEST_CASE(barycentric_rational)
 {
@@ -282,6 +339,9 @@ BOOST_AUTO_TEST_CASE(barycentric_rational)
 
     test_runge<double>();
     //test_runge<long double>();
+
+    test_batch<float>();
+    test_batch<double>();
     //test_runge<cpp_bin_float_50>();
 
 #ifdef BOOST_HAS_FLOAT128
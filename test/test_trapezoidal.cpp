@@ -22,6 +22,10 @@
 using boost::multiprecision::cpp_bin_float_50;
 using boost::multiprecision::cpp_bin_float_100;
 using boost::math::quadrature::trapezoidal;
+using boost::math::quadrature::quadrature_statistics;
+using boost::math::quadrature::romberg;
+using boost::math::quadrature::periodic_trapezoidal;
+using boost::math::quadrature::trapezoidal_state;
 
 // These tests come from:
 // https://doi.org/10.1023/A:1025524324969
@@ -223,6 +227,139 @@ void test_rational_sin()
     BOOST_CHECK_CLOSE_FRACTION(Q, expected, tol);
 }
 
+template<class Real>
+void test_statistics()
+{
+    using std::sin;
+    std::cout << "Testing integration statistics with the trapezoidal rule on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    std::size_t calls = 0;
+    auto f = [&](Real x)->Real { ++calls; Real t = 5 + sin(x); return 1 / (t*t); };
+    Real tol = 100 * boost::math::tools::epsilon<Real>();
+    Real error, L1;
+    quadrature_statistics<Real> stats;
+    Real Q = trapezoidal(f, (Real) 0, boost::math::constants::two_pi<Real>(), tol, 12, &error, &L1, boost::math::policies::policy<>(), &stats);
+    BOOST_CHECK_EQUAL(stats.evaluations, calls);
+    BOOST_CHECK_EQUAL(stats.intervals, 1u);
+    // Levels 0 and 1, then one error estimate for each further level:
+    BOOST_CHECK_EQUAL(stats.errors.size(), stats.levels - 1);
+    BOOST_CHECK_EQUAL(stats.evaluations, (std::size_t(1) << (stats.levels - 1)) + 1);
+    BOOST_CHECK_EQUAL(stats.errors.back(), error);
+    calls = 0;
+    BOOST_CHECK_EQUAL(trapezoidal(f, (Real) 0, boost::math::constants::two_pi<Real>(), tol, 12), Q);
+    BOOST_CHECK_EQUAL(calls, stats.evaluations);
+}
+
+template<class Real>
+void test_romberg()
+{
+    using std::exp;
+    std::cout << "Testing Romberg integration on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    std::size_t calls = 0;
+    auto f = [&](Real x)->Real { using std::exp; ++calls; return exp(x); };
+    Real tol = 100*boost::math::tools::epsilon<Real>();
+    Real error, L1;
+    Real Q = romberg(f, (Real) 0, (Real) 1, tol, 12, &error, &L1);
+    Real expected = boost::math::constants::e<Real>() - 1;
+    BOOST_CHECK_CLOSE_FRACTION(Q, expected, 10*boost::math::tools::epsilon<Real>());
+    BOOST_CHECK_LE(error, tol*L1);
+    // The L1 norm is that of the trapezoidal sums, and is not extrapolated:
+    BOOST_CHECK_CLOSE_FRACTION(L1, expected, Real(1e-2));
+    // Far fewer evaluations than the trapezoidal rule needs for the same smooth, non-periodic integrand,
+    // even to a much looser tolerance:
+    std::size_t romberg_calls = calls;
+    calls = 0;
+    trapezoidal(f, (Real) 0, (Real) 1, boost::math::tools::root_epsilon<Real>(), 20);
+    BOOST_CHECK_LT(2*romberg_calls, calls);
+
+    // Reversed bounds, and a degenerate interval:
+    BOOST_CHECK_CLOSE_FRACTION(romberg(f, (Real) 1, (Real) 0, tol), -expected, 10*boost::math::tools::epsilon<Real>());
+    BOOST_CHECK_EQUAL(romberg(f, (Real) 1, (Real) 1), Real(0));
+
+    // Column k of the tableau is exact for polynomials of degree 2k+1, so a quintic is exact from the third level on:
+    auto g = [](Real x)->Real { return ((6*x - 5)*x + 1)*x*x*x; };
+    trapezoidal_state<Real> state((Real) 0, (Real) 2);
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+        state.refine(g);
+    }
+    BOOST_CHECK_CLOSE_FRACTION(state.romberg(), Real(36), 10*boost::math::tools::epsilon<Real>());
+}
+
+template<class Real>
+void test_periodic_trapezoidal()
+{
+    using std::sin;
+    using boost::math::constants::two_pi;
+    std::cout << "Testing periodic trapezoidal integration on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    Real a = 5;
+    Real b = two_pi<Real>();
+    std::size_t calls = 0;
+    std::size_t right_endpoint_calls = 0;
+    auto f = [&](Real x)->Real { using std::sin; ++calls; if (x == b) ++right_endpoint_calls; Real t = a + sin(x); return 1 / (t*t); };
+    Real expected = two_pi<Real>()*a/pow(a*a - 1, 3*boost::math::constants::half<Real>());
+    Real error, L1;
+    quadrature_statistics<Real> stats;
+    Real Q = periodic_trapezoidal(f, (Real) 0, b, 4*boost::math::tools::epsilon<Real>(), 12, &error, &L1, boost::math::policies::policy<>(), &stats);
+    BOOST_CHECK_CLOSE_FRACTION(Q, expected, 10*boost::math::tools::epsilon<Real>());
+    BOOST_CHECK_EQUAL(right_endpoint_calls, 0u);
+    BOOST_CHECK_EQUAL(stats.evaluations, calls);
+    BOOST_CHECK_EQUAL(stats.evaluations, std::size_t(1) << (stats.levels - 1));
+    BOOST_CHECK_EQUAL(stats.errors.back(), error);
+    // The exponential convergence is recognised, so fewer evaluations are needed than by trapezoidal to the same accuracy:
+    std::size_t periodic_calls = calls;
+    calls = 0;
+    Real Q_trapezoidal = trapezoidal(f, (Real) 0, b, boost::math::tools::root_epsilon<Real>());
+    BOOST_CHECK_CLOSE_FRACTION(Q_trapezoidal, expected, 10*boost::math::tools::epsilon<Real>());
+    BOOST_CHECK_LT(periodic_calls, calls);
+    // Reversed bounds:
+    BOOST_CHECK_CLOSE_FRACTION(periodic_trapezoidal(f, b, (Real) 0), -expected, 10*boost::math::tools::epsilon<Real>());
+}
+
+template<class Real>
+void test_resumable_state()
+{
+    using std::sin;
+    using boost::math::constants::two_pi;
+    std::cout << "Testing that trapezoidal estimates can be refined later on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    std::size_t calls = 0;
+    auto f = [&](Real x)->Real { using std::sin; ++calls; Real t = 5 + sin(x); return 1 / (t*t); };
+    trapezoidal_state<Real> state((Real) 0, two_pi<Real>());
+    BOOST_CHECK_EQUAL(state.levels(), 0u);
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+        state.refine(f);
+    }
+    BOOST_CHECK_EQUAL(state.levels(), 3u);
+    BOOST_CHECK_EQUAL(state.evaluations(), 5u);
+    Real coarse_error = state.error_estimate();
+    // Resume: each sample already taken is reused, so the evaluation count is that of a single pass:
+    while (state.levels() < 8)
+    {
+        state.refine(f);
+    }
+    BOOST_CHECK_EQUAL(calls, (std::size_t(1) << 7) + 1);
+    BOOST_CHECK_EQUAL(state.evaluations(), calls);
+    BOOST_CHECK_LT(state.error_estimate(), coarse_error);
+    calls = 0;
+    Real error;
+    Real Q = trapezoidal(f, (Real) 0, two_pi<Real>(), Real(0), 8, &error);
+    BOOST_CHECK_CLOSE_FRACTION(state.trapezoid(), Q, 4*boost::math::tools::epsilon<Real>());
+
+    // Complex valued integrands:
+    auto g = [](Real x)->std::complex<Real> { using std::sin; using std::cos; return std::complex<Real>(cos(x), sin(x))*x; };
+    trapezoidal_state<Real, std::complex<Real> > complex_state((Real) 0, (Real) 1);
+    for (std::size_t k = 0; k < 6; ++k)
+    {
+        complex_state.refine(g);
+    }
+    // \int_0^1 x e^{ix} dx = (cos(1) + sin(1) - 1) + i(sin(1) - cos(1)):
+    Real one = 1;
+    Real tol = (std::max)(Real(1e-14), 100*boost::math::tools::epsilon<Real>());
+    BOOST_CHECK_CLOSE_FRACTION(complex_state.romberg().real(), cos(one) + sin(one) - 1, tol);
+    BOOST_CHECK_CLOSE_FRACTION(complex_state.romberg().imag(), sin(one) - cos(one), tol);
+    BOOST_CHECK_LE(complex_state.romberg_error_estimate(), 100*tol);
+}
+
 BOOST_AUTO_TEST_CASE(trapezoidal_quadrature)
 {
     test_constant<float>();
@@ -270,6 +407,24 @@ BOOST_AUTO_TEST_CASE(trapezoidal_quadrature)
     //test_rational_sin<boost::math::concepts::real_concept>();
     test_rational_sin<cpp_bin_float_50>();
 
+    test_statistics<float>();
+    test_statistics<double>();
+    test_statistics<cpp_bin_float_50>();
+
+    test_romberg<float>();
+    test_romberg<double>();
+    test_romberg<long double>();
+    test_romberg<cpp_bin_float_50>();
+
+    test_periodic_trapezoidal<float>();
+    test_periodic_trapezoidal<double>();
+    test_periodic_trapezoidal<long double>();
+    test_periodic_trapezoidal<cpp_bin_float_50>();
+
+    test_resumable_state<float>();
+    test_resumable_state<double>();
+    test_resumable_state<cpp_bin_float_50>();
+
     test_complex_bessel<std::complex<float>>();
     test_complex_bessel<std::complex<double>>();
     test_complex_bessel<std::complex<long double>>();
@@ -0,0 +1,186 @@
+/*
+ * Copyright The Boost.Math contributors, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#define BOOST_TEST_MODULE vegas_test
+#include <cmath>
+#include <ostream>
+#include <stdexcept>
+#include <boost/type_index.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/vegas.hpp>
+
+using std::abs;
+using std::vector;
+using std::pair;
+using boost::math::constants::pi;
+using boost::math::quadrature::vegas;
+
+template<class Real>
+void test_gaussian_peak(uint64_t dimension, uint64_t threads)
+{
+    std::cout << "Testing that a narrow Gaussian peak in " << dimension << " dimensions is integrated by VEGAS on "
+              << threads << " threads on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using std::exp;
+    using std::sqrt;
+    using std::pow;
+    // A Gaussian of width sigma centred at 1/3 in each coordinate, normalized to unit integral over the
+    // whole space; the unit hypercube holds all but a negligible part of it.
+    Real sigma = (Real) 0.05;
+    auto g = [&](std::vector<Real> const & x)->Real
+    {
+        Real r2 = 0;
+        for (uint64_t i = 0; i < x.size(); ++i)
+        {
+            Real t = x[i] - Real(1)/Real(3);
+            r2 += t*t;
+        }
+        return exp(-r2/(2*sigma*sigma))/pow(sigma*sqrt(2*pi<Real>()), Real(x.size()));
+    };
+    vector<pair<Real, Real>> bounds(dimension, pair<Real, Real>(Real(0), Real(1)));
+    Real error_goal = (Real) 0.001;
+    vegas<Real, decltype(g)> v(g, bounds, error_goal, /*singular =*/ false, threads, 1729);
+    auto task = v.integrate();
+    Real y = task.get();
+    BOOST_CHECK_LE(v.current_error_estimate(), error_goal);
+    BOOST_CHECK_LE(abs(y - 1), 6*error_goal);
+    BOOST_CHECK_GE(v.iterations(), 3u);
+    // The iterations should agree with one another:
+    BOOST_CHECK_LE(v.chi_squared(), 5);
+    //
+    // The variance of the integrand over the cube is (4 pi sigma^2)^(-d/2) - 1, so plain Monte Carlo
+    // would need that over the error goal squared evaluations:
+    //
+    Real monte_carlo_calls = (pow(4*pi<Real>()*sigma*sigma, -Real(dimension)/2) - 1)/(error_goal*error_goal);
+    BOOST_CHECK_LE(Real(v.calls()), monte_carlo_calls/20);
+}
+
+template<class Real>
+void test_infinite_bounds()
+{
+    std::cout << "Testing that a Gaussian over the plane is integrated by VEGAS on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using std::exp;
+    auto g = [](std::vector<Real> const & x)->Real
+    {
+        return exp(-x[0]*x[0] - x[1]*x[1]);
+    };
+    Real inf = std::numeric_limits<Real>::infinity();
+    vector<pair<Real, Real>> bounds{{-inf, inf}, {Real(0), inf}};
+    Real error_goal = (Real) 0.001;
+    vegas<Real, decltype(g)> v(g, bounds, error_goal, true, 2, 42);
+    auto task = v.integrate();
+    Real y = task.get();
+    BOOST_CHECK_LE(v.current_error_estimate(), error_goal);
+    BOOST_CHECK_LE(abs(y - pi<Real>()/2), 6*error_goal);
+}
+
+template<class Real>
+void test_constant()
+{
+    std::cout << "Testing constants are integrated correctly by VEGAS on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    auto g = [](std::vector<Real> const &)->Real
+    {
+      return 1;
+    };
+    std::vector<std::pair<Real, Real>> bounds{{Real(0), Real(1)}, { Real(0), Real(2)}};
+    vegas<Real, decltype(g)> v(g, bounds, (Real) 0.0001, false, 1, 87);
+    auto task = v.integrate();
+    Real two = task.get();
+    BOOST_CHECK_CLOSE_FRACTION(two, 2, 10*std::numeric_limits<Real>::epsilon());
+    BOOST_CHECK_SMALL(v.current_error_estimate(), std::numeric_limits<Real>::epsilon());
+    BOOST_CHECK_EQUAL(v.iterations(), 1u);
+}
+
+template<class Real>
+void test_reproducibility()
+{
+    std::cout << "Testing that VEGAS integration is reproducible for a given seed and number of threads on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using std::exp;
+    auto g = [](std::vector<Real> const & x)->Real
+    {
+        return exp(-10*(x[0] - x[1])*(x[0] - x[1]));
+    };
+    std::vector<std::pair<Real, Real>> bounds{{Real(0), Real(1)}, { Real(0), Real(1)}};
+    vegas<Real, decltype(g)> v1(g, bounds, (Real) 0.0005, true, 3, 12345);
+    vegas<Real, decltype(g)> v2(g, bounds, (Real) 0.0005, true, 3, 12345);
+    Real y1 = v1.integrate().get();
+    Real y2 = v2.integrate().get();
+    BOOST_CHECK_EQUAL(y1, y2);
+    BOOST_CHECK_EQUAL(v1.calls(), v2.calls());
+    BOOST_CHECK_EQUAL(v1.iterations(), v2.iterations());
+    BOOST_CHECK_EQUAL(v1.current_error_estimate(), v2.current_error_estimate());
+}
+
+template<class Real>
+void test_cancel_and_restart()
+{
+    std::cout << "Testing that cancellation and restarting works on VEGAS integration on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using std::exp;
+    // exp(-x.x) over [0,1]^3:
+    Real exact = (Real) 0.41653838588663326581353965522362L;
+    auto g = [&](std::vector<Real> const & x)->Real
+    {
+        return exp(-x[0]*x[0] - x[1]*x[1] - x[2]*x[2]);
+    };
+    vector<pair<Real, Real>> bounds{{ Real(0), Real(1)}, { Real(0), Real(1)}, { Real(0), Real(1)}};
+    vegas<Real, decltype(g)> v(g, bounds, (Real) 1e-8, true, 2, 888889);
+
+    auto task = v.integrate();
+    v.cancel();
+    Real y = task.get();
+    BOOST_CHECK_CLOSE_FRACTION(y, exact, 0.05);
+    uint64_t iterations = v.iterations();
+
+    v.update_target_error((Real) 1e-4);
+    task = v.integrate();
+    y = task.get();
+    BOOST_CHECK_GT(v.iterations(), iterations);
+    BOOST_CHECK_LE(v.current_error_estimate(), 1e-4);
+    BOOST_CHECK_LE(abs(y - exact), 6e-4);
+}
+
+template<class Real>
+void test_exception_from_integrand()
+{
+    std::cout << "Testing that exceptions are propagated from the VEGAS integrator on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    auto g = [](std::vector<Real> const & x)->Real
+    {
+        if (x[0] > 0.5 && x[0] < 0.5001)
+        {
+            throw std::domain_error("You have done something wrong.\n");
+        }
+        return x[1];
+    };
+
+    std::vector<std::pair<Real, Real>> bounds{{ Real(0), Real(1)}, { Real(0), Real(1)}};
+    vegas<Real, decltype(g)> v(g, bounds, (Real) 0.0001);
+    auto task = v.integrate();
+    BOOST_CHECK_THROW(task.get(), std::domain_error);
+}
+
+BOOST_AUTO_TEST_CASE(vegas_test)
+{
+#if !defined(TEST) || TEST == 1
+    test_gaussian_peak<double>(2, 1);
+    test_gaussian_peak<double>(4, 2);
+#endif
+#if !defined(TEST) || TEST == 2
+    test_gaussian_peak<float>(3, 2);
+    test_infinite_bounds<double>();
+    test_infinite_bounds<long double>();
+#endif
+#if !defined(TEST) || TEST == 3
+    test_constant<double>();
+    test_constant<float>();
+    test_exception_from_integrand<double>();
+    test_reproducibility<double>();
+#endif
+#if !defined(TEST) || TEST == 4
+    test_cancel_and_restart<double>();
+#endif
+}
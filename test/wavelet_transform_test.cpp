@@ -130,11 +130,79 @@ void test_wavelet_transform()
 
 }
 
+template<typename Real, int p>
+void test_grid()
+{
+    std::cout << "Testing wavelet transform grid with " << p << " vanishing moment Daubechies wavelet on type " << boost::core::demangle(typeid(Real).name()) << "\n";
+    auto psi = boost::math::daubechies_wavelet<Real, p>();
+    std::size_t calls = 0;
+    auto f = [&calls](Real x) {
+        ++calls;
+        return std::exp(-x*x)*std::cos(3*x);
+    };
+    auto Wf = daubechies_wavelet_transform(f, psi);
+    std::vector<Real> scales{Real(-2), Real(-0.75), Real(0), Real(0.5), Real(1), Real(3)};
+    Real t0 = -3;
+    Real h = Real(1)/128;
+    std::size_t n = 6*128;
+    auto W = Wf.grid(scales, t0, h, n);
+    // Neither this nor the adaptive quadrature of operator() converges quickly for the less smooth wavelets:
+    Real tol = p < 6 ? Real(1e-5) : Real(1e-8);
+    // f is sampled once at each point under the support of the widest wavelet, over all the translations:
+    auto [a, b] = psi.support();
+    Real lo = 0;
+    Real hi = 0;
+    for (Real s : scales)
+    {
+        lo = std::min(lo, std::ceil(std::min(s*a, s*b)/h));
+        hi = std::max(hi, std::floor(std::max(s*a, s*b)/h));
+    }
+    std::size_t expected_calls = n + static_cast<std::size_t>(hi - lo);
+    CHECK_EQUAL(calls, expected_calls);
+    CHECK_EQUAL(W.size(), scales.size());
+    for (std::size_t i = 0; i < scales.size(); ++i)
+    {
+        CHECK_EQUAL(W[i].size(), n);
+        for (std::size_t j = 0; j < n; j += 37)
+        {
+            Real t = t0 + j*h;
+            Real w = Wf(scales[i], t);
+            if (!CHECK_ABSOLUTE_ERROR(w, W[i][j], tol))
+            {
+                std::cerr << "  Grid disagrees with quadrature at s = " << scales[i] << ", t = " << t << "\n";
+            }
+        }
+    }
+    // The result doesn't depend on the number of threads:
+    auto W1 = Wf.grid(scales, t0, h, n, 1);
+    for (std::size_t i = 0; i < scales.size(); ++i)
+    {
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            CHECK_EQUAL(W1[i][j], W[i][j]);
+        }
+    }
+    CHECK_EQUAL(Wf.grid(scales, t0, h, 0).size(), scales.size());
+
+    bool caught = false;
+    try
+    {
+        Wf.grid(scales, t0, Real(0), n);
+    }
+    catch (std::domain_error const &)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+}
+
 int main()
 {
     test_wavelet_transform<double, 2>();
     test_wavelet_transform<double, 8>();
     test_wavelet_transform<double, 16>();
+    test_grid<double, 4>();
+    test_grid<double, 8>();
     // All these tests pass, but the compilation takes too long on CI:
     //boost::hana::for_each(std::make_index_sequence<17>(), [&](auto i) {
     //    test_wavelet_transform<double, i+3>();